@@ -491,6 +491,42 @@ class TrickHLAFederateConfig( object ):
       return
 
 
+   def set_frame_profile( self,
+                          enabled       = True,
+                          csv_file      = None,
+                          window_size   = 1000,
+                          report_period = 1000,
+                          flush_reports = 10 ):
+
+      # Profile the THLABase.sm data cycle job chain each frame and keep the
+      # rolling p50, p99, p99.9 and max stage times over window_size frames,
+      # updated every report_period frames. The statistics of each report
+      # period are appended to the optional CSV file every flush_reports
+      # reports, where zero only writes them at shutdown.
+      self.federate.frame_profiler.enabled           = enabled
+      self.federate.frame_profiler.window_size       = window_size
+      self.federate.frame_profiler.report_period     = report_period
+      self.federate.frame_profiler.csv_flush_reports = flush_reports
+      if csv_file is not None:
+         self.federate.frame_profiler.csv_file = str( csv_file )
+
+      return
+
+
+   def set_time_straggler_monitor( self,
+                                   enabled       = True,
+                                   sample_period = 0.1 ):
+
+      # Identify the federate holding back the Time Advance Grant (TAG) from
+      # the MOM time attributes, which are requested every sample_period
+      # seconds of a TAG wait, and report the time each federate held back
+      # the TAG at shutdown.
+      self.federate.time_straggler_monitor.enabled       = enabled
+      self.federate.time_straggler_monitor.sample_period = sample_period
+
+      return
+
+
    def add_known_federate( self, is_required, name ):
 
       # You can only add known federates before initialize method is called.
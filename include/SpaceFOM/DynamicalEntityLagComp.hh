@@ -74,6 +74,9 @@ class DynamicalEntityLagComp : public DynamicalEntityLagCompInteg
    /*! @brief Unload the integration state from the integrator. */
    virtual void unload();
 
+   /*! @brief Normalize the attitude quaternion after an integration step. */
+   virtual void normalize_state();
+
    /*! @brief Compute the first time derivative of the lag compensation state vector.
     *  @param user_data Any special user data needed to compute the derivative values. */
    virtual void derivative_first( void *user_data = NULL );
@@ -32,6 +32,7 @@ NASA, Johnson Space Center\n
 @revs_title
 @revs_begin
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, November 2023, --, Initial version.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Split compensation into begin and end steps for batching.}
 @revs_end
 
 */
@@ -76,14 +77,6 @@ class DynamicalEntityLagCompBase : public PhysicalEntityLagCompBase
    /*! @brief Initialization integration states. */
    virtual void initialize_states();
 
-   /*! @brief Sending side latency compensation callback interface from the
-    *  TrickHLALagCompensation class. */
-   virtual void send_lag_compensation();
-
-   /*! @brief Receive side latency compensation callback interface from the
-    *  TrickHLALagCompensation class. */
-   virtual void receive_lag_compensation();
-
    /*! @brief When lag compensation is disabled, this function is called to
     * bypass the send side lag compensation and your implementation must copy
     * the sim-data to the lag-comp data to effect the bypass. */
@@ -128,6 +121,12 @@ class DynamicalEntityLagCompBase : public PhysicalEntityLagCompBase
       double const t_begin,
       double const t_end ) = 0;
 
+   /*! @brief Set the receive side compensation time step, load the
+    * received state into the lag compensation state and update the inverse
+    * of the inertia matrix if the inertia was received.
+    *  @return True if the state was received and needs to be compensated. */
+   virtual bool begin_receive_lag_compensation();
+
    /*! @brief Unload the lag compensation state into the packing data. */
    virtual void unload_lag_comp_data();
 
@@ -0,0 +1,86 @@
+/*!
+@file SpaceFOM/DynamicalEntityLagCompClosedForm.hh
+@ingroup SpaceFOM
+@brief Definition of the TrickHLA SpaceFOM dynamical entity latency/lag
+compensation class that uses a closed-form solution to compensate the state.
+
+This is the base implementation for the Space Reference FOM (SpaceFOM) interface
+to the DynamicalEntity latency compensation object. The accelerations are
+evaluated from the mass properties, force and torque at the start of the
+compensation interval and held constant while the state is propagated in a
+single step.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+
+@tldh
+@trick_link_dependency{../../source/SpaceFOM/DynamicalEntityLagCompBase.cpp}
+@trick_link_dependency{../../source/SpaceFOM/DynamicalEntityLagCompClosedForm.cpp}
+@trick_link_dependency{../../source/SpaceFOM/SpaceTimeCoordinateData.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef SPACEFOM_DYNAMICAL_ENTITY_LAG_COMP_CLOSED_FORM_HH
+#define SPACEFOM_DYNAMICAL_ENTITY_LAG_COMP_CLOSED_FORM_HH
+
+// SpaceFOM includes.
+#include "SpaceFOM/DynamicalEntityLagCompBase.hh"
+
+namespace SpaceFOM
+{
+
+class DynamicalEntityLagCompClosedForm : public DynamicalEntityLagCompBase
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__DynamicalEntityLagCompClosedForm();
+
+  public:
+   // Public constructors and destructors.
+   explicit DynamicalEntityLagCompClosedForm( DynamicalEntityBase &entity_ref ); // Initialization constructor.
+   virtual ~DynamicalEntityLagCompClosedForm();                                  // Destructor.
+
+  protected:
+   /*! @brief Compensate the state data from the data time to the current scenario time.
+    *  @param t_begin Scenario time at the start of the compensation step.
+    *  @param t_end   Scenario time at the end of the compensation step. */
+   virtual int compensate(
+      double const t_begin,
+      double const t_end );
+
+  private:
+   // This object is not copyable
+   /*! @brief Copy constructor for DynamicalEntityLagCompClosedForm class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   DynamicalEntityLagCompClosedForm( DynamicalEntityLagCompClosedForm const &rhs );
+   /*! @brief Assignment operator for DynamicalEntityLagCompClosedForm class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   DynamicalEntityLagCompClosedForm &operator=( DynamicalEntityLagCompClosedForm const &rhs );
+};
+
+} // namespace SpaceFOM
+
+#endif // SPACEFOM_DYNAMICAL_ENTITY_LAG_COMP_CLOSED_FORM_HH: Do NOT put anything after this line!
@@ -0,0 +1,152 @@
+/*!
+@file SpaceFOM/LagCompBatch.hh
+@ingroup SpaceFOM
+@brief Definition of the TrickHLA SpaceFOM batched latency/lag compensation
+class.
+
+This class compensates a batch of SpaceFOM PhysicalEntity, DynamicalEntity
+and RefFrame lag compensation instances together in one pass. The states of
+all the instances in the batch are gathered into structure-of-arrays storage
+and propagated with the same closed-form solution used by the
+PhysicalEntityLagCompClosedForm, DynamicalEntityLagCompClosedForm and
+RefFrameLagCompClosedForm classes. Since the batch does not call the
+compensate() function of the instances, only instances of these closed-form
+classes can be added to the batch, which LagCompensation::set_batch() checks.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/LagCompensationBatch.cpp}
+@trick_link_dependency{../../source/SpaceFOM/LagCompBatch.cpp}
+@trick_link_dependency{../../source/SpaceFOM/DynamicalEntityLagCompClosedForm.cpp}
+@trick_link_dependency{../../source/SpaceFOM/PhysicalEntityLagCompBase.cpp}
+@trick_link_dependency{../../source/SpaceFOM/PhysicalEntityLagCompClosedForm.cpp}
+@trick_link_dependency{../../source/SpaceFOM/RefFrameLagCompBase.cpp}
+@trick_link_dependency{../../source/SpaceFOM/RefFrameLagCompClosedForm.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef SPACEFOM_LAG_COMP_BATCH_HH
+#define SPACEFOM_LAG_COMP_BATCH_HH
+
+// System includes.
+#include <vector>
+
+// TrickHLA includes.
+#include "TrickHLA/LagCompensation.hh"
+#include "TrickHLA/LagCompensationBatch.hh"
+
+namespace SpaceFOM
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class PhysicalEntityLagCompBase;
+class RefFrameLagCompBase;
+
+class LagCompBatch : public TrickHLA::LagCompensationBatch
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__LagCompBatch();
+
+  public:
+   // Public constructors and destructors.
+   LagCompBatch();          // Default constructor.
+   virtual ~LagCompBatch(); // Destructor.
+
+   /*! @brief Determine if the batch can compensate a lag compensation
+    * instance, which must be a SpaceFOM PhysicalEntity, DynamicalEntity or
+    * RefFrame closed-form lag compensation.
+    *  @return True if the batch supports the lag compensation instance.
+    *  @param lag_comp Lag compensation instance. */
+   virtual bool is_supported( TrickHLA::LagCompensation const *lag_comp ) const;
+
+   /*! @brief Load the working state of a send side lag compensation
+    * instance and add it to the batch.
+    *  @param lag_comp SpaceFOM PhysicalEntity, DynamicalEntity or RefFrame
+    *  closed-form lag compensation instance. */
+   virtual void add_send_lag_compensation( TrickHLA::LagCompensation *lag_comp );
+
+   /*! @brief Compensate all the send side instances in the batch and unload
+    * the compensated states into the packing data. */
+   virtual void send_lag_compensation();
+
+   /*! @brief Load the received state of a receive side lag compensation
+    * instance and add it to the batch.
+    *  @param lag_comp SpaceFOM PhysicalEntity, DynamicalEntity or RefFrame
+    *  closed-form lag compensation instance. */
+   virtual void add_receive_lag_compensation( TrickHLA::LagCompensation *lag_comp );
+
+   /*! @brief Compensate all the receive side instances in the batch and
+    * unload the compensated states into the working data. */
+   virtual void receive_lag_compensation();
+
+  protected:
+   std::vector< PhysicalEntityLagCompBase * > entities;          ///< @trick_io{**} Entity lag compensation instances in the batch.
+   std::vector< bool >                        entities_received; ///< @trick_io{**} True if the entity state was received.
+   std::vector< RefFrameLagCompBase * >       frames;            ///< @trick_io{**} Reference frame lag compensation instances in the batch.
+   std::vector< bool >                        frames_received;   ///< @trick_io{**} True if the reference frame state was received.
+
+   // Structure-of-arrays state storage, one element per compensated state.
+   std::vector< double > dt;            ///< @trick_io{**} Compensation time step.
+   std::vector< double > t_end;         ///< @trick_io{**} Scenario time at the end of the compensation.
+   std::vector< double > pos[3];        ///< @trick_io{**} Position components.
+   std::vector< double > vel[3];        ///< @trick_io{**} Velocity components.
+   std::vector< double > accel[3];      ///< @trick_io{**} Acceleration components.
+   std::vector< double > att_scalar;    ///< @trick_io{**} Attitude quaternion scalar.
+   std::vector< double > att_vector[3]; ///< @trick_io{**} Attitude quaternion vector components.
+   std::vector< double > ang_vel[3];    ///< @trick_io{**} Angular velocity components.
+   std::vector< double > ang_accel[3];  ///< @trick_io{**} Angular acceleration components.
+
+   /*! @brief Gather the states to compensate into the structure-of-arrays
+    * storage, propagate them and scatter them back.
+    *  @param sending True for send side compensation, false for receive side. */
+   void compensate( bool const sending );
+
+   /*! @brief Resize the structure-of-arrays storage.
+    *  @param count Number of states to store. */
+   void resize( unsigned int const count );
+
+   /*! @brief Propagate all the states in the structure-of-arrays storage.
+    *  @param count Number of states to propagate. */
+   void propagate( unsigned int const count );
+
+  private:
+   // This object is not copyable
+   /*! @brief Copy constructor for LagCompBatch class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   LagCompBatch( LagCompBatch const &rhs );
+   /*! @brief Assignment operator for LagCompBatch class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   LagCompBatch &operator=( LagCompBatch const &rhs );
+};
+
+} // namespace SpaceFOM
+
+#endif // SPACEFOM_LAG_COMP_BATCH_HH: Do NOT put anything after this line!
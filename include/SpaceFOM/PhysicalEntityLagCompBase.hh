@@ -27,11 +27,14 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/LagCompensation.cpp}
 @trick_link_dependency{../../source/TrickHLA/Object.cpp}
 @trick_link_dependency{../../source/SpaceFOM/PhysicalEntityLagCompBase.cpp}
+@trick_link_dependency{../../source/SpaceFOM/SpaceTimeCoordinateHistory.cpp}
 @trick_link_dependency{../../source/SpaceFOM/QuaternionData.cpp}
 
 @revs_title
 @revs_begin
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, November 2023, --, Initial version.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Split compensation into begin and end steps for batching.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Added optional received state history.}
 @revs_end
 
 */
@@ -46,6 +49,7 @@ NASA, Johnson Space Center\n
 #include "SpaceFOM/PhysicalEntityBase.hh"
 #include "SpaceFOM/QuaternionData.hh"
 #include "SpaceFOM/SpaceTimeCoordinateData.hh"
+#include "SpaceFOM/SpaceTimeCoordinateHistory.hh"
 
 // TrickHLA includes.
 #include "TrickHLA/LagCompensation.hh"
@@ -64,6 +68,8 @@ class PhysicalEntityLagCompBase : public TrickHLA::LagCompensation
    // IMPORTANT Note: you must have the following line too.
    // Syntax: friend void init_attr<namespace>__<class name>();
    friend void init_attrSpaceFOM__PhysicalEntityLagCompBase();
+   // The batched lag compensation drives the begin and end functions.
+   friend class LagCompBatch;
 
   public:
    // Public constructors and destructors.
@@ -100,9 +106,46 @@ class PhysicalEntityLagCompBase : public TrickHLA::LagCompensation
     * the sim-data otherwise you will be copying stale data. */
    virtual void bypass_receive_lag_compensation();
 
+   /*! @brief Receive side latency compensation callback for a frame without
+    *  new data, which plays back the state from the history at the delayed
+    *  time so the played back state advances every frame. */
+   virtual void idle_receive_lag_compensation();
+
+   /*! @brief Set the number of received states kept in the history. A size
+    *  of zero, the default, disables the history.
+    *  @param size Maximum number of received states in the history. */
+   void set_history_capacity( unsigned int const size )
+   {
+      history.set_capacity( size );
+   }
+
+   /*! @brief Set the receive side playback delay. When the history is
+    *  enabled and the delay is positive, the receive side state is
+    *  interpolated from the history at the current scenario time minus the
+    *  delay instead of being extrapolated from the latest received state.
+    *  @param delay Playback delay time. */
+   void set_history_delay( double const delay )
+   {
+      history_delay = delay;
+   }
+
+   /*! @brief Get the received state at an arbitrary time from the history.
+    *  @return True if the state was computed, false if the history is empty.
+    *  @param time  Scenario time to compute the state for.
+    *  @param state Computed state. */
+   bool get_history_state(
+      double const             time,
+      SpaceTimeCoordinateData &state ) const
+   {
+      return ( history.get_state( time, state ) );
+   }
+
   public:
    bool debug; ///< @trick_units{--} Debug output flag.
 
+   SpaceTimeCoordinateHistory history;       ///< @trick_units{--} Optional history of the received states.
+   double                     history_delay; ///< @trick_units{s} Receive side playback delay from the history (default: 0.0).
+
   protected:
    PhysicalEntityBase &entity; ///< @trick_units{--} @trick_io{**}  PhysicalEntity to compensate.
 
@@ -135,6 +178,28 @@ class PhysicalEntityLagCompBase : public TrickHLA::LagCompensation
       double const t_begin,
       double const t_end ) = 0;
 
+   /*! @brief Set the send side compensation time step and load the working
+    * state into the lag compensation state. */
+   virtual void begin_send_lag_compensation();
+
+   /*! @brief Unload the compensated send side state into the packing data. */
+   virtual void end_send_lag_compensation();
+
+   /*! @brief Set the receive side compensation time step and load the
+    * received state into the lag compensation state.
+    *  @return True if the state was received and needs to be compensated. */
+   virtual bool begin_receive_lag_compensation();
+
+   /*! @brief Unload the compensated receive side state into the working data. */
+   virtual void end_receive_lag_compensation();
+
+   /*! @brief Check if the receive side state is played back from the history.
+    *  @return True if the history is enabled and the playback delay is positive. */
+   bool is_history_playback() const
+   {
+      return ( history.is_enabled() && ( history_delay > 0.0 ) );
+   }
+
    /*! @brief Unload the lag compensation state into the packing data. */
    virtual void unload_lag_comp_data();
 
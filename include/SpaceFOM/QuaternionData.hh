@@ -206,6 +206,28 @@ class QuaternionData
       double const omega[3],
       double const omega_dot[3] );
 
+   /*! @brief Propagate an attitude quaternion in closed form assuming a
+    *  constant angular acceleration over the propagation interval.
+    *  @param quat      Attitude quaternion at the start of the interval.
+    *  @param omega     Angular velocity vector at the start of the interval.
+    *  @param omega_dot Angular acceleration vector.
+    *  @param dt        Propagation time interval. */
+   void propagate(
+      QuaternionData const &quat,
+      double const          omega[3],
+      double const          omega_dot[3],
+      double const          dt );
+
+   /*! @brief Spherical linear interpolation (SLERP) between two attitude
+    *  quaternions along the shortest rotation path.
+    *  @param q_begin  Attitude quaternion at the start of the interval.
+    *  @param q_end    Attitude quaternion at the end of the interval.
+    *  @param fraction Interpolation fraction, 0 for q_begin and 1 for q_end. */
+   void slerp(
+      QuaternionData const &q_begin,
+      QuaternionData const &q_end,
+      double const          fraction );
+
    /*! @brief Compute the angular rate from the attitude quaternion rate and the
     *  associated attitude quaternion.
     *  @param att_quat The associated attitude quaternion.
@@ -348,6 +370,24 @@ class QuaternionData
       double const          omega_dot[3],
       QuaternionData       *q_dotdot );
 
+   /*! @brief Propagate an attitude quaternion in closed form assuming a
+    *  constant angular acceleration over the propagation interval.
+    *  @param quat_scalar Scalar part of the attitude quaternion.
+    *  @param quat_vector Vector part of the attitude quaternion.
+    *  @param omega       Angular velocity vector at the start of the interval.
+    *  @param omega_dot   Angular acceleration vector.
+    *  @param dt          Propagation time interval.
+    *  @param prop_scalar Reference to the scalar part of the propagated quaternion.
+    *  @param prop_vector Vector part of the propagated quaternion. */
+   static void compute_propagation(
+      double const quat_scalar,
+      double const quat_vector[3],
+      double const omega[3],
+      double const omega_dot[3],
+      double const dt,
+      double      *prop_scalar,
+      double       prop_vector[3] );
+
    /*! @brief Compute the angular rate from the attitude quaternion rate and the
     *  attitude quaternion.
     *  @param quat_scalar Scalar part of the attitude quaternion.
@@ -3,6 +3,10 @@
 @ingroup SpaceFOM
 @brief Definition of the TrickHLA SpaceFOM quaternion encoding utility.
 
+The AttitudeQuaternion fixed record is made up of 4 HLAfloat64LE values with
+no padding: scalar and vector[3]. The encoder writes and reads this fixed
+layout directly to and from the opaque buffer in a single pass.
+
 @copyright Copyright 2019 United States Government as represented by the
 Administrator of the National Aeronautics and Space Administration.
 No copyright is claimed in the United States under Title 17, U.S. Code.
@@ -26,6 +30,7 @@ NASA, Johnson Space Center\n
 @revs_title
 @revs_begin
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Single-pass fixed layout encoding.}
 @revs_end
 
 */
@@ -37,28 +42,8 @@ NASA, Johnson Space Center\n
 #include "SpaceFOM/QuaternionData.hh"
 
 // TrickHLA includes.
-#include "TrickHLA/HLAStandardSupport.hh"
 #include "TrickHLA/OpaqueBuffer.hh"
 
-// C++11 deprecated dynamic exception specifications for a function so we need
-// to silence the warnings coming from the IEEE 1516 declared functions.
-// This should work for both GCC and Clang.
-#if defined( IEEE_1516_2010 )
-#   pragma GCC diagnostic push
-#   pragma GCC diagnostic ignored "-Wdeprecated"
-#endif
-
-// HLA include files.
-#include "RTI/RTI1516.h"
-#include "RTI/VariableLengthData.h"
-#include "RTI/encoding/BasicDataElements.h"
-#include "RTI/encoding/HLAfixedArray.h"
-#include "RTI/encoding/HLAfixedRecord.h"
-
-#if defined( IEEE_1516_2010 )
-#   pragma GCC diagnostic pop
-#endif
-
 // Put this class in the SpaceFOM namespace.
 namespace SpaceFOM
 {
@@ -95,14 +80,6 @@ class QuaternionEncoder : public TrickHLA::OpaqueBuffer
   protected:
    QuaternionData &data; ///< @trick_units{--} Quaternion transmission data.
 
-   // Data encoding helpers.
-   RTI1516_NAMESPACE::HLAfloat64LE   scalar_encoder; ///< @trick_io{**} Quaternion scalar encoder
-   RTI1516_NAMESPACE::HLAfloat64LE   vector[3];      ///< @trick_io{**} HLAfloat64LE quaternion vector
-   RTI1516_NAMESPACE::HLAfixedArray  vector_encoder; ///< @trick_io{**} Quaternion vector encoder
-   RTI1516_NAMESPACE::HLAfixedRecord encoder;        ///< @trick_io{**} Attitude quaternion encoder
-
-   RTI1516_NAMESPACE::VariableLengthData encoded_data; ///< @trick_io{**} Variable length encode/decode data.
-
   private:
    // This object is not copyable
    /*! @brief Copy constructor for QuaternionEncoder class.
@@ -32,6 +32,7 @@ NASA, Johnson Space Center\n
 @revs_title
 @revs_begin
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, November 2023, --, Initial version.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Split compensation into begin and end steps for batching.}
 @revs_end
 
 */
@@ -64,6 +65,8 @@ class RefFrameLagCompBase : public TrickHLA::LagCompensation
    // IMPORTANT Note: you must have the following line too.
    // Syntax: friend void init_attr<namespace>__<class name>();
    friend void init_attrSpaceFOM__RefFrameLagCompBase();
+   // The batched lag compensation drives the begin and end functions.
+   friend class LagCompBatch;
 
   public:
    // Public constructors and destructors.
@@ -82,11 +85,11 @@ class RefFrameLagCompBase : public TrickHLA::LagCompensation
 
    /*! @brief Sending side latency compensation callback interface from the
     *  TrickHLALagCompensation class. */
-   virtual void send_lag_compensation() = 0;
+   virtual void send_lag_compensation();
 
    /*! @brief Receive side latency compensation callback interface from the
     *  TrickHLALagCompensation class. */
-   virtual void receive_lag_compensation() = 0;
+   virtual void receive_lag_compensation();
 
    /*! @brief When lag compensation is disabled, this function is called to
     * bypass the send side lag compensation and your implementation must copy
@@ -122,6 +125,21 @@ class RefFrameLagCompBase : public TrickHLA::LagCompensation
       double const t_begin,
       double const t_end ) = 0;
 
+   /*! @brief Set the send side compensation time step and load the working
+    * state into the lag compensation state. */
+   virtual void begin_send_lag_compensation();
+
+   /*! @brief Unload the compensated send side state into the packing data. */
+   virtual void end_send_lag_compensation();
+
+   /*! @brief Set the receive side compensation time step and load the
+    * received state into the lag compensation state.
+    *  @return True if the state was received and needs to be compensated. */
+   virtual bool begin_receive_lag_compensation();
+
+   /*! @brief Unload the compensated receive side state into the working data. */
+   virtual void end_receive_lag_compensation();
+
    /*! @brief Unload the lag compensation state into the packing data. */
    virtual void unload_lag_comp_data();
 
@@ -84,6 +84,17 @@ class SpaceTimeCoordinateData
     *  @param stc_data Source to copy from. */
    void copy( SpaceTimeCoordinateData const &stc_data );
 
+   /*! @brief Propagate the state-time coordinate data in closed form
+    *  assuming constant translational and rotational accelerations.
+    *  @details The time tag is left unchanged for the caller to set.
+    *  @param dt        Propagation time interval.
+    *  @param accel     Translational acceleration vector.
+    *  @param ang_accel Rotational acceleration vector. */
+   void propagate(
+      double const dt,
+      double const accel[3],
+      double const ang_accel[3] );
+
    /*! @brief Print out the data values.
     *  @param stream Output stream. */
    void print_data( std::ostream &stream = std::cout ) const;
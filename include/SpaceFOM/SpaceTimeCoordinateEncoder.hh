@@ -3,6 +3,11 @@
 @ingroup SpaceFOM
 @brief Definition of the TrickHLA SpaceFOM Space/Time coordinate encoder.
 
+The SpaceTimeCoordinateState fixed record is made up of 14 HLAfloat64LE
+values with no padding: position[3], velocity[3], attitude quaternion scalar
+and vector[3], angular_velocity[3] and time. The encoder writes and reads
+this fixed layout directly to and from the opaque buffer in a single pass.
+
 @copyright Copyright 2019 United States Government as represented by the
 Administrator of the National Aeronautics and Space Administration.
 No copyright is claimed in the United States under Title 17, U.S. Code.
@@ -19,12 +24,13 @@ NASA, Johnson Space Center\n
 @python_module{SpaceFOM}
 
 @tldh
-v@trick_link_dependency{../../source/TrickHLA/OpaqueBuffer.cpp}
+@trick_link_dependency{../../source/TrickHLA/OpaqueBuffer.cpp}
 @trick_link_dependency{../../source/SpaceFOM/SpaceTimeCoordinateEncoder.cpp}
 
 @revs_title
 @revs_begin
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Single-pass fixed layout encoding.}
 @revs_end
 
 */
@@ -33,34 +39,11 @@ v@trick_link_dependency{../../source/TrickHLA/OpaqueBuffer.cpp}
 #define SPACEFOM_SPACE_TIME_COORDINATE_ENCODER_HH
 
 // TrickHLA includes.
-#include "TrickHLA/HLAStandardSupport.hh"
 #include "TrickHLA/OpaqueBuffer.hh"
 
 // SpaceFOM includes.
 #include "SpaceFOM/SpaceTimeCoordinateData.hh"
 
-// C++11 deprecated dynamic exception specifications for a function so we need
-// to silence the warnings coming from the IEEE 1516 declared functions.
-// This should work for both GCC and Clang.
-#if defined( IEEE_1516_2010 )
-#   pragma GCC diagnostic push
-#   pragma GCC diagnostic ignored "-Wdeprecated"
-#endif
-
-// HLA include files.
-#include "RTI/RTI1516.h"
-#include "RTI/VariableLengthData.h"
-#include "RTI/encoding/BasicDataElements.h"
-#include "RTI/encoding/HLAfixedArray.h"
-#include "RTI/encoding/HLAfixedRecord.h"
-
-#if defined( IEEE_1516_2010 )
-#   pragma GCC diagnostic pop
-#endif
-
-// SpaceFOM include files.
-#include "SpaceFOM/SpaceTimeCoordinateData.hh"
-
 namespace SpaceFOM
 {
 
@@ -96,27 +79,6 @@ class SpaceTimeCoordinateEncoder : public TrickHLA::OpaqueBuffer
   protected:
    SpaceTimeCoordinateData &data; ///< trick_units{--} State-time coordinate transmission data.
 
-   // Data encoding helpers.
-   RTI1516_NAMESPACE::HLAfloat64LE   position[3];         ///< @trick_io{**} HLAfloat64LE position array
-   RTI1516_NAMESPACE::HLAfixedArray  position_encoder;    ///< @trick_io{**} Position encoder
-   RTI1516_NAMESPACE::HLAfloat64LE   velocity[3];         ///< @trick_io{**} HLAfloat64LE velocity array
-   RTI1516_NAMESPACE::HLAfixedArray  velocity_encoder;    ///< @trick_io{**} Velocity encoder
-   RTI1516_NAMESPACE::HLAfixedRecord trans_state_encoder; ///< @trick_io{**} Translational state encoder
-
-   RTI1516_NAMESPACE::HLAfloat64LE   quat_scalar_encoder; ///< @trick_io{**} Quaternion scalar encoder
-   RTI1516_NAMESPACE::HLAfloat64LE   quat_vector[3];      ///< @trick_io{**} HLAfloat64LE quaternion vector
-   RTI1516_NAMESPACE::HLAfixedArray  quat_vector_encoder; ///< @trick_io{**} Quaternion vector encoder
-   RTI1516_NAMESPACE::HLAfixedRecord quat_encoder;        ///< @trick_io{**} Attitude quaternion encoder
-   RTI1516_NAMESPACE::HLAfloat64LE   angular_velocity[3]; ///< @trick_io{**} HLAfloat64LE angular velocity array.
-   RTI1516_NAMESPACE::HLAfixedArray  ang_vel_encoder;     ///< @trick_io{**} Angular velocity encoder
-   RTI1516_NAMESPACE::HLAfixedRecord rot_state_encoder;   ///< @trick_io{**} Rotational state encoder
-
-   RTI1516_NAMESPACE::HLAfloat64LE time_encoder; ///< @trick_io{**} Time encoder
-
-   RTI1516_NAMESPACE::HLAfixedRecord encoder; ///< @trick_io{**} Space/Time coordinate encoder
-
-   RTI1516_NAMESPACE::VariableLengthData encoded_data; ///< @trick_io{**} Variable length encode/decode data.
-
   private:
    // This object is not copyable
    /*! @brief Copy constructor for SpaceTimeCoordinateEncoder class.
@@ -0,0 +1,179 @@
+/*!
+@file SpaceFOM/SpaceTimeCoordinateHistory.hh
+@ingroup SpaceFOM
+@brief Definition of a fixed capacity time-stamped state history for
+received SpaceFOM space/time coordinate states.
+
+The history is a ring buffer of received states along with their
+translational and rotational accelerations. The state can be queried at an
+arbitrary time. Inside the history window the position and velocity are
+interpolated with a cubic Hermite spline, the attitude with a spherical
+linear interpolation (SLERP) and the angular velocity linearly. Outside the
+history window the nearest sample is extrapolated in closed form assuming
+constant accelerations.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{SpaceFOM}
+
+@tldh
+@trick_link_dependency{../../source/SpaceFOM/SpaceTimeCoordinateHistory.cpp}
+@trick_link_dependency{../../source/SpaceFOM/SpaceTimeCoordinateData.cpp}
+@trick_link_dependency{../../source/SpaceFOM/QuaternionData.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef SPACEFOM_SPACE_TIME_COORDINATE_HISTORY_HH
+#define SPACEFOM_SPACE_TIME_COORDINATE_HISTORY_HH
+
+// System includes.
+#include <vector>
+
+// SpaceFOM includes.
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
+
+namespace SpaceFOM
+{
+
+class SpaceTimeCoordinateSample
+{
+  public:
+   SpaceTimeCoordinateData state; ///< @trick_units{--} Space time coordinate state, including its time tag.
+
+   double accel[3];     ///< @trick_units{m/s2} Translational acceleration vector.
+   double ang_accel[3]; ///< @trick_units{rad/s2} Rotational acceleration vector.
+
+   /*! @brief Default constructor for the SpaceTimeCoordinateSample class. */
+   SpaceTimeCoordinateSample();
+};
+
+class SpaceTimeCoordinateHistory
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exist - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrSpaceFOM__SpaceTimeCoordinateHistory();
+
+  public:
+   // Public constructors and destructors.
+   SpaceTimeCoordinateHistory();          // Default constructor.
+   virtual ~SpaceTimeCoordinateHistory(); // Destructor.
+
+   /*! @brief Set the maximum number of samples kept in the history. A
+    *  capacity of zero disables the history. Changing the capacity clears
+    *  the history.
+    *  @param size Maximum number of samples. */
+   void set_capacity( unsigned int const size );
+
+   /*! @brief Get the maximum number of samples kept in the history.
+    *  @return Maximum number of samples. */
+   unsigned int get_capacity() const
+   {
+      return ( samples.size() );
+   }
+
+   /*! @brief Get the number of samples currently in the history.
+    *  @return Number of samples. */
+   unsigned int get_count() const
+   {
+      return ( count );
+   }
+
+   /*! @brief Check if the history is enabled.
+    *  @return True if the history has a nonzero capacity. */
+   bool is_enabled() const
+   {
+      return ( !samples.empty() );
+   }
+
+   /*! @brief Remove all the samples from the history. */
+   void clear();
+
+   /*! @brief Add a sample to the history, replacing the oldest sample when
+    *  the history is full. A sample with the same time as the newest sample
+    *  replaces it, and a sample older than the newest sample is ignored.
+    *  @return True if the sample was added to the history.
+    *  @param state     Space time coordinate state with its time tag.
+    *  @param accel     Translational acceleration vector.
+    *  @param ang_accel Rotational acceleration vector. */
+   bool add_sample(
+      SpaceTimeCoordinateData const &state,
+      double const                   accel[3],
+      double const                   ang_accel[3] );
+
+   /*! @brief Get the time of the oldest sample in the history.
+    *  @return Time of the oldest sample, or zero if the history is empty. */
+   double get_oldest_time() const;
+
+   /*! @brief Get the time of the newest sample in the history.
+    *  @return Time of the newest sample, or zero if the history is empty. */
+   double get_newest_time() const;
+
+   /*! @brief Get the state at an arbitrary time. The state is interpolated
+    *  inside the history window and extrapolated outside of it.
+    *  @return True if the state was computed, false if the history is empty.
+    *  @param time  Time to compute the state for.
+    *  @param state Computed state, with its time tag set to the time. */
+   bool get_state(
+      double const             time,
+      SpaceTimeCoordinateData &state ) const;
+
+  protected:
+   std::vector< SpaceTimeCoordinateSample > samples; ///< @trick_io{**} Ring buffer of samples.
+
+   unsigned int oldest; ///< @trick_units{--} Ring buffer index of the oldest sample.
+   unsigned int count;  ///< @trick_units{--} Number of samples in the ring buffer.
+
+   /*! @brief Get a sample by its age order.
+    *  @return Sample reference.
+    *  @param index Sample index, 0 for the oldest sample. */
+   SpaceTimeCoordinateSample const &get_sample( unsigned int const index ) const
+   {
+      return ( samples[( oldest + index ) % samples.size()] );
+   }
+
+   /*! @brief Interpolate between two samples.
+    *  @param begin Sample at the start of the interval.
+    *  @param end   Sample at the end of the interval.
+    *  @param time  Time to compute the state for, inside the interval.
+    *  @param state Interpolated state. */
+   static void interpolate(
+      SpaceTimeCoordinateSample const &begin,
+      SpaceTimeCoordinateSample const &end,
+      double const                     time,
+      SpaceTimeCoordinateData         &state );
+
+  private:
+   // This object is not copyable
+   /*! @brief Copy constructor for SpaceTimeCoordinateHistory class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   SpaceTimeCoordinateHistory( SpaceTimeCoordinateHistory const &rhs );
+   /*! @brief Assignment operator for SpaceTimeCoordinateHistory class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   SpaceTimeCoordinateHistory &operator=( SpaceTimeCoordinateHistory const &rhs );
+};
+
+} // namespace SpaceFOM
+
+#endif // SPACEFOM_SPACE_TIME_COORDINATE_HISTORY_HH: Do NOT put anything after this line!
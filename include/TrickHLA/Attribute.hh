@@ -24,6 +24,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/Conditional.cpp}
 @trick_link_dependency{../../source/TrickHLA/RecordElement.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/TrafficCounters.cpp}
 @trick_link_dependency{../../source/TrickHLA/utils/Utilities.cpp}
 
 @revs_title
@@ -53,6 +54,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/HLAStandardSupport.hh"
 #include "TrickHLA/RecordElement.hh"
 #include "TrickHLA/Types.hh"
+#include "TrickHLA/utils/TrafficCounters.hh"
 #include "TrickHLA/utils/Utilities.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
@@ -104,6 +106,10 @@ class Attribute : public RecordElement
 
    //--------------------------------------------------------------------------
 
+   //------------------------- TRICK LOGGABLE OUTPUTS -------------------------
+  public:
+   TrafficCounters traffic; ///< @trick_units{--} Updates and encoded bytes sent and received for this attribute.
+
    //--------------------------------------------------------------------------
    // Public member functions.
    //--------------------------------------------------------------------------
@@ -125,6 +131,29 @@ class Attribute : public RecordElement
                     int const          object_index,
                     int const          attribute_index );
 
+   /*! @brief Initializes the TrickHLA Attribute.
+    *  @param obj_FOM_name The FOM name of the parent object.
+    *  @param config_name  Input file name of this attribute for the diagnostics.
+    */
+   void initialize( std::string const &obj_FOM_name,
+                    std::string const &config_name );
+
+   /*! @brief Initializes the TrickHLA Attribute of an object instance from the
+    *  class level attribute, which holds the FOM name and configuration shared
+    *  by all the instances of the object class.
+    *  @param class_attr          The initialized class level attribute.
+    *  @param obj_FOM_name        The FOM name of the parent object.
+    *  @param config_name         Input file name of the class level attribute for the diagnostics.
+    *  @param instance_trick_name Trick name of the instance data for this attribute.
+    *  @param address             Address of the instance data for this attribute.
+    *  @param attr                Trick ATTRIBUTES type information shared by the class. */
+   void initialize_instance( Attribute const   *class_attr,
+                             std::string const &obj_FOM_name,
+                             std::string const &config_name,
+                             std::string const &instance_trick_name,
+                             void              *address,
+                             ATTRIBUTES        *attr );
+
    RTI1516_NAMESPACE::VariableLengthData &encode();
 
    bool decode( RTI1516_NAMESPACE::VariableLengthData const &encoded_data );
@@ -177,7 +206,7 @@ class Attribute : public RecordElement
     *  @return FOM name for the attribute. */
    std::string const &get_FOM_name() const
    {
-      return FOM_name;
+      return ( ( class_attribute != NULL ) ? class_attribute->FOM_name : FOM_name );
    }
 
    /*! @brief Determine if the attribute is published.
@@ -362,6 +391,15 @@ class Attribute : public RecordElement
       rti_encoding = in_type;
    }
 
+  protected:
+   /*! @brief Validate the names and configuration of the attribute.
+    *  @param obj_FOM_name The FOM name of the parent object.
+    *  @param config_name  Input file name of the attribute for the diagnostics. */
+   void validate( std::string const &obj_FOM_name,
+                  std::string const &config_name );
+
+   Attribute const *class_attribute; ///< @trick_io{**} Class level attribute holding the shared FOM name, or NULL if this attribute has its own.
+
   private:
    bool value_changed; ///< @trick_units{--} Flag to indicate the attribute value changed.
 
@@ -33,15 +33,14 @@ NASA, Johnson Space Center\n
 // Default: NO_TRICK_WSTRING_MM_SUPPORT
 #define NO_TRICK_WSTRING_MM_SUPPORT
 
-// Collect statistics on the wait times for the Time Advance Grant (TAG).
+// Collect statistics on the wait times for the Time Advance Grant (TAG) by
+// default. They can also be enabled at runtime with federate.TAG_wait_stats_enabled.
 // Default: NO_TRICKHLA_COLLECT_TAG_STATS
 #define NO_TRICKHLA_COLLECT_TAG_STATS
 
-// For blocking cyclic reads, do a check on the send and received data counts.
-// Default: NO_TRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS
-#define NO_TRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS
-
-// Measure the elapsed time between cyclic data reads.
+// Measure the elapsed time between cyclic data reads for all objects by
+// default. They can also be enabled at runtime per object with
+// elapsed_time_stats.enabled.
 // Default: NO_TRICKHLA_CYCLIC_READ_TIME_STATS
 #define NO_TRICKHLA_CYCLIC_READ_TIME_STATS
 
@@ -82,6 +82,9 @@ class DebugHandler
    static DebugLevelEnum  debug_level;  ///< @trick_units{--} Maximum debug report level requested by the user, default: THLA_NO_TRACE
    static DebugSourceEnum code_section; ///< @trick_units{--} Code section(s) for which to activate debug messages, default: THLA_ALL_MODULES
 
+   static int    queue_depth_warning; ///< @trick_units{count} Warn when a reflection, interaction or ownership queue holds more items than this, where zero disables the warning, default: 0
+   static double queue_age_warning;   ///< @trick_units{s} Warn when the oldest item of a reflection, interaction or ownership queue is older than this, where zero disables the warning, default: 0
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Default constructor for the TrickHLA DebugHandler class. */
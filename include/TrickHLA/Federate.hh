@@ -29,9 +29,12 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 @trick_link_dependency{../../source/TrickHLA/time/Int64Time.cpp}
 @trick_link_dependency{../../source/TrickHLA/time/TimeManagementServices.cpp}
+@trick_link_dependency{../../source/TrickHLA/time/TimeStragglerMonitor.cpp}
 @trick_link_dependency{../../source/TrickHLA/time/TrickThreadCoordinator.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/FrameProfiler.cpp}
 @trick_link_dependency{../../source/TrickHLA/utils/MutexLock.cpp}
 @trick_link_dependency{../../source/TrickHLA/utils/MutexProtection.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/StartupProfiler.cpp}
 
 @revs_title
 @revs_begin
@@ -64,7 +67,9 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/time/Int64Interval.hh"
 #include "TrickHLA/time/Int64Time.hh"
 #include "TrickHLA/time/TimeManagementServices.hh"
+#include "TrickHLA/time/TimeStragglerMonitor.hh"
 #include "TrickHLA/time/TrickThreadCoordinator.hh"
+#include "TrickHLA/utils/FrameProfiler.hh"
 #include "TrickHLA/utils/MutexLock.hh"
 #include "TrickHLA/utils/MutexProtection.hh"
 
@@ -151,6 +156,13 @@ class Federate : public TimeManagementServices, public SaveRestoreServices
 
    double wait_status_time; ///< @trick_units{s} How long to wait in a spin-lock in seconds before we print a status message.
 
+   bool        startup_profile;      ///< @trick_units{--} Enable recording of the startup phases as a Chrome trace, default: false
+   std::string startup_profile_file; ///< @trick_units{--} Startup trace file name, default: <federate name>_startup_trace.json
+
+   FrameProfiler frame_profiler; ///< @trick_units{--} Per-frame profiler of the THLABase.sm data cycle job chain.
+
+   TimeStragglerMonitor time_straggler_monitor; ///< @trick_units{--} Monitor of the federates holding back our time advancement.
+
    bool can_rejoin_federation; /**< @trick_units{--}
       Enables this federate to resign in a way to allow re-joining of the
       federation at a later time. */
@@ -451,6 +463,12 @@ class Federate : public TimeManagementServices, public SaveRestoreServices
       return MOM_HLAfederate_class_handle;
    }
 
+   /*! @brief Determine if the specified instance handle is a discovered MOM
+    *  HLAfederate instance.
+    *  @return True if ID is for a MOM HLAfederate instance; False otherwise.
+    *  @param instance_hndl Federate instance handle. */
+   bool is_MOM_HLAfederate_instance_id( RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_hndl );
+
    /*! @brief Set the Federates name given the instance ID as well as the
     * FederateHandle ID associated with the Federate instance.
     * @param id     Object instance handle.
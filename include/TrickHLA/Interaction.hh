@@ -29,6 +29,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/time/Int64Interval.cpp}
 @trick_link_dependency{../../source/TrickHLA/time/Int64Time.cpp}
 @trick_link_dependency{../../source/TrickHLA/utils/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/TrafficCounters.cpp}
 
 @revs_title
 @revs_begin
@@ -55,6 +56,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/time/Int64Time.hh"
 #include "TrickHLA/utils/MutexLock.hh"
+#include "TrickHLA/utils/TrafficCounters.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
 // to silence the warnings coming from the IEEE 1516 declared functions.
@@ -127,6 +129,10 @@ class Interaction
 
    //--------------------------------------------------------------------------
 
+   //------------------------- TRICK LOGGABLE OUTPUTS -------------------------
+  public:
+   TrafficCounters traffic; ///< @trick_units{--} Interactions, parameters and encoded bytes sent and received.
+
    //--------------------------------------------------------------------------
    // Public member functions.
    //--------------------------------------------------------------------------
@@ -343,9 +349,18 @@ class Interaction
       return preferred_order;
    }
 
+   /*! @brief Count a received interaction, which is called from the RTI
+    * callback thread.
+    *  @param param_values The received parameter values. */
+   void count_received( RTI1516_NAMESPACE::ParameterHandleValueMap const &param_values );
+
    MutexLock mutex; ///< @trick_io{**} Mutex to lock thread over critical code sections.
 
   private:
+   /*! @brief Count a sent interaction.
+    *  @param param_values The sent parameter values. */
+   void count_sent( RTI1516_NAMESPACE::ParameterHandleValueMap const &param_values );
+
    bool changed; ///< @trick_units{--} Flag indicating the data has changed.
 
    bool received_as_TSO; ///< @trick_units{--} True if received interaction as Timestamp order.
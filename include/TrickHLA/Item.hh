@@ -33,6 +33,9 @@ NASA, Johnson Space Center\n
 #ifndef TRICKHLA_ITEM_HH
 #define TRICKHLA_ITEM_HH
 
+// System includes.
+#include <cstdint>
+
 namespace TrickHLA
 {
 
@@ -51,6 +54,8 @@ class Item
   public:
    Item *next; ///< @trick_units{--} Next item in linked-list.
 
+   int64_t push_time; ///< @trick_units{--} Monotonic time in nanoseconds the item was pushed onto its queue.
+
    //-----------------------------------------------------------------
    // Constructors / destructors
    //-----------------------------------------------------------------
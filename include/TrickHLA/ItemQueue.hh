@@ -22,6 +22,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/Item.cpp}
 @trick_link_dependency{../../source/TrickHLA/ItemQueue.cpp}
 @trick_link_dependency{../../source/TrickHLA/utils/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/QueueStats.cpp}
 
 @revs_title
 @revs_begin
@@ -43,6 +44,7 @@ NASA, Johnson Space Center\n
 // TrickHLA includes.
 #include "TrickHLA/Item.hh"
 #include "TrickHLA/utils/MutexLock.hh"
+#include "TrickHLA/utils/QueueStats.hh"
 
 namespace TrickHLA
 {
@@ -91,6 +93,10 @@ class ItemQueue
     *  @param item Item to put into the queue. */
    void push( Item *item );
 
+   /*! @brief Set the statistics to track the depth and backlog of the queue.
+    *  @param queue_stats The statistics, or NULL to not track them. */
+   void set_stats( QueueStats *queue_stats );
+
    /*! @brief Prints the 'head' pointers for all elements in the queue.
     *  @param name Name of the caller. */
    void dump_linked_list( std::string const &name );
@@ -103,6 +109,8 @@ class ItemQueue
    Item *head; ///< @trick_units{--} First item in linked-list queue.
    Item *tail; ///< @trick_units{--} Last item in linked-list queue.
 
+   QueueStats *stats; ///< @trick_io{**} Depth and backlog statistics of the queue, or NULL if not tracked.
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for ItemQueue class.
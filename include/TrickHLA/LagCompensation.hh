@@ -20,6 +20,7 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{../../source/TrickHLA/LagCompensation.cpp}
+@trick_link_dependency{../../source/TrickHLA/LagCompensationBatch.cpp}
 @trick_link_dependency{../../source/TrickHLA/ObjectCallbackBase.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 
@@ -30,6 +31,7 @@ NASA, Johnson Space Center\n
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
 @rev_entry{Dan Dexter, NASA ER6, TrickHLA, October 2023, --, Added lag-comp bypass functions.}
 @rev_entry{Dan Dexter, NASA ER6, TrickHLA, September 2025, --, Extends ObjectCallbackBase.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Added batched lag compensation.}
 @revs_end
 
 */
@@ -46,6 +48,11 @@ NASA, Johnson Space Center\n
 namespace TrickHLA
 {
 
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class LagCompensationBatch;
+
 class LagCompensation : public ObjectCallbackBase
 {
    // Let the Trick input processor access protected and private data.
@@ -91,6 +98,38 @@ class LagCompensation : public ObjectCallbackBase
     * the sim-data otherwise you will be copying stale data. */
    virtual void bypass_receive_lag_compensation() = 0;
 
+   /*! @brief Receive side lag compensation callback for a frame in which no
+    * new data was received, which lets your implementation keep updating
+    * the sim-data between updates. The default does nothing. */
+   virtual void idle_receive_lag_compensation();
+
+   /*! @brief Set the batched lag compensation stage for this instance,
+    *  which must support the type of this instance.
+    *  @param lag_comp_batch Batched lag compensation stage, or NULL to
+    *  compensate this instance on its own. */
+   void set_batch( LagCompensationBatch *lag_comp_batch );
+
+   /*! @brief Get the batched lag compensation stage for this instance.
+    *  @return The batched lag compensation stage, or NULL if not batched. */
+   LagCompensationBatch *get_batch() const
+   {
+      return this->batch;
+   }
+
+   /*! @brief Determine if this instance is compensated as part of a batch.
+    *  @return True if this instance is compensated as part of a batch. */
+   bool is_batched() const
+   {
+      return ( this->batch != NULL );
+   }
+
+  protected:
+   LagCompensationBatch *batch; /**< @trick_units{--}
+      Optional batched lag compensation stage. When set, the Manager
+      compensates this instance along with all the other instances in the
+      same batch in one pass instead of one object at a time. NULL
+      (default) to compensate this instance on its own. */
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for LagCompensation class.
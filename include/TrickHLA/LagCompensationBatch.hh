@@ -0,0 +1,108 @@
+/*!
+@file TrickHLA/LagCompensationBatch.hh
+@ingroup TrickHLA
+@brief This class is the abstract base class for a TrickHLA batched lag
+compensation stage.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/LagCompensationBatch.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_LAG_COMPENSATION_BATCH_HH
+#define TRICKHLA_LAG_COMPENSATION_BATCH_HH
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class LagCompensation;
+
+class LagCompensationBatch
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__LagCompensationBatch();
+
+  public:
+   //-----------------------------------------------------------------
+   // Constructors / destructors
+   //-----------------------------------------------------------------
+   /*! @brief Default constructor for the TrickHLA LagCompensationBatch class. */
+   LagCompensationBatch();
+   /*! @brief Destructor for the TrickHLA LagCompensationBatch class. */
+   virtual ~LagCompensationBatch();
+
+   //-----------------------------------------------------------------
+   // These are virtual functions and must be defined by a full class.
+   //-----------------------------------------------------------------
+
+   /*! @brief Determine if the batch can compensate a lag compensation
+    * instance, which LagCompensation::set_batch() checks so an instance the
+    * batch would compensate differently than its own compensation is
+    * rejected up front.
+    *  @return True if the batch supports the lag compensation instance.
+    *  @param lag_comp Lag compensation instance. */
+   virtual bool is_supported( LagCompensation const *lag_comp ) const = 0;
+
+   /*! @brief Add a lag compensation instance to the batch of instances to
+    * compensate on the send side. The instance is not compensated until
+    * send_lag_compensation() is called for the batch.
+    *  @param lag_comp Lag compensation instance to add to the batch. */
+   virtual void add_send_lag_compensation( LagCompensation *lag_comp ) = 0;
+
+   /*! @brief Compensate all the send side instances added to the batch
+    * in one pass and then empty the batch. */
+   virtual void send_lag_compensation() = 0;
+
+   /*! @brief Add a lag compensation instance to the batch of instances to
+    * compensate on the receive side. The instance is not compensated until
+    * receive_lag_compensation() is called for the batch.
+    *  @param lag_comp Lag compensation instance to add to the batch. */
+   virtual void add_receive_lag_compensation( LagCompensation *lag_comp ) = 0;
+
+   /*! @brief Compensate all the receive side instances added to the batch
+    * in one pass and then empty the batch. */
+   virtual void receive_lag_compensation() = 0;
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for LagCompensationBatch class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   LagCompensationBatch( LagCompensationBatch const &rhs );
+   /*! @brief Assignment operator for LagCompensationBatch class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   LagCompensationBatch &operator=( LagCompensationBatch const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_LAG_COMPENSATION_BATCH_HH: Do NOT put anything after this line!
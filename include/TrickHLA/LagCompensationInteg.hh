@@ -4,6 +4,11 @@
 @brief This class is really just an interface class for TrickHLA lag
 compensation using integration.
 
+By default the compensation is integrated with a fixed step using the Trick
+integrator. An adaptive step mode can be enabled that integrates the state
+with an embedded Dormand-Prince 5(4) Runge-Kutta method, which picks its own
+step size to keep the local error estimate within the integration tolerance.
+
 @copyright Copyright 2019 United States Government as represented by the
 Administrator of the National Aeronautics and Space Administration.
 No copyright is claimed in the United States under Title 17, U.S. Code.
@@ -25,6 +30,7 @@ NASA, Johnson Space Center\n
 @revs_title
 @revs_begin
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, November 2023, --, Initial version.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Added adaptive step Dormand-Prince integration.}
 @revs_end
 
 */
@@ -34,6 +40,7 @@ NASA, Johnson Space Center\n
 
 // System includes.
 #include <stddef.h>
+#include <vector>
 
 // Trick includes.
 #include "trick/Integrator.hh"
@@ -63,9 +70,52 @@ class LagCompensationInteg : public LagCompensationIntegBase
    LagCompensationInteg();
    virtual ~LagCompensationInteg() = 0;
 
+   /*! @brief Enable or disable the adaptive step integration.
+    *  @details In adaptive step mode the integ_dt value is only the initial
+    *  step size guess and integ_tol is the local error tolerance.
+    *  @param adaptive True to use adaptive step integration. */
+   void set_adaptive_step( bool const adaptive )
+   {
+      adaptive_step = adaptive;
+   }
+
+   /*! @brief Set the smallest step size the adaptive integration will take.
+    *  @param dt_min Minimum integration step time. */
+   void set_integ_dt_min( double const dt_min )
+   {
+      integ_dt_min = dt_min;
+   }
+
+   /*! @brief Get the number of accepted steps in the last compensation.
+    *  @return Number of accepted integration steps. */
+   unsigned int get_step_count() const
+   {
+      return step_count;
+   }
+
+   /*! @brief Get the number of rejected steps in the last compensation.
+    *  @return Number of rejected adaptive integration steps. */
+   unsigned int get_rejected_step_count() const
+   {
+      return rejected_step_count;
+   }
+
   protected:
    Trick::Integrator *integrator; ///< @trick_units{--} Reference to a specific Trick integration method.
 
+   bool   adaptive_step; ///< @trick_units{--} True to use the adaptive step Dormand-Prince integration (default: false).
+   double integ_dt_min;  ///< @trick_units{s} Smallest adaptive integration step size (default: 1.0e-9).
+   double integ_dt_next; ///< @trick_units{s} Adaptive step size to start the next compensation with.
+
+   unsigned int  step_count;                ///< @trick_units{count} Accepted steps in the last compensation.
+   unsigned int  rejected_step_count;       ///< @trick_units{count} Rejected steps in the last compensation.
+   unsigned long step_count_total;          ///< @trick_units{count} Accepted steps in all compensations.
+   unsigned long rejected_step_count_total; ///< @trick_units{count} Rejected steps in all compensations.
+
+   std::vector< double > adapt_state;    ///< @trick_io{**} Adaptive step initial state.
+   std::vector< double > adapt_state_5;  ///< @trick_io{**} Adaptive step fifth order state.
+   std::vector< double > adapt_deriv[7]; ///< @trick_io{**} Adaptive step stage derivatives.
+
    /*! @brief Update the latency compensation time from the integrator. */
    virtual void update_time() = 0;
 
@@ -75,6 +125,12 @@ class LagCompensationInteg : public LagCompensationIntegBase
    /*! @brief Unload the integration state from the integrator. */
    virtual void unload() = 0;
 
+   /*! @brief Normalize the unloaded state after a completed integration step.
+    *  @details The adaptive integration unloads unnormalized intermediate
+    *  stage states to evaluate the derivatives, so any normalization of the
+    *  state (e.g. the attitude quaternion) belongs here and not in unload(). */
+   virtual void normalize_state() { return; }
+
    /*! @brief Compute the first time derivative of the lag compensation state vector.
     *  @param user_data Any special user data needed to compute the derivative values. */
    virtual void derivative_first( void *user_data = NULL ) = 0;
@@ -91,6 +147,28 @@ class LagCompensationInteg : public LagCompensationIntegBase
    virtual int integrate(
       double const t_begin,
       double const t_end );
+
+   /*! @brief Compensate the state data with the fixed step Trick integrator.
+    *  @param t_begin Scenario time at the start of the compensation step.
+    *  @param t_end   Scenario time at the end of the compensation step. */
+   int integrate_fixed_step(
+      double const t_begin,
+      double const t_end );
+
+   /*! @brief Compensate the state data with the adaptive step embedded
+    *  Dormand-Prince 5(4) Runge-Kutta method.
+    *  @param t_begin Scenario time at the start of the compensation step.
+    *  @param t_end   Scenario time at the end of the compensation step. */
+   int integrate_adaptive_step(
+      double const t_begin,
+      double const t_end );
+
+   /*! @brief Evaluate the state derivative for an adaptive step stage.
+    *  @param state Stage state vector.
+    *  @param deriv Computed derivative of the stage state vector. */
+   void adaptive_derivative(
+      std::vector< double > const &state,
+      std::vector< double >       &deriv );
 };
 
 } // namespace TrickHLA
@@ -27,10 +27,15 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/Interaction.cpp}
 @trick_link_dependency{../../source/TrickHLA/InteractionItem.cpp}
 @trick_link_dependency{../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{../../source/TrickHLA/ObjectPool.cpp}
+@trick_link_dependency{../../source/TrickHLA/TrafficRecorder.cpp}
+@trick_link_dependency{../../source/TrickHLA/TrafficReplay.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 @trick_link_dependency{../../source/TrickHLA/time/Int64Interval.cpp}
 @trick_link_dependency{../../source/TrickHLA/time/Int64Time.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/CountdownLatch.cpp}
 @trick_link_dependency{../../source/TrickHLA/utils/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/QueueStats.cpp}
 
 @revs_title
 @revs_begin
@@ -46,16 +51,24 @@ NASA, Johnson Space Center\n
 #define TRICKHLA_MANAGER_HH
 
 // System includes.
+#include <cstdint>
+#include <map>
 #include <string>
+#include <vector>
 
 // TrickHLA includes.
 #include "TrickHLA/ExecutionControlBase.hh"
 #include "TrickHLA/HLAStandardSupport.hh"
 #include "TrickHLA/ItemQueue.hh"
 #include "TrickHLA/Object.hh"
+#include "TrickHLA/ObjectPool.hh"
+#include "TrickHLA/TrafficRecorder.hh"
+#include "TrickHLA/TrafficReplay.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/time/Int64Interval.hh"
 #include "TrickHLA/time/Int64Time.hh"
+#include "TrickHLA/utils/QueueStats.hh"
+#include "TrickHLA/utils/CountdownLatch.hh"
 #include "TrickHLA/utils/MutexLock.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
@@ -98,6 +111,7 @@ namespace TrickHLA
 // helps to limit issues with recursive includes.
 class InteractionItem;
 class ExecutionConfigurationBase;
+class LagCompensationBatch;
 
 class Manager : public CheckpointConversionBase
 {
@@ -120,9 +134,21 @@ class Manager : public CheckpointConversionBase
    int     obj_count; ///< @trick_units{--} Number of TrickHLA Objects.
    Object *objects;   ///< @trick_units{--} Array of TrickHLA object.
 
+   int         pool_count;   ///< @trick_units{--} Number of TrickHLA Object pools.
+   ObjectPool *object_pools; ///< @trick_units{--} Array of TrickHLA Object pools for the instances created and removed at runtime.
+
    int          inter_count;  ///< @trick_units{--} Number of TrickHLA Interactions.
    Interaction *interactions; ///< @trick_units{--} Array of TrickHLA Interactions.
 
+   int traffic_report_count; ///< @trick_units{count} Number of top objects, attributes and interactions in each list of the traffic report, where zero disables the report (default: 10).
+
+   TrafficRecorder traffic_recorder; ///< @trick_units{--} Records the received federation traffic to a binary log when its file_name is set.
+   TrafficReplay   traffic_replay;   ///< @trick_units{--} Replays a recorded binary traffic log through the receive side when its file_name is set.
+
+   //------------------------- TRICK LOGGABLE OUTPUTS -------------------------
+  public:
+   QueueStats interactions_queue_stats; ///< @trick_units{--} Depth and backlog statistics of the received interactions queue.
+
   public:
    //
    // Public constructors and destructor.
@@ -281,6 +307,10 @@ class Manager : public CheckpointConversionBase
    /*! @brief Process the ownership requests. */
    void process_ownership();
 
+   /*! @brief Refresh the statistics of the received interactions queue and
+    * the object queues, and publish any pending queue backlog warnings. */
+   void refresh_queue_stats();
+
    /*! @brief Identifies the object as deleted from the RTI.
     *  @param instance_id HLA object instance handle. */
    void mark_object_as_deleted_from_federation(
@@ -290,6 +320,11 @@ class Manager : public CheckpointConversionBase
     * were deleted from the RTI. */
    void process_deleted_objects();
 
+   /*! @brief Report the objects, attributes and interactions that sent and
+    * received the most encoded bytes, as a separate list of each limited to
+    * traffic_report_count. */
+   void report_traffic();
+
    /*! @brief Publishes Object & Interaction classes and their member data. */
    void publish();
 
@@ -307,7 +342,8 @@ class Manager : public CheckpointConversionBase
    void publish_and_subscribe();
 
    /*! @brief Reserve the RTI object instance names with the RTI, but only for
-    * the objects that are locally owned. */
+    * the objects that are locally owned, using a single request for all the
+    * names. */
    void reserve_object_names_with_RTI();
 
    /*! @brief Waits for the reservation of the RTI object instance names for the
@@ -322,11 +358,13 @@ class Manager : public CheckpointConversionBase
    bool is_this_a_rejoining_federate();
 
    /*! @brief Creates an RTI object instance and registers it with the RTI,
-    * but only for the objects that are locally owned. */
+    * but only for the objects that are locally owned. All the registrations
+    * are issued back to back. */
    void register_objects_with_RTI();
 
    /* @brief Waits for the registration of all the required RTI object
-    * instances with the RTI. */
+    * instances with the RTI. The wait is woken by the registration and
+    * discovery callbacks once all the required objects are ready. */
    void wait_for_registration_of_required_objects();
 
    /*! @brief Sets the RTI run-time type IDs/handles for the object, attributes,
@@ -346,6 +384,18 @@ class Manager : public CheckpointConversionBase
    void setup_interaction_RTI_handles( int const    interactions_counter,
                                        Interaction *in_interactions );
 
+   /*! @brief Sets the RTI run-time type IDs/handles for the object pool
+    * classes and template attributes, and allocate the initial slots. */
+   void setup_object_pool_RTI_handles();
+
+   /*! @brief Clear the cached RTI class, attribute and parameter handles. */
+   void clear_RTI_handle_cache();
+
+   /*! @brief Build the class handle and instance name index and the per
+    * class free lists of remote objects used to bind discovered object
+    * instances. Must be called after the object class handles are set. */
+   void build_object_discovery_index();
+
    /*! @brief Set up the Trick ref-attributes for the user specified objects,
     * attributes, interactions, and parameters. */
    void setup_all_ref_attributes();
@@ -375,6 +425,16 @@ class Manager : public CheckpointConversionBase
       return objects;
    }
 
+   /*! @brief Get the object pool for the specified object class.
+    *  @return The object pool, or NULL if there is no pool for the class.
+    *  @param class_handle RTI Object class handle. */
+   ObjectPool *get_object_pool( RTI1516_NAMESPACE::ObjectClassHandle const &class_handle );
+
+   /*! @brief Get the object pool for the specified object class FOM name.
+    *  @return The object pool, or NULL if there is no pool for the class.
+    *  @param class_FOM_name Object class FOM name. */
+   ObjectPool *get_object_pool( std::string const &class_FOM_name );
+
    /*! @brief Get the number of TrickHLA::Interactions.
     *  @return The number of TrickHLA::Interaction instances. */
    int get_interaction_count() const
@@ -541,6 +601,86 @@ class Manager : public CheckpointConversionBase
    /*! @brief Echoes the contents of checkpoint InteractionItem linear array. */
    void print_converted_interactions_checkpoint();
 
+   /*! @brief Add the object to the free list of its class if it is a
+    * nameless remote object that can be bound to any discovered instance.
+    *  @param index Object array index. */
+   void add_unbound_remote_object( int const index );
+
+   /*! @brief Set the instance handle and name of a discovered object and add
+    * it to the object map. The obj_discovery_mutex must be locked by the caller.
+    *  @param obj           The object bound to the discovered instance.
+    *  @param instance_hndl The discovered object instance handle.
+    *  @param instance_name The discovered object instance name. */
+   void bind_discovered_object( Object                                        *obj,
+                                RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_hndl,
+                                std::wstring const                            &instance_name );
+
+   /*! @brief Grow the object pool from the main thread and bind the
+    * discoveries that were waiting for a free slot.
+    *  @param pool The object pool. */
+   void bind_pending_pool_discoveries( ObjectPool &pool );
+
+   /*! @brief Record the time the instance handle of the object became valid
+    * and count down the pending required objects. The obj_discovery_mutex
+    * must be locked by the caller.
+    *  @param obj The object whose instance handle became valid. */
+   void set_object_ready( Object const *obj );
+
+   /*! @brief Print the time it took for each of the slowest required objects
+    * to be registered or discovered.
+    *  @param caller Name of the calling function for the message. */
+   void print_object_straggler_times( char const *caller );
+
+   /*! @brief Declare the publication or subscription of the object class
+    * attributes with one RTI call per object class, using the attributes
+    * merged over all the objects and object pools of the class.
+    *  @param publish True to publish the attributes, false to subscribe. */
+   void declare_object_class_attributes( bool const publish );
+
+   /*! @brief Get the object class handle for the FOM name, only asking the
+    * RTI for it the first time the class is seen.
+    *  @return Object class handle.
+    *  @param rti_amb        RTI ambassador.
+    *  @param class_FOM_name Object class FOM name. */
+   RTI1516_NAMESPACE::ObjectClassHandle get_cached_object_class_handle(
+      RTI1516_NAMESPACE::RTIambassador *rti_amb,
+      std::string const                &class_FOM_name );
+
+   /*! @brief Get the attribute handle for the FOM names, only asking the RTI
+    * for it the first time the attribute of the class is seen.
+    *  @return Attribute handle.
+    *  @param rti_amb        RTI ambassador.
+    *  @param class_FOM_name Object class FOM name.
+    *  @param class_handle   Object class handle.
+    *  @param attr_FOM_name  Attribute FOM name. */
+   RTI1516_NAMESPACE::AttributeHandle get_cached_attribute_handle(
+      RTI1516_NAMESPACE::RTIambassador           *rti_amb,
+      std::string const                          &class_FOM_name,
+      RTI1516_NAMESPACE::ObjectClassHandle const &class_handle,
+      std::string const                          &attr_FOM_name );
+
+   /*! @brief Get the interaction class handle for the FOM name, only asking
+    * the RTI for it the first time the class is seen.
+    *  @return Interaction class handle.
+    *  @param rti_amb        RTI ambassador.
+    *  @param class_FOM_name Interaction class FOM name. */
+   RTI1516_NAMESPACE::InteractionClassHandle get_cached_interaction_class_handle(
+      RTI1516_NAMESPACE::RTIambassador *rti_amb,
+      std::string const                &class_FOM_name );
+
+   /*! @brief Get the parameter handle for the FOM names, only asking the RTI
+    * for it the first time the parameter of the class is seen.
+    *  @return Parameter handle.
+    *  @param rti_amb        RTI ambassador.
+    *  @param class_FOM_name Interaction class FOM name.
+    *  @param class_handle   Interaction class handle.
+    *  @param param_FOM_name Parameter FOM name. */
+   RTI1516_NAMESPACE::ParameterHandle get_cached_parameter_handle(
+      RTI1516_NAMESPACE::RTIambassador                *rti_amb,
+      std::string const                               &class_FOM_name,
+      RTI1516_NAMESPACE::InteractionClassHandle const &class_handle,
+      std::string const                               &param_FOM_name );
+
    //
    // Private data.
    //
@@ -556,10 +696,29 @@ class Manager : public CheckpointConversionBase
 
    MutexLock obj_discovery_mutex; ///< @trick_io{**} Mutex to lock thread over critical code sections.
 
+   CountdownLatch name_reservation_latch; ///< @trick_io{**} Pending object instance name reservations.
+
+   CountdownLatch required_objects_latch; ///< @trick_io{**} Pending required object instance registrations or discoveries.
+
+   int64_t                             obj_pipeline_start_time; ///< @trick_io{**} Wall clock time in microseconds the object registration started.
+   std::map< Object const *, int64_t > obj_ready_times;         ///< @trick_io{**} Wall clock time in microseconds each object instance handle became valid.
+
    ObjectInstanceMap object_map; ///< @trick_io{**} Map of all the Objects this federate uses, the Key is the object instance-handle.
 
    TrickHLAObjInstanceNameIndexMap obj_name_index_map; ///< @trick_io{**} Map of object instance names to array index.
 
+   ObjectClassInstanceNameMap obj_class_name_index; ///< @trick_io{**} Objects by class handle and instance name, used to bind discovered instances.
+   ObjectClassIndexSetMap     unbound_remote_objs;  ///< @trick_io{**} Per class free list of the array indexes of nameless remote objects not yet bound to an instance.
+
+   std::map< RTI1516_NAMESPACE::ObjectClassHandle, ObjectPool * > obj_pool_class_map; ///< @trick_io{**} Object pools keyed by the object class handle.
+
+   TrickHLAObjClassHandleNameMap                          obj_class_handle_cache;   ///< @trick_io{**} Object class handles keyed by the class FOM name.
+   std::map< std::string, TrickHLAAttributeHandleNameMap > attr_handle_cache;        ///< @trick_io{**} Attribute handles keyed by the class FOM name and then the attribute FOM name.
+   TrickHLAInterClassHandleNameMap                        inter_class_handle_cache; ///< @trick_io{**} Interaction class handles keyed by the class FOM name.
+   std::map< std::string, TrickHLAParameterHandleNameMap > param_handle_cache;       ///< @trick_io{**} Parameter handles keyed by the class FOM name and then the parameter FOM name.
+
+   std::vector< LagCompensationBatch * > lag_comp_batches; ///< @trick_io{**} Unique batched lag compensation stages used by the objects.
+
    Federate *federate; ///< @trick_units{--} Associated TrickHLA Federate.
 
    ExecutionControlBase *execution_control; /**< @trick_units{--}
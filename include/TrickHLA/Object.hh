@@ -35,6 +35,9 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/utils/ElapsedTimeStats.cpp}
 @trick_link_dependency{../../source/TrickHLA/utils/MutexLock.cpp}
 @trick_link_dependency{../../source/TrickHLA/utils/MutexProtection.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/QueueStats.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/TrafficCounters.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/UpdateLatencyStats.cpp}
 
 @revs_title
 @revs_begin
@@ -50,7 +53,9 @@ NASA, Johnson Space Center\n
 
 // System includes.
 #include <map>
+#include <set>
 #include <string>
+#include <utility>
 
 // TrickHLA includes.
 #include "TrickHLA/Attribute.hh"
@@ -65,7 +70,10 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/utils/ElapsedTimeStats.hh"
 #include "TrickHLA/utils/MutexLock.hh"
 #include "TrickHLA/utils/MutexProtection.hh"
+#include "TrickHLA/utils/QueueStats.hh"
 #include "TrickHLA/utils/StringUtilities.hh"
+#include "TrickHLA/utils/TrafficCounters.hh"
+#include "TrickHLA/utils/UpdateLatencyStats.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
 // to silence the warnings coming from the IEEE 1516 declared functions.
@@ -79,6 +87,7 @@ NASA, Johnson Space Center\n
 #include "RTI/Handle.h"
 #include "RTI/RTI1516.h"
 #include "RTI/Typedefs.h"
+#include "RTI/VariableLengthData.h"
 
 #if defined( IEEE_1516_2010 )
 #   pragma GCC diagnostic pop
@@ -222,6 +231,10 @@ class Object : public CheckpointConversionBase
     * the delete action by calling the users delete notification callback. */
    void process_deleted_object();
 
+   /*! @brief Reset the state left over from a removed object instance so that
+    * this object can be bound to a new object instance. */
+   void reset_removed_object_instance();
+
    //-----------------------------------------------------------------
    // I/O with remote federates.
    // If we own the data, then we can send it out to other federates.
@@ -253,6 +266,10 @@ class Object : public CheckpointConversionBase
     *  @param update_time The time to HLA Logical Time to update the attributes to. */
    void send_cyclic_and_requested_data( Int64Time const &update_time );
 
+   /*! @brief Send the cyclic and requested attribute value updates that were
+    * deferred until the batched send side lag compensation was done. */
+   void send_batched_cyclic_and_requested_data();
+
    /*! @brief Send the zero-lookahead attribute value updates.
     *  @param update_time The time to HLA Logical Time to update the attributes to. */
    void send_zero_lookahead_and_requested_data( Int64Time const &update_time );
@@ -269,6 +286,14 @@ class Object : public CheckpointConversionBase
    /*! @brief Handle the received cyclic data. */
    void receive_cyclic_data();
 
+   /*! @brief Mark the data as unchanged for an object that was waiting on
+    * the batched receive side lag compensation. */
+   void end_batched_receive();
+
+   /*! @brief Refresh the statistics of the reflected attributes and
+    * ownership request queues so they keep updating while a queue is idle. */
+   void refresh_queue_stats();
+
    /*! @brief Handle the received zero-lookaehad data. */
    void receive_zero_lookahead_data();
 
@@ -283,8 +308,10 @@ class Object : public CheckpointConversionBase
    void provide_attribute_update( RTI1516_NAMESPACE::AttributeHandleSet const &theAttributes );
 
    /*! @brief Enqueue the reflected attributes.
-    *  @param theAttributes Attributes data. */
-   void enqueue_data( RTI1516_NAMESPACE::AttributeHandleValueMap const &theAttributes );
+    *  @param theAttributes     Attributes data.
+    *  @param user_supplied_tag User supplied tag of the attribute update. */
+   void enqueue_data( RTI1516_NAMESPACE::AttributeHandleValueMap const &theAttributes,
+                      RTI1516_NAMESPACE::VariableLengthData const     &user_supplied_tag = TrickHLA::EMPTY_USER_SUPPLIED_TAG );
 
    /*! @brief This function decoded the received encoded attributes.
     *  @param theAttributes Attributes data.
@@ -618,10 +645,24 @@ class Object : public CheckpointConversionBase
          // The 'changed' flag is set when the data is decoded.
          decode( reflected_attributes_queue.front() );
          reflected_attributes_queue.pop();
+         if ( update_latency.is_enabled() ) {
+            update_latency.decoded();
+         }
       }
       return changed;
    }
 
+   /*! @brief Determine if there are more reflected attribute updates queued
+    * for the object that have not been decoded yet.
+    *  @return True if there are queued reflected attribute updates. */
+   bool any_queued_reflected_attributes()
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &receive_mutex );
+      return !reflected_attributes_queue.empty();
+   }
+
    /*! @brief Mark the data as changed, and notify any waiting thread that
     * there is a change. */
    void mark_changed();
@@ -753,6 +794,10 @@ class Object : public CheckpointConversionBase
 
    bool first_blocking_cyclic_read; ///< @trick_units{--} True if this is the first call to receive_cyclic_data for data to be received.
 
+   bool      batched_send_pending;     ///< @trick_units{--} True if a cyclic send is waiting on the batched send side lag compensation.
+   Int64Time batched_send_update_time; ///< @trick_io{**} HLA Logical Time of the cyclic send waiting on the batched lag compensation.
+   bool      batched_receive_pending;  ///< @trick_units{--} True if the received data is waiting on the batched receive side lag compensation.
+
    bool any_attribute_FOM_specified_order; ///< @trick_units{--} True if any attribute is the FOM specified order.
    bool any_attribute_timestamp_order;     ///< @trick_units{--} True if any attribute is timestamp order.
 
@@ -774,18 +819,37 @@ class Object : public CheckpointConversionBase
    RTI1516_NAMESPACE::ObjectInstanceHandle instance_handle; ///< @trick_io{**} HLA Object Instance handle.
 
   public:
-#ifdef TRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS
-   uint64_t send_count;    ///< @trick_units{--} Number of times data from this object was sent.
-   uint64_t receive_count; ///< @trick_units{--} Number of times data for this object was received.
-#endif
+   TrafficCounters traffic; ///< @trick_units{--} Updates, attributes and encoded bytes sent and received for this object.
+
+   QueueStats reflected_queue_stats; ///< @trick_units{--} Depth and backlog statistics of the reflected attributes queue.
+
+   ElapsedTimeStats elapsed_time_stats; ///< @trick_units{--} Statistics of elapsed times between cyclic data reads, measured if elapsed_time_stats.enabled is set.
 
-   ElapsedTimeStats elapsed_time_stats; ///< @trick_units{--} Statistics of elapsed times between cyclic data reads.
+   UpdateLatencyStats update_latency; ///< @trick_units{--} End-to-end latency of the cyclic attribute updates, measured if update_latency.enabled is set.
 
   private:
+   /*! @brief Count the attribute values sent for this object and for each
+    * of the attributes. */
+   void count_sent_attribute_values();
+
+   /*! @brief Get the user supplied tag for a cyclic attribute update, which
+    * holds the latency header if update_latency.enabled is set.
+    *  @return The user supplied tag. */
+   RTI1516_NAMESPACE::VariableLengthData const get_update_user_supplied_tag();
+
+   /*! @brief Lag compensate, pack and send the cyclic and requested
+    * attribute value updates.
+    *  @param update_time The time to HLA Logical Time to update the attributes to. */
+   void pack_and_send_cyclic_and_requested_data( Int64Time const &update_time );
+
    /*! @brief Sets the new value of the name attribute.
     *  @param new_name New name for the object instance. */
    void set_name( std::string const &new_name );
 
+   /*! @brief Name the reflected attribute and ownership queue statistics
+    * after the object, for the queue warnings. */
+   void set_queue_stats_names();
+
    /*! @brief Set the name of the object and mark it as changed.
     *  @param new_name The new name of the object. */
    void set_name_and_mark_changed( std::string const &new_name )
@@ -807,6 +871,13 @@ class Object : public CheckpointConversionBase
 // The Key is the object instance handle.
 typedef std::map< RTI1516_NAMESPACE::ObjectInstanceHandle, Object * > ObjectInstanceMap; ///< trick_io{**} Map of TrickHLA objects.
 
+// The Key is the object class handle and object instance name.
+typedef std::map< std::pair< RTI1516_NAMESPACE::ObjectClassHandle, std::wstring >, Object * > ObjectClassInstanceNameMap; ///< trick_io{**} Map of TrickHLA objects by class and instance name.
+
+// The Key is the object class handle and the value is the set of object array
+// indexes, in ascending order.
+typedef std::map< RTI1516_NAMESPACE::ObjectClassHandle, std::set< int > > ObjectClassIndexSetMap; ///< trick_io{**} Map of TrickHLA object array indexes by class.
+
 typedef struct {
    Object                                *trick_hla_obj; ///< trick_io{**} Pointer to TrickHLA object.
    RTI1516_NAMESPACE::AttributeHandleSet *handle_set;    ///< trick_io{**} Pointer to attribute handle set to divest ownership of.
@@ -0,0 +1,354 @@
+/*!
+@file TrickHLA/ObjectPool.hh
+@ingroup TrickHLA
+@brief This class is a growable pool of TrickHLA Objects for the instances of
+a FOM object class that come and go at runtime.
+
+Instead of declaring a worst-case array of objects in the input file, the
+attribute configuration of the FOM object class is described once in the pool
+as a template. The attribute Trick names are relative to the simulation data
+type of an instance. When an instance of the class is discovered, or created
+locally, the pool binds it to a free pooled Object slot along with its own
+Trick allocated simulation data. The slot is returned to the pool when the
+instance is removed from the federation, so memory grows with the number of
+live instances instead of with a worst-case array.
+
+The pool only grows from a main thread job, which keeps min_free_slots free
+slots allocated ahead of the discoveries. The discover object instance
+callback only claims a free slot. If there is none, the discovery is kept
+pending until the main thread job has grown the pool, and any reflections of
+the instance received before then are dropped. The instance_added() and
+instance_deleted() callbacks are always called from the main thread.
+
+The pooled objects do not support packing, lag compensation, ownership
+transfer, or checkpoint and restore. A checkpoint with live pooled instances
+is rejected.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/ObjectPool.cpp}
+@trick_link_dependency{../../source/TrickHLA/Attribute.cpp}
+@trick_link_dependency{../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{../../source/TrickHLA/time/Int64Time.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/MutexProtection.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_OBJECT_POOL_HH
+#define TRICKHLA_OBJECT_POOL_HH
+
+// System includes.
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Trick includes.
+#include "trick/attributes.h"
+
+// TrickHLA includes.
+#include "TrickHLA/Attribute.hh"
+#include "TrickHLA/HLAStandardSupport.hh"
+#include "TrickHLA/time/Int64Time.hh"
+#include "TrickHLA/utils/MutexLock.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wdeprecated"
+#endif
+
+// HLA include files.
+#include "RTI/Handle.h"
+
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic pop
+#endif
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class Manager;
+class Object;
+
+class ObjectPool
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__ObjectPool();
+
+   //----------------------------- USER VARIABLES -----------------------------
+   // The variables below this point are configured by the user in either the
+   // input or modified-data files.
+  public:
+   std::string FOM_name; ///< @trick_units{--} FOM name for the object class of the pooled instances.
+
+   std::string data_type; ///< @trick_units{--} Trick type name of the simulation data allocated for each pooled instance.
+
+   int        attr_count; ///< @trick_units{--} Number of template attributes.
+   Attribute *attributes; ///< @trick_units{--} Array of template attributes, with the Trick names relative to the simulation data of an instance.
+
+   int initial_capacity; ///< @trick_units{count} Number of pooled slots to allocate at initialization, at least one.
+   int min_free_slots;   ///< @trick_units{count} Number of free pooled slots the main thread keeps allocated for the discoveries, at least one.
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA ObjectPool class. */
+   ObjectPool();
+   /*! @brief Destructor for the TrickHLA ObjectPool class. */
+   virtual ~ObjectPool();
+
+   /*! @brief Initializes the TrickHLA ObjectPool by validating the template.
+    *  @param trickhla_mgr The TrickHLA::Manager instance.
+    *  @param index        Array index of this pool in the manager. */
+   void initialize( Manager *trickhla_mgr, int const index );
+
+   /*! @brief Allocate the initial pooled slots, which must be done after the
+    * RTI class and template attribute handles have been set. */
+   void allocate_initial_slots();
+
+   /*! @brief Get the FOM name for the object class of the pooled instances.
+    *  @return The object class FOM name. */
+   std::string const &get_FOM_name() const
+   {
+      return FOM_name;
+   }
+
+   /*! @brief Get the HLA Object class handle for the pooled instances.
+    *  @return The HLA ObjectClassHandle for the pooled instances. */
+   RTI1516_NAMESPACE::ObjectClassHandle get_class_handle() const
+   {
+      return class_handle;
+   }
+
+   /*! @brief Set the HLA Object class handle for the pooled instances.
+    *  @param id The HLA ObjectClassHandle for the pooled instances. */
+   void set_class_handle( RTI1516_NAMESPACE::ObjectClassHandle const &id )
+   {
+      this->class_handle = id;
+   }
+
+   /*! @brief Get the number of template attributes.
+    *  @return The number of template attributes. */
+   int get_attribute_count() const
+   {
+      return attr_count;
+   }
+
+   /*! @brief Get the template attributes.
+    *  @return The array of template attributes. */
+   Attribute *get_attributes()
+   {
+      return attributes;
+   }
+
+   /*! @brief Sets the core job cycle time used by the multi-rate attributes.
+    *  @param cycle_time The core job cycle time in seconds. */
+   void set_core_job_cycle_time( double const cycle_time );
+
+   /*! @brief Publishes the object class attributes of the pooled instances. */
+   void publish_object_attributes();
+
+   /*! @brief Unpublishes the object class attributes of the pooled instances. */
+   void unpublish_all_object_attributes();
+
+   /*! @brief Subscribe to the object class attributes of the pooled instances. */
+   void subscribe_to_object_attributes();
+
+   /*! @brief Unsubscribe from the object class attributes of the pooled instances. */
+   void unsubscribe_all_object_attributes();
+
+   /*! @brief Take a free slot for a discovered remotely owned instance, or
+    * keep the discovery pending if there is no free slot. The caller holds
+    * the Manager object discovery mutex and sets the instance handle and name.
+    *  @return The pooled TrickHLA::Object for the discovered instance, or
+    *  NULL if the discovery is pending.
+    *  @param instance_hndl The discovered object instance handle.
+    *  @param instance_name The discovered object instance name. */
+   Object *bind_discovered_instance( RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_hndl,
+                                     std::wstring const                         &instance_name );
+
+   /*! @brief Take a free slot for the oldest pending discovery. The caller
+    * holds the Manager object discovery mutex and sets the instance handle
+    * and name.
+    *  @return The pooled TrickHLA::Object for the discovered instance, or
+    *  NULL if there is no pending discovery or no free slot.
+    *  @param instance_hndl Set to the discovered object instance handle.
+    *  @param instance_name Set to the discovered object instance name. */
+   Object *bind_pending_discovery( RTI1516_NAMESPACE::ObjectInstanceHandle &instance_hndl,
+                                   std::wstring                            &instance_name );
+
+   /*! @brief Drop a pending discovery for an instance removed from the
+    * federation before it was bound to a slot. The caller holds the Manager
+    * object discovery mutex.
+    *  @return True if the discovery was pending.
+    *  @param instance_hndl The removed object instance handle. */
+   bool remove_pending_discovery( RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_hndl );
+
+   /*! @brief Grow the pool from the main thread so there is a free slot for
+    * each pending discovery plus min_free_slots more. */
+   void grow_free_slots();
+
+   /*! @brief Call instance_added() from the main thread for the discovered
+    * instances bound to a slot since the last call. */
+   void process_added_instances();
+
+   /*! @brief Take a free slot, growing the pool if needed, for a locally
+    * owned instance and register it with the RTI using an RTI assigned name.
+    *  @return The pooled TrickHLA::Object for the registered instance. */
+   Object *create_local_instance();
+
+   /*! @brief Delete a locally owned pooled instance from the federation. The
+    * slot is recycled by process_deleted_objects().
+    *  @param obj The pooled TrickHLA::Object to delete. */
+   void delete_local_instance( Object *obj );
+
+   /*! @brief Send the cyclic and requested attribute value updates for the
+    * live pooled instances.
+    *  @param update_time The time to HLA Logical Time to update the attributes to. */
+   void send_cyclic_and_requested_data( Int64Time const &update_time );
+
+   /*! @brief Handle the received cyclic data for the live pooled instances. */
+   void receive_cyclic_data();
+
+   /*! @brief Refresh the queue statistics of the live pooled instances. */
+   void refresh_queue_stats();
+
+   /*! @brief Process the pooled instances deleted from the federation and
+    * return their slots to the pool. */
+   void process_deleted_objects();
+
+   /*! @brief Determine if the object is a pooled object of this pool.
+    *  @return True if the object belongs to this pool.
+    *  @param obj The TrickHLA::Object to check. */
+   bool is_pooled_object( Object const *obj );
+
+   /*! @brief Get the number of live pooled instances.
+    *  @return The number of live pooled instances. */
+   unsigned int get_live_count();
+
+   /*! @brief Get the number of allocated pooled slots.
+    *  @return The number of allocated pooled slots. */
+   unsigned int get_slot_count();
+
+   /*! @brief Get the number of discoveries waiting for a free slot.
+    *  @return The number of pending discoveries. */
+   unsigned int get_pending_count();
+
+   /*! @brief Get a live pooled instance.
+    *  @return The pooled TrickHLA::Object, or NULL if the index is out of range.
+    *  @param index Index of the live instance, from 0 to get_live_count()-1. */
+   Object *get_live_object( unsigned int const index );
+
+   /*! @brief Get the simulation data of a pooled instance.
+    *  @return Pointer to the simulation data, or NULL if the object is not pooled.
+    *  @param obj The pooled TrickHLA::Object. */
+   void *get_instance_data( Object const *obj );
+
+  protected:
+   /*! @brief Callback from the main thread when a slot is bound to a new
+    * discovered or locally created instance, which can be overridden to
+    * initialize the data.
+    *  @param obj  The pooled TrickHLA::Object.
+    *  @param data The simulation data of the instance. */
+   virtual void instance_added( Object *obj, void *data );
+
+   /*! @brief Callback when an instance has been deleted from the federation
+    * before its slot is returned to the pool.
+    *  @param obj  The pooled TrickHLA::Object.
+    *  @param data The simulation data of the instance. */
+   virtual void instance_deleted( Object *obj, void *data );
+
+   /*! @brief Take a free slot and bind it for a remotely or locally owned
+    * instance. There must be a free slot and the pool_mutex must be locked
+    * by the caller.
+    *  @return Index of the slot.
+    *  @param local True for a locally owned instance. */
+   std::size_t acquire_slot( bool const local );
+
+   /*! @brief Allocate a new free slot with its simulation data and Object,
+    * which is only done from the main thread. */
+   void allocate_slot();
+
+   /*! @brief Copy the objects bound to live instances, so the data cycle
+    * jobs can work on them without holding the pool mutex. */
+   void copy_live_objects();
+
+   /*! @brief Resolve the Trick type information and data offset of each
+    * template attribute once for the object class, using the data of the
+    * first slot.
+    *  @param data     The simulation data of the first slot.
+    *  @param var_name The Trick variable name of the simulation data. */
+   void resolve_class_metadata( void *data, std::string const &var_name );
+
+   Manager *manager;    ///< @trick_units{--} Associated TrickHLA Manager.
+   int      pool_index; ///< @trick_units{--} Array index of this pool in the manager.
+
+   double core_job_cycle_time; ///< @trick_units{s} Core job cycle time used by the multi-rate attributes.
+
+   RTI1516_NAMESPACE::ObjectClassHandle class_handle; ///< @trick_io{**} HLA Object Class handle of the pooled instances.
+
+   std::vector< Object * >                 slots;          ///< @trick_io{**} Pooled objects, one per slot.
+   std::vector< void * >                   slot_data;      ///< @trick_io{**} Simulation data of each slot.
+   std::vector< std::size_t >              free_slots;     ///< @trick_io{**} Stack of the free slot indexes.
+   std::vector< std::size_t >              live_slots;     ///< @trick_io{**} Indexes of the slots bound to live instances.
+   std::vector< std::size_t >              added_slots;    ///< @trick_io{**} Indexes of the slots bound to discovered instances not yet passed to instance_added().
+   std::vector< Object * >                 live_objects;   ///< @trick_io{**} Copy of the live objects the data cycle jobs work on.
+   std::map< Object const *, std::size_t > slot_index_map; ///< @trick_io{**} Slot index of each pooled object.
+
+   std::deque< std::pair< RTI1516_NAMESPACE::ObjectInstanceHandle, std::wstring > > pending_discoveries; ///< @trick_io{**} Discovered instances waiting for a free slot.
+
+   std::vector< ATTRIBUTES * >   attr_types;   ///< @trick_io{**} Trick type information of each template attribute, or NULL if it must be resolved per instance.
+   std::vector< std::ptrdiff_t > attr_offsets; ///< @trick_io{**} Offset of each template attribute from the start of the simulation data.
+
+   MutexLock pool_mutex; ///< @trick_io{**} Mutex to lock the slots, which are bound by the RTI callbacks.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for ObjectPool class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   ObjectPool( ObjectPool const &rhs );
+   /*! @brief Assignment operator for ObjectPool class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   ObjectPool &operator=( ObjectPool const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_OBJECT_POOL_HH: Do NOT put anything after this line!
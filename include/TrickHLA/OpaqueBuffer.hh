@@ -29,6 +29,7 @@ NASA, Johnson Space Center\n
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, July 2009, --, Initial implementation.}
 @rev_entry{Dan Dexter, NASA ER7, TrickHLA, March 2019, --, Version 2 origin.}
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, June 2019, --, Version 3 rewrite.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Added HLAfloat64LE array push and pull.}
 @revs_end
 
 */
@@ -84,6 +85,14 @@ class OpaqueBuffer
       return capacity;
    }
 
+   /*! @brief Get the size of the data that can be pulled from the buffer,
+    *  which is set when the pull position is reset.
+    *  @return Size of the data in bytes. */
+   std::size_t get_data_size() const
+   {
+      return data_size;
+   }
+
    /*! @brief Ensure the buffer has at least the specified capacity.
     *  @param size Requested buffer capacity. */
    void ensure_buffer_capacity( std::size_t const size );
@@ -94,11 +103,9 @@ class OpaqueBuffer
       this->push_pos = 0;
    }
 
-   /*! @brief Reset the pull buffer position. */
-   void reset_pull_position()
-   {
-      this->pull_pos = 0;
-   }
+   /*! @brief Reset the pull buffer position and set the size of the data
+    *  that can be pulled to the size of the received data in the buffer. */
+   void reset_pull_position();
 
    /*! @brief Reset both the push and pull buffer positions. */
    void reset_buffer_positions()
@@ -139,6 +146,20 @@ class OpaqueBuffer
     *  @param encoding One of ENCODING_LITTLE_ENDIAN, ENCODING_BIG_ENDIAN, or ENCODING_NONE. */
    void pull_from_buffer( void *dest, std::size_t const size, EncodingEnum const encoding );
 
+   /*! @brief Push an array of doubles into the buffer as little-endian
+    *  (i.e. HLAfloat64LE) values. On little-endian hosts the values are
+    *  copied straight into the buffer with a single memcpy.
+    *  @param src   Source array of doubles.
+    *  @param count Number of doubles to push into the buffer. */
+   void push_float64_le_to_buffer( double const *src, std::size_t const count );
+
+   /*! @brief Pull an array of little-endian (i.e. HLAfloat64LE) values from
+    *  the buffer into an array of doubles. On little-endian hosts the values
+    *  are copied straight out of the buffer with a single memcpy.
+    *  @param dest  Destination array of doubles.
+    *  @param count Number of doubles to pull from the buffer. */
+   void pull_float64_le_from_buffer( double *dest, std::size_t const count );
+
   protected:
    /*! @brief Push the specified number of pad bytes to the buffer.
     *  @param pad_size Size of data in bytes. */
@@ -162,9 +183,10 @@ class OpaqueBuffer
   public:
    unsigned int alignment; ///< @trick_units{--} The byte alignment to use for the buffer.
 
-   std::size_t push_pos; ///< @trick_units{--} Position to push data to.
-   std::size_t pull_pos; ///< @trick_units{--} Position to pull data from.
-   std::size_t capacity; ///< @trick_units{--} Capacity of the buffer.
+   std::size_t push_pos;  ///< @trick_units{--} Position to push data to.
+   std::size_t pull_pos;  ///< @trick_units{--} Position to pull data from.
+   std::size_t capacity;  ///< @trick_units{--} Capacity of the buffer.
+   std::size_t data_size; ///< @trick_units{--} Size of the received data that can be pulled from the buffer.
 
    unsigned char *buffer; ///< @trick_units{--} Byte buffer.
 };
@@ -26,6 +26,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 @trick_link_dependency{../../source/TrickHLA/time/Int64Interval.cpp}
 @trick_link_dependency{../../source/TrickHLA/time/Int64Time.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/QueueStats.cpp}
 
 @revs_title
 @revs_begin
@@ -50,6 +51,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/time/Int64Interval.hh"
 #include "TrickHLA/time/Int64Time.hh"
+#include "TrickHLA/utils/QueueStats.hh"
 
 namespace TrickHLA
 {
@@ -82,6 +84,11 @@ class OwnershipHandler : public CheckpointConversionBase
    // Let the Object class have full access to the pull and push requests.
    friend class Object;
 
+   //------------------------- TRICK LOGGABLE OUTPUTS -------------------------
+  public:
+   QueueStats pull_stats; ///< @trick_units{--} Depth and backlog statistics of the pull ownership requests.
+   QueueStats push_stats; ///< @trick_units{--} Depth and backlog statistics of the push ownership requests.
+
   public:
    //-----------------------------------------------------------------
    // Constructors / destructor
@@ -113,6 +120,9 @@ class OwnershipHandler : public CheckpointConversionBase
     *  @param obj Associated object for this class. */
    virtual void initialize_callback( Object *obj );
 
+   /*! @brief Name the ownership request statistics after the object. */
+   void set_stats_names();
+
    /*! @brief Returns the name of the object.
     *  @return Name of the object. */
    std::string get_object_name() const;
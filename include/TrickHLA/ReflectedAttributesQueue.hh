@@ -22,6 +22,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../source/TrickHLA/ReflectedAttributesQueue.cpp}
 @trick_link_dependency{../../source/TrickHLA/Types.cpp}
 @trick_link_dependency{../../source/TrickHLA/utils/MutexLock.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/QueueStats.cpp}
 
 @revs_title
 @revs_begin
@@ -34,10 +35,15 @@ NASA, Johnson Space Center\n
 #ifndef TRICKHLA_REFLECTED_ATTRIBUTES_QUEUE_HH
 #define TRICKHLA_REFLECTED_ATTRIBUTES_QUEUE_HH
 
+// System includes.
+#include <cstdint>
+#include <queue>
+
 // TrickHLA includes.
 #include "TrickHLA/HLAStandardSupport.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/utils/MutexLock.hh"
+#include "TrickHLA/utils/QueueStats.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
 // to silence the warnings coming from the IEEE 1516 declared functions.
@@ -109,6 +115,15 @@ class ReflectedAttributesQueue
    /*! @brief Clear the queue of all values. */
    void clear();
 
+   /*! @brief Set the statistics to track the depth and backlog of the queue.
+    *  @param queue_stats The statistics, or NULL to not track them. */
+   void set_stats( QueueStats *queue_stats );
+
+  private:
+   QueueStats *stats; ///< @trick_io{**} Depth and backlog statistics of the queue, or NULL if not tracked.
+
+   std::queue< int64_t > push_times; ///< @trick_io{**} Monotonic times the queued attribute maps were pushed, if tracked.
+
   private:
    // Do not allow the copy constructor or assignment operator.
    /*! @brief Copy constructor for ReflectedAttributesQueue class.
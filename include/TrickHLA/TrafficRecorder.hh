@@ -0,0 +1,313 @@
+/*!
+@file TrickHLA/TrafficRecorder.hh
+@ingroup TrickHLA
+@brief This class records the federation traffic received by a federate to a
+memory-mapped binary log that TrickHLA::TrafficReplay feeds back through the
+receive side of a federate.
+
+The log starts with a file header followed by length-prefixed records, in the
+byte order of the recording host:
+- File header: the 8 character THLA_TRAFFIC_LOG_MAGIC, a uint32_t format
+  version and a reserved uint32_t.
+- Record header: the uint32_t size of the whole record, a uint16_t record type,
+  uint16_t flags, the int64_t monotonic clock time in nanoseconds since the
+  start of the recording and the int64_t HLA logical time in base time units.
+- Define records assign a uint32_t ID to an object instance name, to an
+  attribute FOM name of an object, to an interaction class FOM name or to a
+  parameter FOM name of an interaction class. They are written the first time
+  the name is seen, so the other records carry the IDs instead of the RTI
+  handles, which are only valid in the federation execution they came from.
+  An object instance gets a new ID each time it is discovered, so a reused
+  ObjectPool slot replays under the name of the instance bound to it.
+- Reflect and interaction records hold the object or interaction ID, the
+  user supplied tag and the ID and raw encoded bytes of each attribute or
+  parameter value.
+- Discover and remove records hold the object ID, and time advance grant
+  records only hold the granted logical time.
+
+Only the reflections of the TrickHLA objects are recorded, the MOM object
+updates are not.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/TrafficRecorder.cpp}
+@trick_link_dependency{../../source/TrickHLA/utils/MutexLock.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_TRAFFIC_RECORDER_HH
+#define TRICKHLA_TRAFFIC_RECORDER_HH
+
+// System includes.
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+// TrickHLA includes.
+#include "TrickHLA/HLAStandardSupport.hh"
+#include "TrickHLA/utils/MutexLock.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wdeprecated"
+#endif
+
+// HLA include files.
+#include "RTI/Handle.h"
+#include "RTI/RTI1516.h"
+#include "RTI/Typedefs.h"
+#include "RTI/VariableLengthData.h"
+
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic pop
+#endif
+
+// Identifier at the start of a TrickHLA traffic log file.
+#define THLA_TRAFFIC_LOG_MAGIC "THLATRAF"
+
+// Version of the TrickHLA traffic log file format.
+#define THLA_TRAFFIC_LOG_VERSION 1
+
+// Size in bytes of the traffic log file header and of a record header.
+#define THLA_TRAFFIC_LOG_HEADER_SIZE 16
+#define THLA_TRAFFIC_RECORD_HEADER_SIZE 24
+
+// The record has a valid HLA logical time.
+#define THLA_TRAFFIC_RECORD_FLAG_TIME 0x0001
+// The interaction was received as Time Stamp Order (TSO).
+#define THLA_TRAFFIC_RECORD_FLAG_TSO 0x0002
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class Manager;
+class Object;
+
+/*!
+@enum TrafficRecordEnum
+@brief Types of the records in a TrickHLA traffic log.
+*/
+typedef enum {
+   TRAFFIC_RECORD_DEFINE_OBJECT      = 1, ///< Assigns an ID to an object instance name.
+   TRAFFIC_RECORD_DEFINE_ATTRIBUTE   = 2, ///< Assigns an ID to an attribute FOM name of an object.
+   TRAFFIC_RECORD_DEFINE_INTERACTION = 3, ///< Assigns an ID to an interaction class FOM name.
+   TRAFFIC_RECORD_DEFINE_PARAMETER   = 4, ///< Assigns an ID to a parameter FOM name of an interaction.
+   TRAFFIC_RECORD_DISCOVER           = 5, ///< An object instance was discovered.
+   TRAFFIC_RECORD_REFLECT            = 6, ///< Reflected attribute values of an object.
+   TRAFFIC_RECORD_INTERACTION        = 7, ///< Received interaction parameter values.
+   TRAFFIC_RECORD_REMOVE             = 8, ///< An object instance was removed.
+   TRAFFIC_RECORD_TIME_ADVANCE_GRANT = 9  ///< A time advance was granted.
+} TrafficRecordEnum;
+
+class TrafficRecorder
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__TrafficRecorder();
+
+   //----------------------------- USER VARIABLES -----------------------------
+  public:
+   std::string file_name; ///< @trick_units{--} Traffic log file to record to, where empty disables the recording (default: empty).
+
+   //------------------------- TRICK LOGGABLE OUTPUTS -------------------------
+  public:
+   uint64_t record_count; ///< @trick_units{count} Number of records written.
+   uint64_t byte_count;   ///< @trick_units{count} Number of bytes written, including the file header.
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA TrafficRecorder class. */
+   TrafficRecorder();
+   /*! @brief Destructor for the TrickHLA TrafficRecorder class. */
+   virtual ~TrafficRecorder();
+
+   /*! @brief Create the traffic log file and start recording if a file name
+    *  is specified.
+    *  @param mgr The manager used to look up the received objects. */
+   void initialize( Manager *mgr );
+
+   /*! @brief Stop recording, truncate the log file to the recorded size and
+    *  close it. */
+   void shutdown();
+
+   /*! @brief Determine if the traffic is being recorded.
+    *  @return True if recording. */
+   bool is_recording() const
+   {
+      return ( log_data != NULL );
+   }
+
+   /*! @brief Record the discovery of an object instance.
+    *  @param instance_hndl Object instance handle. */
+   void record_discover( RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_hndl );
+
+   /*! @brief Record the reflected attribute values of an object.
+    *  @param obj              The object the attribute values are for.
+    *  @param attribute_values Attribute values.
+    *  @param tag              User supplied tag.
+    *  @param time             HLA logical time, or NULL for receive order. */
+   void record_reflect( Object                                           *obj,
+                        RTI1516_NAMESPACE::AttributeHandleValueMap const &attribute_values,
+                        RTI1516_NAMESPACE::VariableLengthData const      &tag,
+                        RTI1516_NAMESPACE::LogicalTime const             *time );
+
+   /*! @brief Record a received interaction.
+    *  @param class_hndl       Interaction class handle.
+    *  @param parameter_values Parameter values.
+    *  @param tag              User supplied tag.
+    *  @param time             HLA logical time, or NULL for receive order.
+    *  @param received_as_TSO  True if received as Time Stamp Order. */
+   void record_interaction( RTI1516_NAMESPACE::InteractionClassHandle const  &class_hndl,
+                            RTI1516_NAMESPACE::ParameterHandleValueMap const &parameter_values,
+                            RTI1516_NAMESPACE::VariableLengthData const      &tag,
+                            RTI1516_NAMESPACE::LogicalTime const             *time,
+                            bool const                                        received_as_TSO );
+
+   /*! @brief Record the removal of an object instance.
+    *  @param instance_hndl Object instance handle. */
+   void record_remove( RTI1516_NAMESPACE::ObjectInstanceHandle const &instance_hndl );
+
+   /*! @brief Record a time advance grant.
+    *  @param time Granted HLA logical time. */
+   void record_time_advance_grant( RTI1516_NAMESPACE::LogicalTime const &time );
+
+  protected:
+   /*! @brief Get the ID of the object instance, writing a define record the
+    *  first time the instance is seen. The mutex must be locked by the caller.
+    *  @return The object ID.
+    *  @param obj The object. */
+   uint32_t get_object_id( Object const *obj );
+
+   /*! @brief Get the ID of an attribute of an object, writing a define record
+    *  the first time the attribute is seen. The mutex must be locked by the
+    *  caller.
+    *  @return The attribute ID, or zero if the attribute is unknown.
+    *  @param obj        The object.
+    *  @param obj_id     The object ID.
+    *  @param attr_hndl  The attribute handle. */
+   uint32_t get_attribute_id( Object                                   *obj,
+                              uint32_t const                            obj_id,
+                              RTI1516_NAMESPACE::AttributeHandle const &attr_hndl );
+
+   /*! @brief Get the ID of an interaction class, writing a define record the
+    *  first time the class is seen. The mutex must be locked by the caller.
+    *  @return The interaction ID, or zero if the class name is unavailable.
+    *  @param class_hndl Interaction class handle. */
+   uint32_t get_interaction_id( RTI1516_NAMESPACE::InteractionClassHandle const &class_hndl );
+
+   /*! @brief Get the ID of a parameter of an interaction class, writing a
+    *  define record the first time the parameter is seen. The mutex must be
+    *  locked by the caller.
+    *  @return The parameter ID, or zero if the parameter name is unavailable.
+    *  @param class_hndl Interaction class handle.
+    *  @param inter_id   Interaction ID.
+    *  @param param_hndl Parameter handle. */
+   uint32_t get_parameter_id( RTI1516_NAMESPACE::InteractionClassHandle const &class_hndl,
+                              uint32_t const                                   inter_id,
+                              RTI1516_NAMESPACE::ParameterHandle const        &param_hndl );
+
+   /*! @brief Write a define record. The mutex must be locked by the caller.
+    *  @param type     Define record type.
+    *  @param id       ID assigned to the name.
+    *  @param owner_id ID of the owning object or interaction, or zero.
+    *  @param name     The name. */
+   void write_define( TrafficRecordEnum const type,
+                      uint32_t const          id,
+                      uint32_t const          owner_id,
+                      std::string const      &name );
+
+   /*! @brief Start a record, making sure the log has room for it. The mutex
+    *  must be locked by the caller.
+    *  @return True if the record was started, false if the log could not grow.
+    *  @param type         Record type.
+    *  @param flags        Record flags.
+    *  @param logical_time HLA logical time in base time units.
+    *  @param payload_size Size in bytes of the record payload. */
+   bool begin_record( TrafficRecordEnum const type,
+                      uint16_t const          flags,
+                      int64_t const           logical_time,
+                      std::size_t const       payload_size );
+
+   /*! @brief Append bytes to the payload of the current record.
+    *  @param data Bytes to append.
+    *  @param size Number of bytes. */
+   void append( void const *data, std::size_t const size );
+
+   /*! @brief Append a uint32_t to the payload of the current record.
+    *  @param value Value to append. */
+   void append_uint32( uint32_t const value )
+   {
+      append( &value, sizeof( value ) );
+   }
+
+   /*! @brief Grow the memory-mapped log file to hold at least the given size.
+    *  @return True on success.
+    *  @param min_size Minimum size in bytes of the log file. */
+   bool grow( std::size_t const min_size );
+
+  private:
+   Manager *manager; ///< @trick_units{--} Manager used to look up the received objects.
+
+   int            log_fd;       ///< @trick_io{**} File descriptor of the traffic log file.
+   unsigned char *log_data;     ///< @trick_io{**} Memory-mapped traffic log file.
+   std::size_t    log_capacity; ///< @trick_io{**} Mapped size in bytes of the traffic log file.
+   std::size_t    log_size;     ///< @trick_io{**} Recorded size in bytes of the traffic log.
+   int64_t        start_time;   ///< @trick_io{**} Monotonic clock time in nanoseconds the recording started.
+   uint32_t       next_id;      ///< @trick_io{**} Next ID to assign to a name.
+   bool           grow_failed;  ///< @trick_io{**} Flag to indicate the log could not grow, which stops the recording.
+
+   std::map< RTI1516_NAMESPACE::ObjectInstanceHandle, uint32_t >                   object_ids;      ///< @trick_io{**} Object IDs keyed by the object instance handle.
+   std::map< std::pair< uint32_t, RTI1516_NAMESPACE::AttributeHandle >, uint32_t > attribute_ids;   ///< @trick_io{**} Attribute IDs keyed by the object ID and attribute handle.
+   std::map< RTI1516_NAMESPACE::InteractionClassHandle, uint32_t >                 interaction_ids; ///< @trick_io{**} Interaction IDs keyed by the class handle.
+   std::map< std::pair< uint32_t, RTI1516_NAMESPACE::ParameterHandle >, uint32_t > parameter_ids;   ///< @trick_io{**} Parameter IDs keyed by the interaction ID and parameter handle.
+
+   MutexLock mutex; ///< @trick_io{**} Mutex to serialize the records written from the RTI callbacks.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for TrafficRecorder class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   TrafficRecorder( TrafficRecorder const &rhs );
+   /*! @brief Assignment operator for TrafficRecorder class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   TrafficRecorder &operator=( TrafficRecorder const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_TRAFFIC_RECORDER_HH: Do NOT put anything after this line!
@@ -0,0 +1,197 @@
+/*!
+@file TrickHLA/TrafficReplay.hh
+@ingroup TrickHLA
+@brief This class replays a traffic log recorded by TrickHLA::TrafficRecorder
+through the receive side of a federate.
+
+The reflections are queued on the TrickHLA objects by instance name and the
+interactions are handed to the TrickHLA::Manager by interaction class name, so
+they are decoded and processed by the same Manager and Object jobs as live
+traffic. Each call of replay_frame() replays the records up to and including
+the next recorded time advance grant, so one recorded frame is replayed per
+data cycle. With a pace_rate of zero the frames are replayed at full speed,
+which with the Trick realtime disabled runs faster than realtime. Otherwise
+a frame is held back, without blocking the data cycle, until the recorded
+monotonic clock time of its time advance grant, scaled by the pace_rate, has
+elapsed since the replay started.
+
+Replayed interactions keep their recorded logical time and order type. The
+reflections are queued on the objects without their logical time, the same
+as live reflections. The recording holds the Timestamp Order (TSO)
+reflections in the order the RTI delivered them, and each is replayed in the
+frame of the time advance grant it was delivered before, so the replay keeps
+the TSO delivery order and frame of each reflection.
+
+The replaying federate must be configured with the same objects and
+interactions as the recording federate. Records for names the replaying
+federate does not know are counted in unmatched_count and skipped. The
+discover and remove records are counted but not replayed, since the object
+instances are bound by name in the replaying federate.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../source/TrickHLA/TrafficReplay.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_TRAFFIC_REPLAY_HH
+#define TRICKHLA_TRAFFIC_REPLAY_HH
+
+// System includes.
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// TrickHLA includes.
+#include "TrickHLA/HLAStandardSupport.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wdeprecated"
+#endif
+
+// HLA include files.
+#include "RTI/Handle.h"
+
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic pop
+#endif
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class Manager;
+class Object;
+
+class TrafficReplay
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__TrafficReplay();
+
+   //----------------------------- USER VARIABLES -----------------------------
+  public:
+   std::string file_name; ///< @trick_units{--} Traffic log file to replay, where empty disables the replay (default: empty).
+
+   double pace_rate; ///< @trick_units{--} Replay rate relative to the recorded monotonic clock time, where zero replays at full speed (default: 0.0).
+
+   //------------------------- TRICK LOGGABLE OUTPUTS -------------------------
+  public:
+   uint64_t replayed_count;  ///< @trick_units{count} Number of reflections and interactions replayed.
+   uint64_t unmatched_count; ///< @trick_units{count} Number of reflections and interactions skipped for unknown names.
+   uint64_t frame_count;     ///< @trick_units{count} Number of recorded time advance grants replayed.
+
+   bool finished; ///< @trick_units{--} Flag to indicate all the records were replayed.
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA TrafficReplay class. */
+   TrafficReplay();
+   /*! @brief Destructor for the TrickHLA TrafficReplay class. */
+   virtual ~TrafficReplay();
+
+   /*! @brief Open and verify the traffic log file if a file name is specified.
+    *  @param mgr The manager the traffic is replayed to. */
+   void initialize( Manager *mgr );
+
+   /*! @brief Replay the records up to and including the next recorded time
+    *  advance grant. */
+   void replay_frame();
+
+   /*! @brief Report the replay counts and close the traffic log file. */
+   void shutdown();
+
+   /*! @brief Determine if a traffic log is being replayed.
+    *  @return True if replaying. */
+   bool is_replaying() const
+   {
+      return ( log_data != NULL );
+   }
+
+  protected:
+   /*! @brief Determine if the next frame is due to be replayed, which is
+    *  when the recorded monotonic clock time of its time advance grant, scaled by
+    *  the pace rate, has elapsed since the replay started.
+    *  @return True if the next frame is due. */
+   bool is_frame_due();
+
+   /*! @brief Replay the record at the current read position.
+    *  @return True if the record was a time advance grant.
+    *  @param record Start of the record.
+    *  @param size   Size in bytes of the record. */
+   bool replay_record( unsigned char const *record,
+                       std::size_t const    size );
+
+   /*! @brief Save the name assigned to an ID by a define record and resolve
+    *  it to the object or RTI handle of this federate.
+    *  @param type     Define record type.
+    *  @param id       ID assigned to the name.
+    *  @param owner_id ID of the owning object or interaction, or zero.
+    *  @param name     The name. */
+   void define( int const          type,
+                uint32_t const     id,
+                uint32_t const     owner_id,
+                std::string const &name );
+
+  private:
+   Manager *manager; ///< @trick_units{--} Manager the traffic is replayed to.
+
+   int                  log_fd;      ///< @trick_io{**} File descriptor of the traffic log file.
+   unsigned char const *log_data;    ///< @trick_io{**} Memory-mapped traffic log file.
+   std::size_t          log_size;    ///< @trick_io{**} Size in bytes of the traffic log file.
+   std::size_t          read_offset; ///< @trick_io{**} Offset of the next record to replay.
+   int64_t              start_time;  ///< @trick_io{**} Monotonic clock time in nanoseconds the replay started.
+
+   std::vector< Object * > objects; ///< @trick_io{**} Objects of this federate, indexed by object ID.
+
+   std::vector< RTI1516_NAMESPACE::AttributeHandle >        attribute_handles;   ///< @trick_io{**} Attribute handles of this federate, indexed by attribute ID.
+   std::vector< RTI1516_NAMESPACE::InteractionClassHandle > interaction_handles; ///< @trick_io{**} Interaction class handles of this federate, indexed by interaction ID.
+   std::vector< RTI1516_NAMESPACE::ParameterHandle >        parameter_handles;   ///< @trick_io{**} Parameter handles of this federate, indexed by parameter ID.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for TrafficReplay class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   TrafficReplay( TrafficReplay const &rhs );
+   /*! @brief Assignment operator for TrafficReplay class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   TrafficReplay &operator=( TrafficReplay const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_TRAFFIC_REPLAY_HH: Do NOT put anything after this line!
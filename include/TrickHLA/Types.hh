@@ -357,6 +357,14 @@ typedef std::map< RTI1516_NAMESPACE::ObjectInstanceHandle, std::wstring > TrickH
 
 typedef std::map< std::string, std::size_t > TrickHLAObjInstanceNameIndexMap;
 
+typedef std::map< std::string, RTI1516_NAMESPACE::ObjectClassHandle > TrickHLAObjClassHandleNameMap;
+
+typedef std::map< std::string, RTI1516_NAMESPACE::AttributeHandle > TrickHLAAttributeHandleNameMap;
+
+typedef std::map< std::string, RTI1516_NAMESPACE::InteractionClassHandle > TrickHLAInterClassHandleNameMap;
+
+typedef std::map< std::string, RTI1516_NAMESPACE::ParameterHandle > TrickHLAParameterHandleNameMap;
+
 typedef std::vector< std::string > VectorOfStrings;
 
 typedef std::vector< std::wstring > VectorOfWstrings;
@@ -96,7 +96,33 @@ class EncoderFactory
       TrickHLA::EncodingEnum const hla_encoding,
       std::string const           &trick_name );
 
+   /*! @brief Enable or disable the cache of resolved Trick member types.
+    *  @param enable True to cache the resolved Trick member types. */
+   static void set_resolution_cache_enabled( bool const enable );
+
+   /*! @brief Clear the cache of resolved Trick member types and counts. */
+   static void clear_resolution_cache();
+
+   /*! @brief Get the number of Trick names resolved from the cache.
+    *  @return Number of cache hits. */
+   static unsigned int get_resolution_cache_hits();
+
+   /*! @brief Get the number of Trick names that had to be fully resolved.
+    *  @return Number of cache misses. */
+   static unsigned int get_resolution_cache_misses();
+
   protected:
+   /*! @brief Resolve the address and Trick type information of a Trick
+    *  variable, using the cache of resolved member types when possible.
+    *  @return True if the Trick name was resolved.
+    *  @param trick_name Fully qualified Trick variable name.
+    *  @param address    The resolved address of the variable.
+    *  @param attr       The resolved Trick type information of the variable. */
+   static bool resolve_trick_name(
+      std::string const &trick_name,
+      void             **address,
+      ATTRIBUTES       **attr );
+
    static EncoderBase *create_char_encoder(
       void                        *address,
       ATTRIBUTES                  *attr,
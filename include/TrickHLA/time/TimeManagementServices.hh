@@ -25,6 +25,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../../../source/TrickHLA/time/TrickThreadCoordinator.cpp}
 @trick_link_dependency{../../../source/TrickHLA/DebugHandler.cpp}
 @trick_link_dependency{../../../source/TrickHLA/Types.cpp}
+@trick_link_dependency{../../../source/TrickHLA/utils/LatencyHistogram.cpp}
 @trick_link_dependency{../../../source/TrickHLA/utils/MutexLock.cpp}
 @trick_link_dependency{../../../source/TrickHLA/utils/MutexProtection.cpp}
 
@@ -53,6 +54,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/time/Int64Interval.hh"
 #include "TrickHLA/time/Int64Time.hh"
 #include "TrickHLA/time/TrickThreadCoordinator.hh"
+#include "TrickHLA/utils/LatencyHistogram.hh"
 #include "TrickHLA/utils/MutexLock.hh"
 #include "TrickHLA/utils/MutexProtection.hh"
 #include "TrickHLA/utils/Utilities.hh"
@@ -108,6 +110,8 @@ class TimeManagementServices : public TrickThreadCoordinator
    bool time_constrained; ///< @trick_units{--} HLA Time Constrained flag (default: true).
    bool time_management;  ///< @trick_units{--} Enable HLA Time Management flag (default: true).
 
+   bool TAG_wait_stats_enabled; ///< @trick_units{--} Collect the Time Advance Grant (TAG) wait time statistics (default: false).
+
    //--------------------------------------------------------------------------
 
    //--------------------------------------------------------------------------
@@ -350,8 +354,7 @@ class TimeManagementServices : public TrickThreadCoordinator
    bool time_regulating_state;  ///< @trick_units{--} Internal flag, federates HLA Time Regulation state (default: false).
    bool time_constrained_state; ///< @trick_units{--} Internal flag, federates HLA Time Constrained state (default: false).
 
-   uint64_t tag_wait_sum;   ///< @trick_units{--} Sum of all the TAG wait wallclock times.
-   uint64_t tag_wait_count; ///< @trick_units{--} Number of times we waited for TAG.
+   LatencyHistogram TAG_wait_stats; ///< @trick_units{--} Histogram of the TAG wait wallclock times in microseconds.
 
    // Federation required associations.
    //
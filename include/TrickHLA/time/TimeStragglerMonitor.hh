@@ -0,0 +1,265 @@
+/*!
+@file TrickHLA/time/TimeStragglerMonitor.hh
+@ingroup TrickHLA
+@brief This class identifies the federate that is holding back the HLA time
+advancement of this federate.
+
+When enabled, the monitor subscribes to the time attributes of the MOM
+HLAfederate object of every joined federate. Once a wait for a Time Advance
+Grant (TAG) has lasted longer than the sample_period, the monitor requests
+an update of those attributes and then requests it again every sample_period
+until the grant arrives. The time regulating federate with the smallest
+output time bound (HLAlogicalTime plus HLAlookahead) that is not past our
+requested time is the federate gating our grant. The wait time is attributed
+to the gating federate in slices of the sample_period, so the time held
+statistics of each federate are reported at shutdown and the gating federate
+is named in the periodic TAG waiting message.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/time/TimeStragglerMonitor.cpp}
+@trick_link_dependency{../../../source/TrickHLA/utils/MutexLock.cpp}
+@trick_link_dependency{../../../source/TrickHLA/utils/MutexProtection.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_TIME_STRAGGLER_MONITOR_HH
+#define TRICKHLA_TIME_STRAGGLER_MONITOR_HH
+
+// System includes.
+#include <cstdint>
+#include <map>
+#include <string>
+
+// TrickHLA includes.
+#include "TrickHLA/HLAStandardSupport.hh"
+#include "TrickHLA/utils/MutexLock.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wdeprecated"
+#endif
+
+// HLA include files.
+#include "RTI/Handle.h"
+#include "RTI/Typedefs.h"
+
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic pop
+#endif
+
+namespace TrickHLA
+{
+
+// Forward Declared Classes:  Since these classes are only used as references
+// through pointers, these classes are included as forward declarations. This
+// helps to limit issues with recursive includes.
+class Federate;
+
+/*!
+@struct StragglerFederateState
+@brief The last reported MOM time state and the time held statistics of a
+joined federate.
+*/
+struct StragglerFederateState {
+   std::string name; ///< @trick_units{--} Federate name.
+
+   bool    time_known;   ///< @trick_units{--} True once the logical time and lookahead were reported.
+   int64_t logical_time; ///< @trick_units{--} Reported HLAlogicalTime in the HLA base time unit.
+   int64_t lookahead;    ///< @trick_units{--} Reported HLAlookahead in the HLA base time unit.
+   int64_t GALT;         ///< @trick_units{--} Reported HLAGALT in the HLA base time unit.
+   int64_t LITS;         ///< @trick_units{--} Reported HLALITS in the HLA base time unit.
+   bool    regulating;   ///< @trick_units{--} Reported HLAtimeRegulating state.
+   bool    advancing;    ///< @trick_units{--} True if the reported HLAtimeManagerState is time advancing.
+   bool    resigned;     ///< @trick_units{--} True once the MOM object of the federate was removed.
+   int64_t update_nanos; ///< @trick_units{--} Monotonic wallclock time of the last reflection in nanoseconds.
+
+   int64_t held_count;     ///< @trick_units{count} Number of TAG waits this federate gated.
+   int64_t held_nanos;     ///< @trick_units{--} Total wallclock time this federate gated our TAG in nanoseconds.
+   int64_t max_held_nanos; ///< @trick_units{--} Longest wallclock time this federate gated a single TAG wait in nanoseconds.
+   int64_t wait_nanos;     ///< @trick_units{--} Wallclock time this federate gated the current TAG wait in nanoseconds.
+
+   /*! @brief Default constructor for the StragglerFederateState struct. */
+   StragglerFederateState()
+      : name(),
+        time_known( false ),
+        logical_time( 0 ),
+        lookahead( 0 ),
+        GALT( 0 ),
+        LITS( 0 ),
+        regulating( false ),
+        advancing( false ),
+        resigned( false ),
+        update_nanos( 0 ),
+        held_count( 0 ),
+        held_nanos( 0 ),
+        max_held_nanos( 0 ),
+        wait_nanos( 0 )
+   {
+      return;
+   }
+};
+
+class TimeStragglerMonitor
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__TimeStragglerMonitor();
+
+   //----------------------------- USER VARIABLES -----------------------------
+   // The variables below this point are configured by the user in either the
+   // input or modified-data files.
+  public:
+   bool enabled; ///< @trick_units{--} Enable the time straggler monitor, default: false.
+
+   double sample_period; ///< @trick_units{s} Wallclock period a TAG wait must last before, and between, the MOM time attribute requests, default: 0.1.
+
+   //------------------------- TRICK LOGGABLE OUTPUTS -------------------------
+   // The variables below this point are outputs that can be logged by Trick.
+  public:
+   int64_t slow_wait_count; ///< @trick_units{count} Number of TAG waits that lasted longer than the sample period.
+
+   double held_time;         ///< @trick_units{s} Total wallclock time of the slow TAG waits attributed to a gating federate.
+   double unattributed_time; ///< @trick_units{s} Total wallclock time of the slow TAG waits with no known gating federate.
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA TimeStragglerMonitor class. */
+   TimeStragglerMonitor();
+   /*! @brief Destructor for the TrickHLA TimeStragglerMonitor class. */
+   virtual ~TimeStragglerMonitor();
+
+   /*! @brief Verify the configuration if the monitor is enabled.
+    *  @param fed The federate whose TAG waits are monitored. */
+   void initialize( Federate *fed );
+
+   /*! @brief Determine if the time straggler monitor is enabled.
+    *  @return True if the monitor is enabled. */
+   bool is_enabled() const
+   {
+      return enabled;
+   }
+
+   /*! @brief Begin monitoring a wait for a Time Advance Grant.
+    *  @param requested_time Requested HLA time in the HLA base time unit. */
+   void begin_wait( int64_t const requested_time );
+
+   /*! @brief Request the MOM time attributes and attribute the wait time to
+    *  the gating federate every sample period of the current wait. */
+   void check_wait();
+
+   /*! @brief End monitoring the current wait for a Time Advance Grant. */
+   void end_wait();
+
+   /*! @brief Get a description of the federate gating the current wait.
+    *  @return The gating federate description, or empty if not known. */
+   std::string const get_gating_federate_status();
+
+   /*! @brief Save the time attributes of a reflected MOM HLAfederate object.
+    *  @param id     MOM HLAfederate object instance handle.
+    *  @param values Attribute values. */
+   void reflect_MOM_time_attributes( RTI1516_NAMESPACE::ObjectInstanceHandle const    &id,
+                                     RTI1516_NAMESPACE::AttributeHandleValueMap const &values );
+
+   /*! @brief Exclude a resigned federate from the gating federates.
+    *  @param id MOM HLAfederate object instance handle. */
+   void remove_federate( RTI1516_NAMESPACE::ObjectInstanceHandle const &id );
+
+   /*! @brief Forget the MOM handles and subscription, such as after a
+    *  checkpoint restore, so they are set up again on the next wait. */
+   void reset();
+
+   /*! @brief Returns a string summary of the time held statistics. */
+   std::string const to_string();
+
+  protected:
+   /*! @brief Get the MOM time attribute handles and subscribe to them.
+    *  @return True if subscribed. */
+   bool subscribe();
+
+   /*! @brief Request an update of the MOM time attributes of all federates. */
+   void request_update();
+
+   /*! @brief Attribute the wait time since the last attribution to the
+    *  gating federate, which is kept pending until the gating federate is
+    *  known unless this is the last slice of the wait.
+    *  @param now        Monotonic wallclock time in nanoseconds.
+    *  @param last_slice True for the last slice of the wait. */
+   void attribute_wait_time( int64_t const now, bool const last_slice );
+
+   /*! @brief Find the federate gating our requested time from the MOM time
+    *  attributes reflected during the current wait, where the caller must
+    *  hold the mutex.
+    *  @return The gating federate state, or NULL if not known. */
+   StragglerFederateState *find_gating_federate();
+
+  private:
+   Federate *federate; ///< @trick_units{--} Federate whose TAG waits are monitored.
+
+   bool subscribed; ///< @trick_units{--} True once subscribed to the MOM time attributes.
+
+   RTI1516_NAMESPACE::ObjectClassHandle MOM_HLAfederate_class_handle;   ///< @trick_io{**} MOM HLAfederate class handle.
+   RTI1516_NAMESPACE::AttributeHandle   MOM_HLAfederateName_handle;     ///< @trick_io{**} MOM HLAfederateName attribute handle.
+   RTI1516_NAMESPACE::AttributeHandle   MOM_HLAtimeRegulating_handle;   ///< @trick_io{**} MOM HLAtimeRegulating attribute handle.
+   RTI1516_NAMESPACE::AttributeHandle   MOM_HLAtimeManagerState_handle; ///< @trick_io{**} MOM HLAtimeManagerState attribute handle.
+   RTI1516_NAMESPACE::AttributeHandle   MOM_HLAlogicalTime_handle;      ///< @trick_io{**} MOM HLAlogicalTime attribute handle.
+   RTI1516_NAMESPACE::AttributeHandle   MOM_HLAlookahead_handle;        ///< @trick_io{**} MOM HLAlookahead attribute handle.
+   RTI1516_NAMESPACE::AttributeHandle   MOM_HLAGALT_handle;             ///< @trick_io{**} MOM HLAGALT attribute handle.
+   RTI1516_NAMESPACE::AttributeHandle   MOM_HLALITS_handle;             ///< @trick_io{**} MOM HLALITS attribute handle.
+
+   RTI1516_NAMESPACE::AttributeHandleSet time_attributes; ///< @trick_io{**} The subscribed MOM HLAfederate attributes.
+
+   bool    waiting;              ///< @trick_units{--} True while monitoring a TAG wait.
+   int64_t wait_requested_time; ///< @trick_units{--} Requested HLA time of the current wait in the HLA base time unit.
+   int64_t wait_start_nanos;    ///< @trick_units{--} Monotonic wallclock time the current wait started in nanoseconds.
+   int64_t next_sample_nanos;   ///< @trick_units{--} Monotonic wallclock time of the next MOM time attribute request.
+   int64_t attributed_nanos;    ///< @trick_units{--} Monotonic wallclock time up to which the current wait was attributed.
+   int64_t sample_period_nanos; ///< @trick_units{--} The sample period in nanoseconds.
+
+   MutexLock mutex; ///< @trick_units{--} Mutex for the federate states, which are set from the RTI callbacks.
+
+   std::map< RTI1516_NAMESPACE::ObjectInstanceHandle, StragglerFederateState > federates; ///< @trick_io{**} Federate states by MOM HLAfederate instance.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for TimeStragglerMonitor class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   TimeStragglerMonitor( TimeStragglerMonitor const &rhs );
+   /*! @brief Assignment operator for TimeStragglerMonitor class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   TimeStragglerMonitor &operator=( TimeStragglerMonitor const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_TIME_STRAGGLER_MONITOR_HH: Do NOT put anything after this line!
@@ -0,0 +1,98 @@
+/*!
+@file TrickHLA/utils/CountdownLatch.hh
+@ingroup TrickHLA
+@brief TrickHLA countdown latch used to wait for a set of RTI callbacks.
+
+A thread sets the number of pending events, each callback counts down one
+event, and the waiting thread is woken once when the count reaches zero.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/utils/CountdownLatch.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+*/
+
+#ifndef TRICKHLA_COUNTDOWN_LATCH_HH
+#define TRICKHLA_COUNTDOWN_LATCH_HH
+
+// System includes.
+#include <pthread.h>
+
+namespace TrickHLA
+{
+
+class CountdownLatch
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__CountdownLatch();
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA CountdownLatch class. */
+   CountdownLatch();
+   /*! @brief Destructor for the TrickHLA CountdownLatch class. */
+   virtual ~CountdownLatch();
+
+   /*! @brief Set the number of pending events.
+    *  @param pending_count Number of events to wait for. */
+   void reset( unsigned int const pending_count );
+
+   /*! @brief Count down one pending event, waking the waiting thread when
+    *  the last pending event is counted down.
+    *  @return True if this call counted down the last pending event. */
+   bool count_down();
+
+   /*! @brief Get the number of pending events.
+    *  @return Number of pending events. */
+   unsigned int get_count();
+
+   /*! @brief Wait for the pending event count to reach zero.
+    *  @return True if there are no pending events, false on timeout.
+    *  @param wait_micros Maximum time to wait in microseconds. */
+   bool wait( long const wait_micros );
+
+  protected:
+   pthread_mutex_t mutex;     ///< @trick_io{**} Mutex protecting the count.
+   pthread_cond_t  condition; ///< @trick_io{**} Condition signaled when the count reaches zero.
+   unsigned int    count;     ///< @trick_units{--} Number of pending events.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for CountdownLatch class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   CountdownLatch( CountdownLatch const &rhs );
+   /*! @brief Assignment operator for CountdownLatch class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   CountdownLatch &operator=( CountdownLatch const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_COUNTDOWN_LATCH_HH: Do NOT put anything after this line!
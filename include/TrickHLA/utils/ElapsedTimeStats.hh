@@ -4,6 +4,10 @@
 @brief This class gathers statistics on the elapsed time between calls to the
 measure function.
 
+The elapsed times are recorded in a log-bucketed LatencyHistogram so that the
+tail latency percentiles can be reported, and the measurement can be enabled
+at runtime.
+
 @copyright Copyright 2019 United States Government as represented by the
 Administrator of the National Aeronautics and Space Administration.
 No copyright is claimed in the United States under Title 17, U.S. Code.
@@ -21,6 +25,7 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{../../../source/TrickHLA/utils/ElapsedTimeStats.cpp}
+@trick_link_dependency{../../../source/TrickHLA/utils/LatencyHistogram.cpp}
 
 @revs_title
 @revs_begin
@@ -36,6 +41,9 @@ NASA, Johnson Space Center\n
 #include <cstdint>
 #include <string>
 
+// TrickHLA includes.
+#include "TrickHLA/utils/LatencyHistogram.hh"
+
 namespace TrickHLA
 {
 
@@ -51,6 +59,9 @@ class ElapsedTimeStats
    // Syntax: friend void init_attr<namespace>__<class name>();
    friend void init_attrTrickHLA__ElapsedTimeStats();
 
+  public:
+   bool enabled; ///< @trick_units{--} Enable the elapsed time measurements, default: false.
+
   public:
    // Public constructors and destructors.
    /*! @brief Default constructor for the TrickHLA ElapsedTimeStats class. */
@@ -60,11 +71,22 @@ class ElapsedTimeStats
 
    // Use implicit copy constructor and assignment operator.
 
+   /*! @brief Determine if the elapsed time measurements are enabled.
+    *  @return True if enabled. */
+   bool is_enabled() const
+   {
+      return enabled;
+   }
+
    /*! @brief Measure the elapsed time. */
    void measure();
 
-   /*! @brief Convert confidence level to Z value. */
-   static double confidence_to_Z( double &confidence );
+   /*! @brief Get the histogram of the measured elapsed times.
+    *  @return The histogram of the elapsed times in microseconds. */
+   LatencyHistogram const &get_histogram() const
+   {
+      return histogram;
+   }
 
    /*! @brief Returns a string summary of the elapsed time statistics. */
    std::string const to_string();
@@ -76,15 +98,9 @@ class ElapsedTimeStats
 
    int64_t prev_time; ///< @trick_units{microseconds} Previous elapsed time.
 
-   uint64_t count; ///< @trick_units{--} Number of elapsed times measured.
-
    double elapsed_time; ///< @trick_units{milliseconds} Current elapsed time.
 
-   double min; ///< @trick_units{milliseconds} Minimum elapsed time measured.
-   double max; ///< @trick_units{milliseconds} Maximum elapsed time measured.
-
-   double time_sum;         ///< @trick_units{milliseconds} Sum of the elapsed time measured.
-   double time_squared_sum; ///< @trick_units{milliseconds^2} Sum of the elapsed time squared.
+   LatencyHistogram histogram; ///< @trick_units{--} Histogram of the elapsed times in microseconds.
 };
 
 } // namespace TrickHLA
@@ -0,0 +1,271 @@
+/*!
+@file TrickHLA/utils/FrameProfiler.hh
+@ingroup TrickHLA
+@brief TrickHLA per-frame profiler of the THLABase.sm data cycle job chain.
+
+Each stage of the job chain is timed with a monotonic clock and the time
+spent in a stage is summed over a frame. A frame starts with the wait for
+the HLA Time Advance Grant (TAG) and ends with the TAG wait of the next
+frame. The last per-frame stage times are Trick loggable, and the rolling
+p50, p99, p99.9 and maximum times over a window of frames are updated every
+report period. The stage times of each report period are recorded in a
+LatencyHistogram per stage, and the window is the last whole report periods
+that cover window_size frames, so the percentiles are resolved to within
+about 3%. The statistics rows of the optional CSV file are buffered and
+appended to the file every csv_flush_reports reports by the flush_csv()
+logging job, and the rest are written at shutdown.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/utils/FrameProfiler.cpp}
+@trick_link_dependency{../../../source/TrickHLA/utils/LatencyHistogram.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_FRAME_PROFILER_HH
+#define TRICKHLA_FRAME_PROFILER_HH
+
+// System includes.
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// TrickHLA includes.
+#include "TrickHLA/utils/LatencyHistogram.hh"
+
+// Number of profiled frame stages, which must match FrameStageEnum.
+#define THLA_FRAME_STAGE_COUNT 13
+
+namespace TrickHLA
+{
+
+/*!
+@enum FrameStageEnum
+@brief Define the profiled stages of the THLABase.sm data cycle job chain.
+*/
+typedef enum {
+
+   FRAME_STAGE_FIRST_VALUE             = 0,  ///< Set to the First value in the enumeration.
+   FRAME_STAGE_TIME_ADVANCE_GRANT      = 0,  ///< Wait for the HLA Time Advance Grant (TAG).
+   FRAME_STAGE_PROCESS_INTERACTIONS    = 1,  ///< Manager process_interactions().
+   FRAME_STAGE_PROCESS_DELETED_OBJECTS = 2,  ///< Manager process_deleted_objects().
+   FRAME_STAGE_RECEIVE_CYCLIC_DATA     = 3,  ///< Manager receive_cyclic_data(), the decode of the received data.
+   FRAME_STAGE_ANNOUNCE_DATA_AVAILABLE = 4,  ///< Federate announce_data_available().
+   FRAME_STAGE_WAIT_TO_SEND_DATA       = 5,  ///< Federate wait_to_send_data() for the Trick child threads.
+   FRAME_STAGE_SEND_CYCLIC_DATA        = 6,  ///< Manager send_cyclic_and_requested_data(), including the encode and RTI send stages.
+   FRAME_STAGE_ENCODE                  = 7,  ///< Encode of the cyclic attribute data, part of the send stage.
+   FRAME_STAGE_RTI_SEND                = 8,  ///< RTI updateAttributeValues() calls for the cyclic data, part of the send stage.
+   FRAME_STAGE_PROCESS_OWNERSHIP       = 9,  ///< Manager process_ownership().
+   FRAME_STAGE_ANNOUNCE_DATA_SENT      = 10, ///< Federate announce_data_sent().
+   FRAME_STAGE_TIME_ADVANCE_REQUEST    = 11, ///< HLA Time Advance Request (TAR).
+   FRAME_STAGE_FRAME                   = 12, ///< The whole frame, from one TAG wait to the next.
+   FRAME_STAGE_LAST_VALUE              = 12  ///< Set to the Last value in the enumeration.
+
+} FrameStageEnum;
+
+class FrameProfiler
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__FrameProfiler();
+
+   //----------------------------- USER VARIABLES -----------------------------
+   // The variables below this point are configured by the user in either the
+   // input or modified-data files.
+  public:
+   bool enabled; ///< @trick_units{--} Enable the frame profiler, default: false.
+
+   int window_size;   ///< @trick_units{count} Number of frames in the rolling statistics window, rounded up to whole report periods, default: 1000.
+   int report_period; ///< @trick_units{count} Number of frames between statistics updates, default: 1000.
+
+   std::string csv_file; ///< @trick_units{--} CSV file the statistics of every report period are written to, default: none.
+
+   int csv_flush_reports; ///< @trick_units{count} Number of reports between appends of the buffered rows to the CSV file, where zero only writes them at shutdown, default: 10.
+
+   //------------------------- TRICK LOGGABLE OUTPUTS -------------------------
+   // The variables below this point are outputs that can be logged by Trick.
+  public:
+   int64_t frame_count; ///< @trick_units{count} Number of profiled frames.
+
+   double last_us[THLA_FRAME_STAGE_COUNT]; ///< @trick_units{us} Stage times of the last frame.
+   double p50_us[THLA_FRAME_STAGE_COUNT];  ///< @trick_units{us} Rolling median stage times.
+   double p99_us[THLA_FRAME_STAGE_COUNT];  ///< @trick_units{us} Rolling 99th percentile stage times.
+   double p999_us[THLA_FRAME_STAGE_COUNT]; ///< @trick_units{us} Rolling 99.9th percentile stage times.
+   double max_us[THLA_FRAME_STAGE_COUNT];  ///< @trick_units{us} Rolling maximum stage times.
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLA FrameProfiler class. */
+   FrameProfiler();
+   /*! @brief Destructor for the TrickHLA FrameProfiler class. */
+   virtual ~FrameProfiler();
+
+   /*! @brief Initialize the rolling window and the CSV file if enabled. */
+   void initialize();
+
+   /*! @brief Determine if the frame profiler is enabled.
+    *  @return True if the frame profiler is enabled. */
+   bool is_enabled() const
+   {
+      return enabled;
+   }
+
+   /*! @brief End the current frame, if any, and begin the next frame. */
+   void begin_frame();
+
+   /*! @brief Discard the current frame, such as for a frame that spans a
+    * freeze, so that it does not skew the statistics. */
+   void discard_frame();
+
+   /*! @brief Add the time spent in a stage to the current frame.
+    *  @param stage The frame stage.
+    *  @param nanos Time spent in the stage in nanoseconds. */
+   void add_stage_time( FrameStageEnum const stage, int64_t const nanos )
+   {
+      stage_nanos[stage] += nanos;
+      stage_ran[stage] = true;
+   }
+
+   /*! @brief Update the rolling statistics and buffer them for the CSV file. */
+   void report();
+
+   /*! @brief Append the buffered statistics to the CSV file once
+    * csv_flush_reports reports are buffered. */
+   void flush_csv();
+
+   /*! @brief Update the final statistics and write the buffered statistics
+    * to the CSV file. */
+   void shutdown();
+
+   /*! @brief Returns a string summary of the rolling statistics. */
+   std::string const to_string();
+
+   /*! @brief Get the name of a frame stage.
+    *  @return The name of the stage.
+    *  @param stage The frame stage. */
+   static char const *get_stage_name( FrameStageEnum const stage );
+
+   /*! @brief Get the monotonic clock time.
+    *  @return Monotonic clock time in nanoseconds. */
+   static int64_t monotonic_time();
+
+  protected:
+   /*! @brief Update the rolling percentile statistics of the window. */
+   void update_statistics();
+
+   /*! @brief Start the next report period of the window, replacing the
+    * oldest period. */
+   void next_period();
+
+   /*! @brief Buffer the statistics as rows of the CSV file. */
+   void buffer_csv();
+
+   /*! @brief Append the buffered rows to the CSV file. */
+   void write_csv();
+
+   int64_t frame_start_nanos; ///< @trick_units{--} Monotonic begin time of the current frame, or zero if none.
+
+   int64_t stage_nanos[THLA_FRAME_STAGE_COUNT]; ///< @trick_units{--} Time spent in each stage in the current frame in nanoseconds.
+   bool    stage_ran[THLA_FRAME_STAGE_COUNT];   ///< @trick_units{--} True if the stage ran in the current frame.
+
+   std::vector< LatencyHistogram > period_histograms; ///< @trick_io{**} Stage time histograms of the report periods in the window, one per stage per period.
+   std::vector< LatencyHistogram > window_histograms; ///< @trick_io{**} Scratch histograms of each stage merged over the window.
+
+   int window_periods; ///< @trick_units{count} Number of report periods in the window.
+   int period_next;    ///< @trick_units{--} Index of the report period being recorded.
+
+   int window_count[THLA_FRAME_STAGE_COUNT]; ///< @trick_units{count} Number of samples in the window of each stage.
+
+   std::string csv_rows;            ///< @trick_io{**} Buffered CSV rows not yet written to the file.
+   int         csv_pending_reports; ///< @trick_units{count} Number of reports in the buffered CSV rows.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for FrameProfiler class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   FrameProfiler( FrameProfiler const &rhs );
+   /*! @brief Assignment operator for FrameProfiler class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   FrameProfiler &operator=( FrameProfiler const &rhs );
+};
+
+class FrameProfilerScope
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__FrameProfilerScope();
+
+  public:
+   /*! @brief Begin timing a frame stage that ends when this scope goes away.
+    *  @param frame_profiler The frame profiler.
+    *  @param frame_stage    The frame stage. */
+   FrameProfilerScope( FrameProfiler &frame_profiler, FrameStageEnum const frame_stage )
+      : profiler( frame_profiler ),
+        stage( frame_stage ),
+        begin_nanos( frame_profiler.is_enabled() ? FrameProfiler::monotonic_time() : 0 )
+   {
+      return;
+   }
+
+   /*! @brief Destructor for the TrickHLA FrameProfilerScope class, which adds
+    *  the time spent to the stage. */
+   virtual ~FrameProfilerScope()
+   {
+      if ( begin_nanos != 0 ) {
+         profiler.add_stage_time( stage, FrameProfiler::monotonic_time() - begin_nanos );
+      }
+   }
+
+  protected:
+   FrameProfiler &profiler;    ///< @trick_io{**} The frame profiler.
+   FrameStageEnum stage;       ///< @trick_units{--} The frame stage.
+   int64_t        begin_nanos; ///< @trick_units{--} Monotonic begin time, or zero if not profiling.
+
+  private:
+   // Do not allow the default constructor, copy constructor or assignment operator.
+   /*! @brief Default constructor for the TrickHLA FrameProfilerScope class. */
+   FrameProfilerScope();
+   /*! @brief Copy constructor for FrameProfilerScope class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   FrameProfilerScope( FrameProfilerScope const &rhs );
+   /*! @brief Assignment operator for FrameProfilerScope class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   FrameProfilerScope &operator=( FrameProfilerScope const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_FRAME_PROFILER_HH: Do NOT put anything after this line!
@@ -0,0 +1,150 @@
+/*!
+@file TrickHLA/utils/LatencyHistogram.hh
+@ingroup TrickHLA
+@brief This class is a fixed memory, log-bucketed latency histogram with
+percentile queries.
+
+The histogram has the same layout as an HDR histogram. Values below 64 have
+their own bucket and each power of two above that is split into 32 linear
+sub-buckets, so a recorded value is resolved to within about 3% for the whole
+range up to 2^41 (about 25 days in microseconds). The buckets are allocated
+on the first recorded value and the memory does not grow after that.
+
+Recording is not thread safe. Each thread should record into its own
+histogram and merge them for reporting.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/utils/LatencyHistogram.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_LATENCY_HISTOGRAM_HH
+#define TRICKHLA_LATENCY_HISTOGRAM_HH
+
+// System includes.
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace TrickHLA
+{
+
+class LatencyHistogram
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__LatencyHistogram();
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLA LatencyHistogram class. */
+   LatencyHistogram();
+   /*! @brief Destructor for the TrickHLA LatencyHistogram class. */
+   virtual ~LatencyHistogram();
+
+   // Use implicit copy constructor and assignment operator.
+
+   /*! @brief Record a value, where negative values are recorded as zero.
+    *  @param value The value to record. */
+   void record( int64_t const value );
+
+   /*! @brief Merge the values of another histogram into this one.
+    *  @param other The histogram to merge. */
+   void merge( LatencyHistogram const &other );
+
+   /*! @brief Remove all the recorded values. */
+   void reset();
+
+   /*! @brief Get the number of recorded values.
+    *  @return The number of recorded values. */
+   uint64_t get_count() const
+   {
+      return count;
+   }
+
+   /*! @brief Get the minimum recorded value.
+    *  @return The minimum value, or zero if no values were recorded. */
+   int64_t get_min() const
+   {
+      return min;
+   }
+
+   /*! @brief Get the maximum recorded value.
+    *  @return The maximum value, or zero if no values were recorded. */
+   int64_t get_max() const
+   {
+      return max;
+   }
+
+   /*! @brief Get the mean of the recorded values.
+    *  @return The mean value, or zero if no values were recorded. */
+   double get_mean() const
+   {
+      return ( count > 0 ) ? ( sum / (double)count ) : 0.0;
+   }
+
+   /*! @brief Get the value at a percentile, resolved to the highest value
+    *  of its bucket and limited to the maximum recorded value.
+    *  @return The value at the percentile, or zero if no values were recorded.
+    *  @param percentile The percentile from 0 to 100. */
+   int64_t get_percentile( double const percentile ) const;
+
+   /*! @brief Returns a string summary of the percentiles.
+    *  @return The summary.
+    *  @param units Name of the units of the reported values.
+    *  @param scale Scale factor from the recorded to the reported values. */
+   std::string const to_string( std::string const &units,
+                                double const       scale = 1.0 ) const;
+
+   /*! @brief Get the number of histogram buckets.
+    *  @return The number of buckets. */
+   static unsigned int get_bucket_count();
+
+  protected:
+   /*! @brief Get the bucket index for a value.
+    *  @return The bucket index.
+    *  @param value The non-negative value. */
+   static unsigned int bucket_index( int64_t const value );
+
+   /*! @brief Get the highest value of a bucket.
+    *  @return The highest value that maps to the bucket.
+    *  @param index The bucket index. */
+   static int64_t bucket_highest_value( unsigned int const index );
+
+   std::vector< uint64_t > counts; ///< @trick_io{**} Number of values recorded in each bucket.
+
+   uint64_t count; ///< @trick_units{count} Number of recorded values.
+   int64_t  min;   ///< @trick_units{--} Minimum recorded value.
+   int64_t  max;   ///< @trick_units{--} Maximum recorded value.
+   double   sum;   ///< @trick_units{--} Sum of the recorded values.
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_LATENCY_HISTOGRAM_HH: Do NOT put anything after this line!
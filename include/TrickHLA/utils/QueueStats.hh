@@ -0,0 +1,171 @@
+/*!
+@file TrickHLA/utils/QueueStats.hh
+@ingroup TrickHLA
+@brief This class tracks the depth, high-water mark, enqueue and dequeue
+rates and the age of the oldest item of a queue.
+
+The owner of the queue calls record_depth() each time it changes the queue,
+with the mutex of the queue locked. A main thread job calls refresh() every
+frame so the rates and the age of the oldest item keep updating while the
+queue is idle. A named queue warns when its depth or the age of its oldest
+item first exceeds the DebugHandler::queue_depth_warning or
+DebugHandler::queue_age_warning threshold, and again after it has dropped
+back under both thresholds. The warning is published from refresh() so it is
+never published from an RTI callback thread.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/utils/QueueStats.cpp}
+@trick_link_dependency{../../../source/TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{../../../source/TrickHLA/utils/MutexLock.cpp}
+@trick_link_dependency{../../../source/TrickHLA/utils/MutexProtection.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_QUEUE_STATS_HH
+#define TRICKHLA_QUEUE_STATS_HH
+
+// System includes.
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// TrickHLA includes.
+#include "TrickHLA/utils/MutexLock.hh"
+
+namespace TrickHLA
+{
+
+class QueueStats
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__QueueStats();
+
+   //------------------------- TRICK LOGGABLE OUTPUTS -------------------------
+  public:
+   uint64_t depth;           ///< @trick_units{count} Number of items in the queue.
+   uint64_t high_water_mark; ///< @trick_units{count} Largest number of items that were in the queue.
+   uint64_t enqueue_count;   ///< @trick_units{count} Number of items added to the queue.
+   uint64_t dequeue_count;   ///< @trick_units{count} Number of items removed from the queue.
+
+   double enqueue_rate;    ///< @trick_units{1/s} Items added per second over the last rate period.
+   double dequeue_rate;    ///< @trick_units{1/s} Items removed per second over the last rate period.
+   double oldest_item_age; ///< @trick_units{s} Age of the oldest item in the queue.
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLA QueueStats class. */
+   QueueStats();
+   /*! @brief Destructor for the TrickHLA QueueStats class. */
+   virtual ~QueueStats();
+
+   /*! @brief Set the name used in the queue warnings, where an unnamed queue
+    * is not checked against the warning thresholds.
+    *  @param queue_name Name of the queue. */
+   void set_name( std::string const &queue_name )
+   {
+      this->name = queue_name;
+   }
+
+   /*! @brief Get the name of the queue.
+    *  @return The name of the queue. */
+   std::string const &get_name() const
+   {
+      return name;
+   }
+
+   /*! @brief Record the new depth of the queue after items were added or
+    * removed.
+    *  @param new_depth   The number of items in the queue.
+    *  @param oldest_time Monotonic time in nanoseconds the oldest item was
+    *  added, or zero to use the time the queue last became non-empty.
+    *  @param now         The current monotonic time in nanoseconds. */
+   void record_depth( std::size_t const new_depth,
+                      int64_t const     oldest_time,
+                      int64_t const     now );
+
+   /*! @brief Record the new depth of the queue after items were added or
+    * removed, using the time the queue last became non-empty as the time of
+    * the oldest item.
+    *  @param new_depth The number of items in the queue. */
+   void record_depth( std::size_t const new_depth )
+   {
+      record_depth( new_depth, 0, monotonic_time() );
+   }
+
+   /*! @brief Update the rates and the age of the oldest item to the current
+    * time, and publish a pending warning, from a main thread job. */
+   void refresh();
+
+   /*! @brief Returns a one line summary of the queue statistics.
+    *  @return The summary. */
+   std::string const to_string() const;
+
+   /*! @brief Get the monotonic time used for the item ages.
+    *  @return The monotonic time in nanoseconds. */
+   static int64_t monotonic_time();
+
+  protected:
+   /*! @brief Update the age of the oldest item and the rates, where the
+    * caller must hold the mutex.
+    *  @param now The current monotonic time in nanoseconds. */
+   void update( int64_t const now );
+
+   /*! @brief Flag a pending warning if the queue first exceeds a threshold,
+    * where the caller must hold the mutex. */
+   void check_thresholds();
+
+   std::string name; ///< @trick_units{--} Name of the queue in the warnings.
+
+   int64_t  nonempty_since;     ///< @trick_units{--} Monotonic time in nanoseconds the queue last became non-empty.
+   int64_t  oldest_item_time;   ///< @trick_units{--} Monotonic time in nanoseconds the oldest item was added.
+   int64_t  rate_start_time;    ///< @trick_units{--} Monotonic time in nanoseconds the rate period started.
+   uint64_t rate_start_enqueue; ///< @trick_units{count} Enqueue count at the start of the rate period.
+   uint64_t rate_start_dequeue; ///< @trick_units{count} Dequeue count at the start of the rate period.
+
+   bool     warning_active;  ///< @trick_units{--} True while the queue is over a warning threshold.
+   bool     warning_pending; ///< @trick_units{--} True if a warning is waiting to be published by refresh().
+   uint64_t warning_depth;   ///< @trick_units{count} Depth of the queue when the pending warning was flagged.
+   double   warning_age;     ///< @trick_units{s} Age of the oldest item when the pending warning was flagged.
+
+   MutexLock mutex; ///< @trick_units{--} Mutex for the statistics, which are recorded from the RTI callbacks.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for QueueStats class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   QueueStats( QueueStats const &rhs );
+   /*! @brief Assignment operator for QueueStats class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   QueueStats &operator=( QueueStats const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_QUEUE_STATS_HH: Do NOT put anything after this line!
@@ -0,0 +1,150 @@
+/*!
+@file TrickHLA/utils/StartupProfiler.hh
+@ingroup TrickHLA
+@brief TrickHLA startup profiler that records the wall clock begin and end
+times of the initialization phases, RTI calls and wait loops, and writes them
+as a Chrome trace-event JSON file.
+
+The times are wall clock times in microseconds since the Unix epoch, so the
+trace files of the federates in a federation can be loaded together into one
+timeline, for example with the chrome://tracing or Perfetto viewers.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/utils/StartupProfiler.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+*/
+
+#ifndef TRICKHLA_STARTUP_PROFILER_HH
+#define TRICKHLA_STARTUP_PROFILER_HH
+
+// System includes.
+#include <cstdint>
+#include <string>
+
+namespace TrickHLA
+{
+
+class StartupProfiler
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__StartupProfiler();
+
+  public:
+   /*! @brief Destructor for the TrickHLA StartupProfiler class. */
+   virtual ~StartupProfiler()
+   {
+      return;
+   }
+
+   /*! @brief Start recording the startup events.
+    *  @param process_name Name shown for this federate in the timeline.
+    *  @param file_name    Trace file to write when the startup completes. */
+   static void start( std::string const &process_name,
+                      std::string const &file_name );
+
+   /*! @brief Determine if the startup events are being recorded, which is
+    * safe to call from the RTI callback thread.
+    *  @return True if the startup events are being recorded. */
+   static bool is_recording();
+
+   /*! @brief Record a completed event.
+    *  @param name        Name of the event.
+    *  @param category    Category of the event, such as phase, rti or wait.
+    *  @param begin_micros Wall clock begin time in microseconds.
+    *  @param end_micros   Wall clock end time in microseconds. */
+   static void add_event( char const   *name,
+                          char const   *category,
+                          int64_t const begin_micros,
+                          int64_t const end_micros );
+
+   /*! @brief Write the recorded events to the trace file and stop recording.
+    *  @return True if the trace file was written. */
+   static bool finish();
+
+   /*! @brief Get the wall clock time.
+    *  @return Wall clock time in microseconds since the Unix epoch. */
+   static int64_t wall_time();
+
+  private:
+   /*! @brief Default constructor for the TrickHLA StartupProfiler class. */
+   StartupProfiler();
+
+   /*! @brief Copy constructor for StartupProfiler class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   StartupProfiler( StartupProfiler const &rhs );
+
+   /*! @brief Assignment operator for StartupProfiler class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   StartupProfiler &operator=( StartupProfiler const &rhs );
+};
+
+class StartupProfilerScope
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__StartupProfilerScope();
+
+  public:
+   /*! @brief Begin a startup event that ends when this scope goes away.
+    *  @param name     Name of the event, which must be a string literal.
+    *  @param category Category of the event, which must be a string literal. */
+   StartupProfilerScope( char const *name, char const *category );
+
+   /*! @brief Destructor for the TrickHLA StartupProfilerScope class, which
+    *  records the event. */
+   virtual ~StartupProfilerScope();
+
+  protected:
+   char const *name;         ///< @trick_io{**} Name of the event.
+   char const *category;     ///< @trick_io{**} Category of the event.
+   int64_t     begin_micros; ///< @trick_units{us} Wall clock begin time, or zero if not recording.
+
+  private:
+   // Do not allow the default constructor, copy constructor or assignment operator.
+   /*! @brief Default constructor for the TrickHLA StartupProfilerScope class. */
+   StartupProfilerScope();
+
+   /*! @brief Copy constructor for StartupProfilerScope class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   StartupProfilerScope( StartupProfilerScope const &rhs );
+
+   /*! @brief Assignment operator for StartupProfilerScope class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   StartupProfilerScope &operator=( StartupProfilerScope const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_STARTUP_PROFILER_HH: Do NOT put anything after this line!
@@ -0,0 +1,150 @@
+/*!
+@file TrickHLA/utils/TrafficCounters.hh
+@ingroup TrickHLA
+@brief This class counts the updates, items and encoded bytes sent and
+received for an object, attribute or interaction.
+
+The counters are plain integers so that Trick can log and view them, but they
+are only updated with relaxed atomic operations because the receive side is
+counted on the RTI callback thread while the Trick threads read them. The
+counters do not order any other memory accesses.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/utils/TrafficCounters.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_TRAFFIC_COUNTERS_HH
+#define TRICKHLA_TRAFFIC_COUNTERS_HH
+
+// System includes.
+#include <cstdint>
+#include <string>
+
+namespace TrickHLA
+{
+
+class TrafficCounters
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__TrafficCounters();
+
+   //------------------------- TRICK LOGGABLE OUTPUTS -------------------------
+  public:
+   uint64_t send_updates; ///< @trick_units{count} Number of updates or interactions sent.
+   uint64_t send_items;   ///< @trick_units{count} Number of attributes or parameters sent.
+   uint64_t send_bytes;   ///< @trick_units{count} Number of encoded bytes sent.
+
+   uint64_t receive_updates; ///< @trick_units{count} Number of updates or interactions received.
+   uint64_t receive_items;   ///< @trick_units{count} Number of attributes or parameters received.
+   uint64_t receive_bytes;   ///< @trick_units{count} Number of encoded bytes received.
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLA TrafficCounters class. */
+   TrafficCounters();
+   /*! @brief Destructor for the TrickHLA TrafficCounters class. */
+   virtual ~TrafficCounters();
+
+   /*! @brief Count a sent update.
+    *  @param items Number of attributes or parameters in the update.
+    *  @param bytes Number of encoded bytes in the update. */
+   void add_sent( uint64_t const items, uint64_t const bytes )
+   {
+      __atomic_fetch_add( &send_updates, 1, __ATOMIC_RELAXED );
+      __atomic_fetch_add( &send_items, items, __ATOMIC_RELAXED );
+      __atomic_fetch_add( &send_bytes, bytes, __ATOMIC_RELAXED );
+   }
+
+   /*! @brief Count a received update.
+    *  @param items Number of attributes or parameters in the update.
+    *  @param bytes Number of encoded bytes in the update. */
+   void add_received( uint64_t const items, uint64_t const bytes )
+   {
+      __atomic_fetch_add( &receive_updates, 1, __ATOMIC_RELAXED );
+      __atomic_fetch_add( &receive_items, items, __ATOMIC_RELAXED );
+      __atomic_fetch_add( &receive_bytes, bytes, __ATOMIC_RELAXED );
+   }
+
+   /*! @brief Get the number of updates sent.
+    *  @return The number of updates sent. */
+   uint64_t get_send_updates() const
+   {
+      return __atomic_load_n( &send_updates, __ATOMIC_RELAXED );
+   }
+
+   /*! @brief Get the number of updates received.
+    *  @return The number of updates received. */
+   uint64_t get_receive_updates() const
+   {
+      return __atomic_load_n( &receive_updates, __ATOMIC_RELAXED );
+   }
+
+   /*! @brief Get the number of encoded bytes sent.
+    *  @return The number of bytes sent. */
+   uint64_t get_send_bytes() const
+   {
+      return __atomic_load_n( &send_bytes, __ATOMIC_RELAXED );
+   }
+
+   /*! @brief Get the number of encoded bytes received.
+    *  @return The number of bytes received. */
+   uint64_t get_receive_bytes() const
+   {
+      return __atomic_load_n( &receive_bytes, __ATOMIC_RELAXED );
+   }
+
+   /*! @brief Get the number of encoded bytes sent and received.
+    *  @return The total number of bytes. */
+   uint64_t get_total_bytes() const
+   {
+      return get_send_bytes() + get_receive_bytes();
+   }
+
+   /*! @brief Reset all the counters to zero. */
+   void reset();
+
+   /*! @brief Returns a one line summary of the counters.
+    *  @return The summary. */
+   std::string const to_string() const;
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for TrafficCounters class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   TrafficCounters( TrafficCounters const &rhs );
+   /*! @brief Assignment operator for TrafficCounters class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   TrafficCounters &operator=( TrafficCounters const &rhs );
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_TRAFFIC_COUNTERS_HH: Do NOT put anything after this line!
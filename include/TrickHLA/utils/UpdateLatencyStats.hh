@@ -0,0 +1,185 @@
+/*!
+@file TrickHLA/utils/UpdateLatencyStats.hh
+@ingroup TrickHLA
+@brief This class measures the end-to-end latency of the attribute updates of
+an object instance using a compact header in the HLA user supplied tag.
+
+When enabled, the sending federate puts a 24 byte header in the user supplied
+tag of each cyclic attribute update: a magic number, a federate ID derived
+from the federate name, a per-object sequence number and the wall clock
+(CLOCK_REALTIME) send time. When enabled, the receiving federate uses the
+header to measure the network latency from the send to the reflect callback
+and the dropped and out-of-order updates, per object and per sending peer.
+It also measures the decode-to-use latency from the reflect callback to the
+decode of the update into the simulation data. The network latency is only
+meaningful if the clocks of the federate hosts are synchronized, such as with
+NTP or PTP.
+
+The header is encoded in network byte order.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLA}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/utils/UpdateLatencyStats.cpp}
+@trick_link_dependency{../../../source/TrickHLA/utils/LatencyHistogram.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_UPDATE_LATENCY_STATS_HH
+#define TRICKHLA_UPDATE_LATENCY_STATS_HH
+
+// System includes.
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string>
+
+// TrickHLA includes.
+#include "TrickHLA/utils/LatencyHistogram.hh"
+
+// Size of the latency header in the user supplied tag in bytes.
+#define THLA_UPDATE_LATENCY_TAG_SIZE 24
+
+namespace TrickHLA
+{
+
+class UpdateLatencyStats
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLA__UpdateLatencyStats();
+
+  public:
+   /*! @brief Latency statistics of the updates received from one peer. */
+   struct PeerStats {
+      uint64_t         last_sequence; ///< Last received sequence number.
+      uint64_t         received;      ///< Number of tagged updates received.
+      uint64_t         dropped;       ///< Number of sequence numbers skipped.
+      uint64_t         out_of_order;  ///< Number of updates older than the last received.
+      LatencyHistogram network;       ///< Network latency in microseconds.
+
+      PeerStats()
+         : last_sequence( 0 ),
+           received( 0 ),
+           dropped( 0 ),
+           out_of_order( 0 ),
+           network()
+      {
+         return;
+      }
+   };
+
+   //----------------------------- USER VARIABLES -----------------------------
+   // The variables below this point are configured by the user in either the
+   // input or modified-data files.
+  public:
+   bool enabled; ///< @trick_units{--} Send the latency header with the cyclic updates and measure the received ones, default: false. Read once at initialization.
+
+   //------------------------- TRICK LOGGABLE OUTPUTS -------------------------
+  public:
+   uint64_t received_count;     ///< @trick_units{count} Number of tagged updates received.
+   uint64_t untagged_count;     ///< @trick_units{count} Number of updates received without a latency header.
+   uint64_t dropped_count;      ///< @trick_units{count} Number of skipped sequence numbers over all peers.
+   uint64_t out_of_order_count; ///< @trick_units{count} Number of out-of-order updates over all peers.
+
+   double last_network_latency; ///< @trick_units{us} Network latency of the last tagged update.
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLA UpdateLatencyStats class. */
+   UpdateLatencyStats();
+   /*! @brief Destructor for the TrickHLA UpdateLatencyStats class. */
+   virtual ~UpdateLatencyStats();
+
+   // Use implicit copy constructor and assignment operator.
+
+   /*! @brief Latch the enabled flag, so that changing it at runtime can not
+    * misalign the pending reflect times with the queued attribute values. */
+   void initialize();
+
+   /*! @brief Determine if the latency header is sent and measured.
+    *  @return True if enabled at initialization. */
+   bool is_enabled() const
+   {
+      return measuring;
+   }
+
+   /*! @brief Build the latency header for the next sent update.
+    *  @return The header, which is THLA_UPDATE_LATENCY_TAG_SIZE bytes.
+    *  @param federate_name Name of the sending federate. */
+   unsigned char const *build_send_tag( std::string const &federate_name );
+
+   /*! @brief Measure a reflected update, which must be called with the
+    * receive mutex of the object locked.
+    *  @param tag      The user supplied tag data.
+    *  @param tag_size The user supplied tag size in bytes. */
+   void reflected( void const *tag, std::size_t const tag_size );
+
+   /*! @brief Measure the decode-to-use latency of the oldest reflected update,
+    * which must be called with the receive mutex of the object locked. */
+   void decoded();
+
+   /*! @brief Discard the reflected updates that will not be decoded. */
+   void clear_pending();
+
+   /*! @brief Merge the statistics of another object, such as for a per
+    * object class summary.
+    *  @param other The statistics to merge. */
+   void merge( UpdateLatencyStats const &other );
+
+   /*! @brief Returns a string summary of the latency statistics.
+    *  @return The summary. */
+   std::string const to_string() const;
+
+   /*! @brief Get the federate ID sent in the header for a federate name.
+    *  @return The 32 bit FNV-1a hash of the name.
+    *  @param federate_name The federate name. */
+   static uint32_t to_federate_id( std::string const &federate_name );
+
+   /*! @brief Set the federate name shown for a federate ID in the summary.
+    *  @param federate_name The federate name. */
+   static void add_peer_name( std::string const &federate_name );
+
+  protected:
+   bool measuring; ///< @trick_units{--} The enabled flag latched at initialization.
+
+   uint32_t send_federate_id; ///< @trick_units{--} Federate ID of the sending federate.
+   uint64_t send_sequence;    ///< @trick_units{--} Sequence number of the last sent update.
+
+   unsigned char send_tag[THLA_UPDATE_LATENCY_TAG_SIZE]; ///< @trick_io{**} Latency header of the last sent update.
+
+   std::deque< int64_t > pending_reflect_times; ///< @trick_io{**} Monotonic reflect times of the updates waiting to be decoded.
+
+   std::map< uint32_t, PeerStats > peers; ///< @trick_io{**} Statistics of each sending peer.
+
+   LatencyHistogram decode_to_use; ///< @trick_units{--} Decode-to-use latency in microseconds.
+};
+
+} // namespace TrickHLA
+
+#endif // TRICKHLA_UPDATE_LATENCY_STATS_HH: Do NOT put anything after this line!
@@ -0,0 +1,123 @@
+/*!
+@ingroup EntityPool
+@file models/EntityPool/include/EntitySpawner.hh
+@brief This class creates and deletes pooled entity instances at runtime and
+checks the pooled entity instances created by the other federates.
+
+The spawner keeps up to max_live locally created instances of the object pool
+for its FOM class, creating one every spawn_period and deleting each one
+after its lifetime. Every frame it checks the data of the live remotely
+created instances and records the largest number of live instances and
+allocated slots, which it reports at shutdown.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{../../../source/TrickHLA/ObjectPool.cpp}
+@trick_link_dependency{EntityPool/src/EntitySpawner.cpp}
+@trick_link_dependency{EntityPool/src/PoolEntity.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_ENTITY_SPAWNER_HH
+#define TRICKHLA_MODEL_ENTITY_SPAWNER_HH
+
+// System includes.
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// TrickHLA includes.
+#include "TrickHLA/Manager.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/ObjectPool.hh"
+
+namespace TrickHLAModel
+{
+
+class EntitySpawner
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__EntitySpawner();
+
+  public:
+   std::string FOM_name; ///< @trick_units{--} FOM name of the object class of the object pool.
+
+   int    max_live;     ///< @trick_units{count} Number of locally created instances to keep alive, zero to only receive.
+   double spawn_period; ///< @trick_units{s} Time between the locally created instances.
+   double lifetime;     ///< @trick_units{s} Time each locally created instance lives before it is deleted.
+
+   int     created_count;  ///< @trick_units{count} Number of locally created instances.
+   int     deleted_count;  ///< @trick_units{count} Number of locally deleted instances.
+   int     max_live_count; ///< @trick_units{count} Largest number of live instances in the pool.
+   int     max_slot_count; ///< @trick_units{count} Largest number of allocated slots in the pool.
+   int64_t verified_count; ///< @trick_units{count} Number of remote instance frames with intact data.
+   int64_t error_count;    ///< @trick_units{count} Number of remote instance frames with corrupted data.
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLAModel EntitySpawner class. */
+   EntitySpawner();
+   /*! @brief Destructor for the TrickHLAModel EntitySpawner class. */
+   virtual ~EntitySpawner();
+
+   /*! @brief Find the object pool for the FOM class.
+    *  @param mgr The TrickHLA Manager with the object pool. */
+   void initialize( TrickHLA::Manager *mgr );
+
+   /*! @brief Create, update and delete the local instances and check the
+    * remote instances.
+    *  @param sim_time Simulation time in seconds. */
+   void update( double const sim_time );
+
+   /*! @brief Report the instance counts and the data check totals. */
+   void report() const;
+
+  protected:
+   TrickHLA::ObjectPool *pool; ///< @trick_units{--} Object pool of the FOM class.
+
+   double next_spawn_time; ///< @trick_units{s} Simulation time of the next locally created instance.
+
+   std::vector< std::pair< TrickHLA::Object *, double > > spawned; ///< @trick_io{**} Live locally created instances and their creation times.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for EntitySpawner class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   EntitySpawner( EntitySpawner const &rhs );
+   /*! @brief Assignment operator for EntitySpawner class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   EntitySpawner &operator=( EntitySpawner const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_ENTITY_SPAWNER_HH: Do NOT put anything after this line!
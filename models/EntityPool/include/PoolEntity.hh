@@ -0,0 +1,85 @@
+/*!
+@ingroup EntityPool
+@file models/EntityPool/include/PoolEntity.hh
+@brief This class holds the simulation data of one pooled entity instance.
+
+The object pool allocates one of these for each instance it binds to a slot.
+The position is a pattern of the age of the entity, so the receiver can check
+each update.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{EntityPool/src/PoolEntity.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_POOL_ENTITY_HH
+#define TRICKHLA_MODEL_POOL_ENTITY_HH
+
+namespace TrickHLAModel
+{
+
+class PoolEntity
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__PoolEntity();
+
+  public:
+   double time;        ///< @trick_units{s} Simulation time of the update.
+   double position[3]; ///< @trick_units{m} Position, which is the pattern set by set_age().
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLAModel PoolEntity class. */
+   PoolEntity();
+   /*! @brief Destructor for the TrickHLAModel PoolEntity class. */
+   virtual ~PoolEntity();
+
+   /*! @brief Set the time and the position pattern for the age of the entity.
+    *  @param sim_time Simulation time of the update in seconds.
+    *  @param age      Age of the entity in seconds. */
+   void set_age( double const sim_time, double const age );
+
+   /*! @brief Check the position holds the pattern.
+    *  @return True if the pattern is intact. */
+   bool verify() const;
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for PoolEntity class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   PoolEntity( PoolEntity const &rhs );
+   /*! @brief Assignment operator for PoolEntity class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   PoolEntity &operator=( PoolEntity const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_POOL_ENTITY_HH: Do NOT put anything after this line!
@@ -0,0 +1,182 @@
+/*!
+@ingroup EntityPool
+@file models/EntityPool/src/EntitySpawner.cpp
+@brief This class creates and deletes pooled entity instances at runtime and
+checks the pooled entity instances created by the other federates.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Manager.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{../../../source/TrickHLA/ObjectPool.cpp}
+@trick_link_dependency{EntityPool/src/EntitySpawner.cpp}
+@trick_link_dependency{EntityPool/src/PoolEntity.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System includes.
+#include <cstdint>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Trick includes.
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+
+// TrickHLA includes.
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Manager.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/ObjectPool.hh"
+
+// Model includes.
+#include "EntityPool/include/EntitySpawner.hh"
+#include "EntityPool/include/PoolEntity.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace TrickHLAModel;
+
+/*!
+ * @job_class{initialization}
+ */
+EntitySpawner::EntitySpawner()
+   : FOM_name(),
+     max_live( 0 ),
+     spawn_period( 1.0 ),
+     lifetime( 5.0 ),
+     created_count( 0 ),
+     deleted_count( 0 ),
+     max_live_count( 0 ),
+     max_slot_count( 0 ),
+     verified_count( 0 ),
+     error_count( 0 ),
+     pool( NULL ),
+     next_spawn_time( 0.0 ),
+     spawned()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+EntitySpawner::~EntitySpawner()
+{
+   spawned.clear();
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void EntitySpawner::initialize(
+   Manager *mgr )
+{
+   if ( mgr != NULL ) {
+      this->pool = mgr->get_object_pool( FOM_name );
+   }
+   if ( pool == NULL ) {
+      ostringstream errmsg;
+      errmsg << "EntitySpawner::initialize():" << __LINE__
+             << " ERROR: There is no object pool for the FOM class '"
+             << FOM_name << "'. Please check your input files to make sure"
+             << " THLA.manager.object_pools has a pool for it." << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   if ( ( max_live > 0 ) && ( ( spawn_period <= 0.0 ) || ( lifetime <= 0.0 ) ) ) {
+      ostringstream errmsg;
+      errmsg << "EntitySpawner::initialize():" << __LINE__
+             << " ERROR: The spawn_period " << spawn_period << " and the"
+             << " lifetime " << lifetime << " must be greater than zero!" << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+}
+
+/*!
+ * @details A deleted instance stays live in the pool until the manager
+ * recycles its slot at the start of the next frame.
+ * @job_class{scheduled}
+ */
+void EntitySpawner::update(
+   double const sim_time )
+{
+   // Delete the local instances that reached the end of their lifetime.
+   for ( size_t k = spawned.size(); k > 0; --k ) {
+      if ( ( sim_time - spawned[k - 1].second ) >= lifetime ) {
+         pool->delete_local_instance( spawned[k - 1].first );
+         spawned.erase( spawned.begin() + ( k - 1 ) );
+         ++deleted_count;
+      }
+   }
+
+   // Create a new local instance every spawn period.
+   if ( ( (int)spawned.size() < max_live ) && ( sim_time >= next_spawn_time ) ) {
+      spawned.push_back( make_pair( pool->create_local_instance(), sim_time ) );
+      this->next_spawn_time = sim_time + spawn_period;
+      ++created_count;
+   }
+
+   // Set the data the local instances send this frame.
+   for ( size_t k = 0; k < spawned.size(); ++k ) {
+      PoolEntity *entity = static_cast< PoolEntity * >( pool->get_instance_data( spawned[k].first ) );
+      if ( entity != NULL ) {
+         entity->set_age( sim_time, sim_time - spawned[k].second );
+      }
+   }
+
+   // Check the data received for the remote instances.
+   unsigned int const live_count = pool->get_live_count();
+   for ( unsigned int k = 0; k < live_count; ++k ) {
+      Object *obj = pool->get_live_object( k );
+      if ( ( obj == NULL ) || obj->is_create_HLA_instance() ) {
+         continue;
+      }
+      PoolEntity const *entity = static_cast< PoolEntity * >( pool->get_instance_data( obj ) );
+      if ( ( entity != NULL ) && entity->verify() ) {
+         ++verified_count;
+      } else {
+         ++error_count;
+      }
+   }
+
+   if ( (int)live_count > max_live_count ) {
+      this->max_live_count = live_count;
+   }
+   if ( (int)pool->get_slot_count() > max_slot_count ) {
+      this->max_slot_count = pool->get_slot_count();
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void EntitySpawner::report() const
+{
+   ostringstream msg;
+   msg << "EntitySpawner::report():" << __LINE__ << endl
+       << "  FOM-class:" << FOM_name << endl
+       << "  created:" << created_count << " deleted:" << deleted_count << endl
+       << "  max-live:" << max_live_count << " max-slots:" << max_slot_count << endl
+       << "  remote-frames-verified:" << verified_count
+       << " remote-frames-corrupted:" << error_count << endl;
+   message_publish( ( error_count > 0 ) ? MSG_WARNING : MSG_NORMAL, msg.str().c_str() );
+}
@@ -0,0 +1,73 @@
+/*!
+@ingroup EntityPool
+@file models/EntityPool/src/PoolEntity.cpp
+@brief This class holds the simulation data of one pooled entity instance.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{EntityPool/src/PoolEntity.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// Model includes.
+#include "EntityPool/include/PoolEntity.hh"
+
+using namespace TrickHLAModel;
+
+/*!
+ * @job_class{initialization}
+ */
+PoolEntity::PoolEntity()
+   : time( 0.0 )
+{
+   position[0] = 0.0;
+   position[1] = 0.0;
+   position[2] = 0.0;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+PoolEntity::~PoolEntity()
+{
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void PoolEntity::set_age(
+   double const sim_time,
+   double const age )
+{
+   this->time  = sim_time;
+   position[0] = age;
+   position[1] = 2.0 * age;
+   position[2] = -age;
+}
+
+/*!
+ * @details The pattern only uses exact binary multiples, so it compares
+ * exactly after the round trip through the encoders.
+ * @job_class{scheduled}
+ */
+bool PoolEntity::verify() const
+{
+   return ( ( position[1] == ( 2.0 * position[0] ) )
+            && ( position[2] == -position[0] ) );
+}
@@ -0,0 +1,137 @@
+/*!
+@ingroup LagComp
+@file models/LagComp/include/LagCompTest.hh
+@brief This is a container class for testing the accuracy of the SpaceFOM
+closed-form lag compensation against the integrator based lag compensation.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{LagComp/src/LagCompTest.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_LAG_COMP_TEST_HH
+#define TRICKHLA_MODEL_LAG_COMP_TEST_HH
+
+// SpaceFOM includes.
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
+
+namespace TrickHLAModel
+{
+
+class LagCompTest
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__LagCompTest();
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLAModel LagCompTest class. */
+   LagCompTest();
+   /*! @brief Destructor for the TrickHLAModel LagCompTest class. */
+   virtual ~LagCompTest();
+
+   /*! @brief Compare the PhysicalEntity closed-form lag compensation with the
+    *  integrator based lag compensation over the configured interval. */
+   void physical_entity_test();
+
+   /*! @brief Compare the RefFrame closed-form lag compensation with the
+    *  integrator based lag compensation over the configured interval. */
+   void ref_frame_test();
+
+   /*! @brief Compare the PhysicalEntity closed-form lag compensation with the
+    *  adaptive step integrator based lag compensation over the configured
+    *  interval and report the integration step counts. */
+   void adaptive_step_test();
+
+   /*! @brief Compare the state interpolated from a received state history
+    *  with the closed-form solution at a time between two history samples. */
+   void history_test();
+
+   /*! @brief Check that only the closed-form lag compensation can be batched,
+    *  compare the batched propagation of many states in one pass with the
+    *  closed-form lag compensation of each instance and check that a state
+    *  received through the batch reaches the working data. */
+   void batch_test();
+
+  public:
+   SpaceFOM::SpaceTimeCoordinateData init_state; ///< @trick_units{--} Initial state to compensate.
+
+   double accel[3];     ///< @trick_units{m/s2} Entity acceleration vector.
+   double ang_accel[3]; ///< @trick_units{rad/s2} Entity rotational acceleration vector.
+
+   double compensate_dt; ///< @trick_units{s} Lag compensation interval.
+   double integ_dt;      ///< @trick_units{s} Integrator step size for the reference solution.
+   double integ_tol;     ///< @trick_units{--} Local error tolerance for the adaptive step integrator.
+
+   int    history_size; ///< @trick_units{--} Number of samples in the state history.
+   double history_dt;   ///< @trick_units{s} Time between state history samples.
+
+   double pos_tol;     ///< @trick_units{m} Position error tolerance.
+   double vel_tol;     ///< @trick_units{m/s} Velocity error tolerance.
+   double att_tol;     ///< @trick_units{rad} Attitude error tolerance.
+   double ang_vel_tol; ///< @trick_units{rad/s} Angular velocity error tolerance.
+
+   int timing_count; ///< @trick_units{--} Number of compensations used to time each method.
+
+   int fail_count; ///< @trick_units{--} Number of failed test comparisons.
+
+  protected:
+   /*! @brief Compare the two compensated states and report the results.
+    *  @return True if the states agree within the tolerances.
+    *  @param test_name   Name of the test.
+    *  @param ref_method  Name of the reference compensation method.
+    *  @param integ       State compensated with the reference method.
+    *  @param method      Name of the compensation method under test.
+    *  @param closed      State compensated with the method under test.
+    *  @param integ_time  Wall clock time per reference compensation.
+    *  @param closed_time Wall clock time per compensation of the method under test. */
+   bool compare( char const                              *test_name,
+                 char const                              *ref_method,
+                 SpaceFOM::SpaceTimeCoordinateData const &integ,
+                 char const                              *method,
+                 SpaceFOM::SpaceTimeCoordinateData const &closed,
+                 double const                             integ_time,
+                 double const                             closed_time );
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for LagCompTest class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   LagCompTest( LagCompTest const &rhs );
+   /*! @brief Assignment operator for LagCompTest class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   LagCompTest &operator=( LagCompTest const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_LAG_COMP_TEST_HH: Do NOT put anything after this line!
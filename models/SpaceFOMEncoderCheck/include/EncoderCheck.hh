@@ -0,0 +1,119 @@
+/*!
+@ingroup SpaceFOMEncoderCheck
+@file models/SpaceFOMEncoderCheck/include/EncoderCheck.hh
+@brief This is a container class for checking that the SpaceFOM
+SpaceTimeCoordinateEncoder and QuaternionEncoder produce the same bytes as
+the HLAfixedRecord encoding of the SpaceFOM data types, without an RTI.
+
+For each test case the check encodes the same data with the IEEE 1516
+HLAfixedRecord, HLAfixedArray and HLAfloat64LE encoding helpers, which is
+the encoding these encoders used before they pushed the little-endian
+values straight into the buffer, and compares the bytes. It then decodes
+the reference bytes with the encoder and compares the decoded values bit
+for bit with the encoded values. Finally it truncates the received data and
+checks that the decoder ignores the short record instead of reading past
+the end of the data.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{SpaceFOMEncoderCheck/src/EncoderCheck.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_ENCODER_CHECK_HH
+#define TRICKHLA_MODEL_ENCODER_CHECK_HH
+
+// System includes.
+#include <cstddef>
+
+// SpaceFOM includes.
+#include "SpaceFOM/QuaternionData.hh"
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
+
+namespace TrickHLAModel
+{
+
+class EncoderCheck
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__EncoderCheck();
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLAModel EncoderCheck class. */
+   EncoderCheck();
+   /*! @brief Destructor for the TrickHLAModel EncoderCheck class. */
+   virtual ~EncoderCheck();
+
+   /*! @brief Run the checks for all the test cases and report the number
+    *  of failed checks. */
+   void run();
+
+   //------------------------- TRICK LOGGABLE OUTPUTS -------------------------
+  public:
+   int check_count; ///< @trick_units{count} Number of checks run.
+   int fail_count;  ///< @trick_units{count} Number of failed checks.
+
+  protected:
+   /*! @brief Check the space-time coordinate encoder for one test case.
+    *  @param stc_data Space-time coordinate data to encode. */
+   void check_space_time_coordinate( SpaceFOM::SpaceTimeCoordinateData const &stc_data );
+
+   /*! @brief Check the attitude quaternion encoder for one test case.
+    *  @param quat_data Attitude quaternion data to encode. */
+   void check_quaternion( SpaceFOM::QuaternionData const &quat_data );
+
+   /*! @brief Count a check and report it if the bytes do not match.
+    *  @return True if the bytes match.
+    *  @param what          Description of the check.
+    *  @param expected      Expected bytes.
+    *  @param expected_size Number of expected bytes.
+    *  @param actual        Actual bytes.
+    *  @param actual_size   Number of actual bytes. */
+   bool compare( char const        *what,
+                 void const        *expected,
+                 std::size_t const  expected_size,
+                 void const        *actual,
+                 std::size_t const  actual_size );
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for EncoderCheck class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   EncoderCheck( EncoderCheck const &rhs );
+   /*! @brief Assignment operator for EncoderCheck class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   EncoderCheck &operator=( EncoderCheck const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_ENCODER_CHECK_HH: Do NOT put anything after this line!
@@ -0,0 +1,410 @@
+/*!
+@ingroup SpaceFOMEncoderCheck
+@file models/SpaceFOMEncoderCheck/src/EncoderCheck.cpp
+@brief This is a container class for checking that the SpaceFOM
+SpaceTimeCoordinateEncoder and QuaternionEncoder produce the same bytes as
+the HLAfixedRecord encoding of the SpaceFOM data types, without an RTI.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/OpaqueBuffer.cpp}
+@trick_link_dependency{../../../source/SpaceFOM/QuaternionData.cpp}
+@trick_link_dependency{../../../source/SpaceFOM/QuaternionEncoder.cpp}
+@trick_link_dependency{../../../source/SpaceFOM/SpaceTimeCoordinateData.cpp}
+@trick_link_dependency{../../../source/SpaceFOM/SpaceTimeCoordinateEncoder.cpp}
+@trick_link_dependency{SpaceFOMEncoderCheck/src/EncoderCheck.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cfloat>
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+// Trick include files.
+#include "trick/memorymanager_c_intf.h"
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+
+// TrickHLA include files.
+#include "TrickHLA/HLAStandardSupport.hh"
+#include "TrickHLA/OpaqueBuffer.hh"
+#include "TrickHLA/utils/StringUtilities.hh"
+
+// SpaceFOM include files.
+#include "SpaceFOM/QuaternionData.hh"
+#include "SpaceFOM/QuaternionEncoder.hh"
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
+#include "SpaceFOM/SpaceTimeCoordinateEncoder.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wdeprecated"
+#endif
+
+// HLA include files.
+#include "RTI/VariableLengthData.h"
+#include "RTI/encoding/BasicDataElements.h"
+#include "RTI/encoding/EncodingExceptions.h"
+#include "RTI/encoding/HLAfixedArray.h"
+#include "RTI/encoding/HLAfixedRecord.h"
+
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic pop
+#endif
+
+// Model include files.
+#include "SpaceFOMEncoderCheck/include/EncoderCheck.hh"
+
+using namespace RTI1516_NAMESPACE;
+using namespace std;
+using namespace SpaceFOM;
+using namespace TrickHLA;
+using namespace TrickHLAModel;
+
+namespace
+{
+
+// Number of doubles in the encoded SpaceTimeCoordinateState fixed record.
+size_t const STC_DOUBLE_COUNT = 14;
+
+// Number of doubles in the encoded AttitudeQuaternion fixed record.
+size_t const QUAT_DOUBLE_COUNT = 4;
+
+// Encode the space-time coordinate data as the SpaceTimeCoordinateState
+// HLAfixedRecord of the SISO SpaceFOM data types.
+void encode_space_time_coordinate_record(
+   SpaceTimeCoordinateData &stc_data,
+   VariableLengthData      &encoded_data )
+{
+   HLAfloat64LE position[3];
+   HLAfloat64LE velocity[3];
+   HLAfloat64LE quat_vector[3];
+   HLAfloat64LE angular_velocity[3];
+
+   HLAfixedArray position_encoder( HLAfloat64LE(), 3 );
+   HLAfixedArray velocity_encoder( HLAfloat64LE(), 3 );
+   HLAfixedArray quat_vector_encoder( HLAfloat64LE(), 3 );
+   HLAfixedArray ang_vel_encoder( HLAfloat64LE(), 3 );
+   HLAfloat64LE  quat_scalar_encoder( &stc_data.att.scalar );
+   HLAfloat64LE  time_encoder( &stc_data.time );
+
+   for ( int i = 0; i < 3; ++i ) {
+      position[i].setDataPointer( &stc_data.pos[i] );
+      position_encoder.setElementPointer( i, &position[i] );
+      velocity[i].setDataPointer( &stc_data.vel[i] );
+      velocity_encoder.setElementPointer( i, &velocity[i] );
+      quat_vector[i].setDataPointer( &stc_data.att.vector[i] );
+      quat_vector_encoder.setElementPointer( i, &quat_vector[i] );
+      angular_velocity[i].setDataPointer( &stc_data.ang_vel[i] );
+      ang_vel_encoder.setElementPointer( i, &angular_velocity[i] );
+   }
+
+   HLAfixedRecord trans_state_encoder;
+   trans_state_encoder.appendElementPointer( &position_encoder );
+   trans_state_encoder.appendElementPointer( &velocity_encoder );
+
+   HLAfixedRecord quat_encoder;
+   quat_encoder.appendElementPointer( &quat_scalar_encoder );
+   quat_encoder.appendElementPointer( &quat_vector_encoder );
+
+   HLAfixedRecord rot_state_encoder;
+   rot_state_encoder.appendElementPointer( &quat_encoder );
+   rot_state_encoder.appendElementPointer( &ang_vel_encoder );
+
+   HLAfixedRecord encoder;
+   encoder.appendElementPointer( &trans_state_encoder );
+   encoder.appendElementPointer( &rot_state_encoder );
+   encoder.appendElementPointer( &time_encoder );
+
+   encoder.encode( encoded_data );
+}
+
+// Encode the quaternion data as the AttitudeQuaternion HLAfixedRecord of the
+// SISO SpaceFOM data types.
+void encode_quaternion_record(
+   QuaternionData     &quat_data,
+   VariableLengthData &encoded_data )
+{
+   HLAfloat64LE  vector[3];
+   HLAfixedArray vector_encoder( HLAfloat64LE(), 3 );
+   HLAfloat64LE  scalar_encoder( &quat_data.scalar );
+
+   for ( int i = 0; i < 3; ++i ) {
+      vector[i].setDataPointer( &quat_data.vector[i] );
+      vector_encoder.setElementPointer( i, &vector[i] );
+   }
+
+   HLAfixedRecord encoder;
+   encoder.appendElementPointer( &scalar_encoder );
+   encoder.appendElementPointer( &vector_encoder );
+
+   encoder.encode( encoded_data );
+}
+
+// Copy the received bytes into the buffer of a receiving encoder the way the
+// raw data decoder does, which resizes the buffer to the received size.
+void receive_buffer(
+   OpaqueBuffer &dest,
+   void const   *data,
+   size_t const  size )
+{
+   dest.buffer = static_cast< unsigned char * >( TMM_resize_array_1d_a( dest.buffer, (int)size ) );
+   memcpy( dest.buffer, data, size ); // flawfinder: ignore
+}
+
+// Fill the doubles of a test case with values that cover the sign, the
+// exponent range and the subnormal values, so every byte of the encoding
+// is exercised.
+void fill_values(
+   double      *values,
+   size_t const count,
+   int const    test_case )
+{
+   static double const special[] = {
+      0.0, -0.0, 1.0, -1.0, DBL_MAX, -DBL_MAX, DBL_MIN, -DBL_MIN,
+      DBL_MIN / 1024.0, DBL_EPSILON, 1.0 / 3.0, 6378137.0, -7.2921159e-5, 2460000.5
+   };
+   size_t const special_count = sizeof( special ) / sizeof( special[0] );
+
+   for ( size_t i = 0; i < count; ++i ) {
+      if ( test_case == 0 ) {
+         values[i] = special[i % special_count];
+      } else {
+         values[i] = special[( i + (size_t)test_case ) % special_count]
+                     * ( 1.0 + ( 0.125 * (double)( test_case * (int)count + (int)i ) ) );
+      }
+   }
+}
+
+} // namespace
+
+/*!
+ * @job_class{initialization}
+ */
+EncoderCheck::EncoderCheck()
+   : check_count( 0 ),
+     fail_count( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+EncoderCheck::~EncoderCheck()
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void EncoderCheck::run()
+{
+   int const test_case_count = 4;
+
+   for ( int test_case = 0; test_case < test_case_count; ++test_case ) {
+      double values[STC_DOUBLE_COUNT];
+      fill_values( values, STC_DOUBLE_COUNT, test_case );
+
+      SpaceTimeCoordinateData stc_data;
+      memcpy( stc_data.pos, &values[0], 3 * sizeof( double ) ); // flawfinder: ignore
+      memcpy( stc_data.vel, &values[3], 3 * sizeof( double ) ); // flawfinder: ignore
+      stc_data.att.scalar = values[6];
+      memcpy( stc_data.att.vector, &values[7], 3 * sizeof( double ) ); // flawfinder: ignore
+      memcpy( stc_data.ang_vel, &values[10], 3 * sizeof( double ) );   // flawfinder: ignore
+      stc_data.time = values[13];
+
+      check_space_time_coordinate( stc_data );
+      check_quaternion( stc_data.att );
+   }
+
+   ostringstream msg;
+   msg << "EncoderCheck::run():" << __LINE__
+       << " Ran " << check_count << " SpaceTimeCoordinateEncoder and"
+       << " QuaternionEncoder checks for " << test_case_count << " test cases"
+       << " with " << fail_count << " failures." << endl;
+   message_publish( ( fail_count == 0 ) ? MSG_INFO : MSG_ERROR, msg.str().c_str() );
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void EncoderCheck::check_space_time_coordinate(
+   SpaceTimeCoordinateData const &stc_data )
+{
+   size_t const record_size = STC_DOUBLE_COUNT * sizeof( double );
+
+   // Reference encoding.
+   SpaceTimeCoordinateData reference_data( stc_data );
+   VariableLengthData      reference;
+   try {
+      encode_space_time_coordinate_record( reference_data, reference );
+   } catch ( RTI1516_NAMESPACE::EncoderException &e ) {
+      string what_s;
+      StringUtilities::to_string( what_s, e.what() );
+      ++check_count;
+      ++fail_count;
+      message_publish( MSG_ERROR, "EncoderCheck::check_space_time_coordinate():%d \
+ERROR: Encoder exception: %s\n",
+                       __LINE__, what_s.c_str() );
+      return;
+   }
+
+   // Encode with the single-pass encoder and compare the bytes.
+   SpaceTimeCoordinateData    send_data( stc_data );
+   SpaceTimeCoordinateEncoder sender( send_data );
+   sender.encode();
+   compare( "SpaceTimeCoordinateEncoder::encode() bytes",
+            reference.data(), reference.size(), sender.buffer, sender.push_pos );
+
+   // Decode the reference bytes and compare the values bit for bit.
+   SpaceTimeCoordinateData    recv_data;
+   SpaceTimeCoordinateEncoder receiver( recv_data );
+   receive_buffer( receiver, reference.data(), reference.size() );
+   receiver.decode();
+
+   double decoded[STC_DOUBLE_COUNT];
+   double expected[STC_DOUBLE_COUNT];
+   memcpy( &decoded[0], recv_data.pos, 3 * sizeof( double ) ); // flawfinder: ignore
+   memcpy( &decoded[3], recv_data.vel, 3 * sizeof( double ) ); // flawfinder: ignore
+   decoded[6] = recv_data.att.scalar;
+   memcpy( &decoded[7], recv_data.att.vector, 3 * sizeof( double ) ); // flawfinder: ignore
+   memcpy( &decoded[10], recv_data.ang_vel, 3 * sizeof( double ) );   // flawfinder: ignore
+   decoded[13] = recv_data.time;
+   memcpy( &expected[0], stc_data.pos, 3 * sizeof( double ) ); // flawfinder: ignore
+   memcpy( &expected[3], stc_data.vel, 3 * sizeof( double ) ); // flawfinder: ignore
+   expected[6] = stc_data.att.scalar;
+   memcpy( &expected[7], stc_data.att.vector, 3 * sizeof( double ) ); // flawfinder: ignore
+   memcpy( &expected[10], stc_data.ang_vel, 3 * sizeof( double ) );   // flawfinder: ignore
+   expected[13] = stc_data.time;
+   compare( "SpaceTimeCoordinateEncoder::decode() values",
+            expected, record_size, decoded, record_size );
+
+   // A short record must be ignored and leave the decoded values unchanged.
+   receive_buffer( receiver, reference.data(), record_size - sizeof( double ) );
+   recv_data.time = 0.0;
+   receiver.decode();
+   compare( "SpaceTimeCoordinateEncoder::decode() short record",
+            &expected[0], 3 * sizeof( double ), recv_data.pos, 3 * sizeof( double ) );
+   double const zero = 0.0;
+   compare( "SpaceTimeCoordinateEncoder::decode() short record time",
+            &zero, sizeof( double ), &recv_data.time, sizeof( double ) );
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void EncoderCheck::check_quaternion(
+   QuaternionData const &quat_data )
+{
+   size_t const record_size = QUAT_DOUBLE_COUNT * sizeof( double );
+
+   // Reference encoding.
+   QuaternionData     reference_data( quat_data );
+   VariableLengthData reference;
+   try {
+      encode_quaternion_record( reference_data, reference );
+   } catch ( RTI1516_NAMESPACE::EncoderException &e ) {
+      string what_s;
+      StringUtilities::to_string( what_s, e.what() );
+      ++check_count;
+      ++fail_count;
+      message_publish( MSG_ERROR, "EncoderCheck::check_quaternion():%d \
+ERROR: Encoder exception: %s\n",
+                       __LINE__, what_s.c_str() );
+      return;
+   }
+
+   // Encode with the single-pass encoder and compare the bytes.
+   QuaternionData    send_data( quat_data );
+   QuaternionEncoder sender( send_data );
+   sender.encode();
+   compare( "QuaternionEncoder::encode() bytes",
+            reference.data(), reference.size(), sender.buffer, sender.push_pos );
+
+   // Decode the reference bytes and compare the values bit for bit.
+   QuaternionData    recv_data;
+   QuaternionEncoder receiver( recv_data );
+   receive_buffer( receiver, reference.data(), reference.size() );
+   receiver.decode();
+
+   double decoded[QUAT_DOUBLE_COUNT];
+   double expected[QUAT_DOUBLE_COUNT];
+   decoded[0]  = recv_data.scalar;
+   expected[0] = quat_data.scalar;
+   memcpy( &decoded[1], recv_data.vector, 3 * sizeof( double ) );  // flawfinder: ignore
+   memcpy( &expected[1], quat_data.vector, 3 * sizeof( double ) ); // flawfinder: ignore
+   compare( "QuaternionEncoder::decode() values",
+            expected, record_size, decoded, record_size );
+
+   // A short record must be ignored and leave the decoded values unchanged.
+   receive_buffer( receiver, reference.data(), record_size - sizeof( double ) );
+   recv_data.scalar = 0.0;
+   receiver.decode();
+   double const zero = 0.0;
+   compare( "QuaternionEncoder::decode() short record",
+            &zero, sizeof( double ), &recv_data.scalar, sizeof( double ) );
+}
+
+/*!
+ * @job_class{initialization}
+ */
+bool EncoderCheck::compare(
+   char const  *what,
+   void const  *expected,
+   size_t const expected_size,
+   void const  *actual,
+   size_t const actual_size )
+{
+   ++check_count;
+
+   if ( ( expected_size == actual_size )
+        && ( memcmp( expected, actual, expected_size ) == 0 ) ) {
+      return true;
+   }
+   ++fail_count;
+
+   // Show the bytes of both encodings so the differing field can be found.
+   unsigned char const *expected_bytes = static_cast< unsigned char const * >( expected );
+   unsigned char const *actual_bytes   = static_cast< unsigned char const * >( actual );
+
+   ostringstream errmsg;
+   errmsg << "EncoderCheck::compare():" << __LINE__
+          << " ERROR: " << what << " do not match!" << endl
+          << "  expected " << expected_size << " bytes:" << hex;
+   for ( size_t i = 0; i < expected_size; ++i ) {
+      errmsg << ( ( ( i % 8 ) == 0 ) ? "  " : " " ) << (unsigned int)expected_bytes[i];
+   }
+   errmsg << endl
+          << dec << "  actual " << actual_size << " bytes:" << hex;
+   for ( size_t i = 0; i < actual_size; ++i ) {
+      errmsg << ( ( ( i % 8 ) == 0 ) ? "  " : " " ) << (unsigned int)actual_bytes[i];
+   }
+   errmsg << dec << endl;
+   message_publish( MSG_ERROR, errmsg.str().c_str() );
+
+   return false;
+}
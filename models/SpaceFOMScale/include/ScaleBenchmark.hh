@@ -0,0 +1,130 @@
+/*!
+@ingroup SpaceFOMScale
+@file models/SpaceFOMScale/include/ScaleBenchmark.hh
+@brief This is a container class for benchmarking the SpaceFOM reference
+frame tree, entity packing, lag compensation and frame transformation costs
+at scale, without an RTI.
+
+The benchmark builds a reference frame tree with the configured depth and
+fan-out, where every frame below the root has the same number of child
+frames. The PhysicalEntity and DynamicalEntity objects are parented to the
+leaf frames. Each entity has a sending and a receiving packing object, which
+stand in for the publishing and the subscribing federates, and closed-form
+lag compensation on the receive side. Each iteration of the benchmark times
+these phases separately:
+- tree build: adding all the frames to a new tree and building its paths.
+- pack: packing and encoding all the sending entities.
+- unpack: decoding and unpacking all the receiving entities.
+- lag comp: compensating all the received entity states.
+- transforms: building the transformation between every pair of frames.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{SpaceFOMScale/src/ScaleBenchmark.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_SCALE_BENCHMARK_HH
+#define TRICKHLA_MODEL_SCALE_BENCHMARK_HH
+
+// TrickHLA includes.
+#include "TrickHLA/utils/LatencyHistogram.hh"
+
+// Largest number of frames in the benchmark reference frame tree. The tree
+// paths and the transforms grow with the square of the number of frames.
+#define SCALE_BENCHMARK_MAX_FRAMES 4096
+
+namespace TrickHLAModel
+{
+
+class ScaleBenchmark
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__ScaleBenchmark();
+
+  public:
+   //
+   // Public constructors and destructor.
+   //
+   /*! @brief Default constructor for the TrickHLAModel ScaleBenchmark class. */
+   ScaleBenchmark();
+   /*! @brief Destructor for the TrickHLAModel ScaleBenchmark class. */
+   virtual ~ScaleBenchmark();
+
+   /*! @brief Build the frames and entities, run the benchmark phases for the
+    *  configured number of iterations and report the times of each phase. */
+   void run();
+
+   //------------------------- TRICK LOGGABLE OUTPUTS -------------------------
+  public:
+   int frame_count;     ///< @trick_units{count} Number of frames in the tree.
+   int entity_count;    ///< @trick_units{count} Number of physical and dynamical entities.
+   int transform_count; ///< @trick_units{count} Number of frame transformations per iteration.
+
+   TrickHLA::LatencyHistogram tree_build_time; ///< @trick_units{--} Nanoseconds to build the frame tree.
+   TrickHLA::LatencyHistogram pack_time;       ///< @trick_units{--} Nanoseconds to pack and encode all entities.
+   TrickHLA::LatencyHistogram unpack_time;     ///< @trick_units{--} Nanoseconds to decode and unpack all entities.
+   TrickHLA::LatencyHistogram lag_comp_time;   ///< @trick_units{--} Nanoseconds to lag compensate all entities.
+   TrickHLA::LatencyHistogram transform_time;  ///< @trick_units{--} Nanoseconds to build all the frame transformations.
+
+   int fail_count; ///< @trick_units{count} Number of failed transformations and entity round trips.
+
+   //----------------------------- USER VARIABLES -----------------------------
+  public:
+   int tree_depth;  ///< @trick_units{--} Number of frame levels below the root frame.
+   int tree_fanout; ///< @trick_units{--} Number of child frames of each non-leaf frame.
+
+   int physical_count;  ///< @trick_units{count} Number of PhysicalEntity objects.
+   int dynamical_count; ///< @trick_units{count} Number of DynamicalEntity objects.
+
+   double compensate_dt; ///< @trick_units{s} Lag compensation interval.
+
+   int iterations; ///< @trick_units{count} Number of times each phase is timed.
+
+  protected:
+   /*! @brief Validate the configuration and compute the number of frames.
+    *  @return True if the configuration is valid. */
+   bool configure();
+
+   /*! @brief Report the times of each phase. */
+   void report() const;
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for ScaleBenchmark class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   ScaleBenchmark( ScaleBenchmark const &rhs );
+   /*! @brief Assignment operator for ScaleBenchmark class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   ScaleBenchmark &operator=( ScaleBenchmark const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_SCALE_BENCHMARK_HH: Do NOT put anything after this line!
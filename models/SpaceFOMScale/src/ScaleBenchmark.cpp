@@ -0,0 +1,597 @@
+/*!
+@ingroup SpaceFOMScale
+@file models/SpaceFOMScale/src/ScaleBenchmark.cpp
+@brief This is a container class for benchmarking the SpaceFOM reference
+frame tree, entity packing, lag compensation and frame transformation costs
+at scale, without an RTI.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/Attribute.cpp}
+@trick_link_dependency{../../../source/TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{../../../source/TrickHLA/utils/LatencyHistogram.cpp}
+@trick_link_dependency{../../../source/SpaceFOM/DynamicalEntity.cpp}
+@trick_link_dependency{../../../source/SpaceFOM/DynamicalEntityLagCompClosedForm.cpp}
+@trick_link_dependency{../../../source/SpaceFOM/PhysicalEntity.cpp}
+@trick_link_dependency{../../../source/SpaceFOM/PhysicalEntityLagCompClosedForm.cpp}
+@trick_link_dependency{../../../source/SpaceFOM/RefFrameState.cpp}
+@trick_link_dependency{../../../source/SpaceFOM/RefFrameTree.cpp}
+@trick_link_dependency{SpaceFOMScale/src/ScaleBenchmark.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System include files.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <time.h>
+#include <vector>
+
+// Trick include files.
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+#include "trick/vector_macros.h"
+
+// TrickHLA include files.
+#include "TrickHLA/Attribute.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/OpaqueBuffer.hh"
+#include "TrickHLA/utils/LatencyHistogram.hh"
+
+// SpaceFOM include files.
+#include "SpaceFOM/DynamicalEntity.hh"
+#include "SpaceFOM/DynamicalEntityData.hh"
+#include "SpaceFOM/DynamicalEntityLagCompClosedForm.hh"
+#include "SpaceFOM/PhysicalEntity.hh"
+#include "SpaceFOM/PhysicalEntityData.hh"
+#include "SpaceFOM/PhysicalEntityLagCompClosedForm.hh"
+#include "SpaceFOM/RefFrameData.hh"
+#include "SpaceFOM/RefFrameState.hh"
+#include "SpaceFOM/RefFrameTree.hh"
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
+
+// Model include files.
+#include "SpaceFOMScale/include/ScaleBenchmark.hh"
+
+using namespace std;
+using namespace SpaceFOM;
+using namespace TrickHLA;
+using namespace TrickHLAModel;
+
+namespace
+{
+
+// Monotonic clock time in nanoseconds.
+int64_t monotonic_time()
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts ); // NOLINT
+   return ( ( (int64_t)ts.tv_sec * 1000000000 ) + (int64_t)ts.tv_nsec );
+}
+
+// Copy the encoded bytes of a sending encoder into a receiving encoder, which
+// is what the RTI does between the publishing and the subscribing federates.
+void copy_buffer(
+   OpaqueBuffer       &dest,
+   OpaqueBuffer const &src )
+{
+   dest.ensure_buffer_capacity( src.capacity );
+   if ( src.capacity > 0 ) {
+      memcpy( dest.buffer, src.buffer, src.capacity );
+   }
+}
+
+// The packing classes only give the TrickHLA::Object and the attribute
+// references to their subclasses, so this wrapper connects an entity to a
+// stand-in object and marks all of its attributes as received. It also
+// transfers the data of a sending entity the way the RTI would: the
+// encoded state and attitude buffers and the attributes that Trick encodes
+// straight from the packing data.
+template < class EntityType >
+class EntityHarness : public EntityType
+{
+  public:
+   void connect( TrickHLA::Object *obj, TrickHLA::Attribute *received_attr )
+   {
+      this->object            = obj;
+      this->name_attr         = received_attr;
+      this->type_attr         = received_attr;
+      this->status_attr       = received_attr;
+      this->parent_frame_attr = received_attr;
+      this->state_attr        = received_attr;
+      this->accel_attr        = received_attr;
+      this->ang_accel_attr    = received_attr;
+      this->cm_attr           = received_attr;
+      this->body_frame_attr   = received_attr;
+   }
+
+   void transfer( EntityHarness const &src )
+   {
+      copy_buffer( this->stc_encoder, src.stc_encoder );
+      copy_buffer( this->quat_encoder, src.quat_encoder );
+
+      this->pe_packing_data.name         = src.pe_packing_data.name;
+      this->pe_packing_data.type         = src.pe_packing_data.type;
+      this->pe_packing_data.status       = src.pe_packing_data.status;
+      this->pe_packing_data.parent_frame = src.pe_packing_data.parent_frame;
+      V_COPY( this->pe_packing_data.accel, src.pe_packing_data.accel );
+      V_COPY( this->pe_packing_data.ang_accel, src.pe_packing_data.ang_accel );
+      V_COPY( this->pe_packing_data.cm, src.pe_packing_data.cm );
+   }
+};
+
+class PhysicalEntityHarness : public EntityHarness< PhysicalEntity >
+{
+  public:
+   void set_working_data( PhysicalEntityData *pe_data, DynamicalEntityData * )
+   {
+      this->set_data( pe_data );
+   }
+};
+
+class DynamicalEntityHarness : public EntityHarness< DynamicalEntity >
+{
+  public:
+   void set_working_data( PhysicalEntityData *pe_data, DynamicalEntityData *de_data )
+   {
+      this->set_data( pe_data, de_data );
+   }
+
+   void connect( TrickHLA::Object *obj, TrickHLA::Attribute *received_attr )
+   {
+      EntityHarness< DynamicalEntity >::connect( obj, received_attr );
+      this->force_attr        = received_attr;
+      this->torque_attr       = received_attr;
+      this->mass_attr         = received_attr;
+      this->mass_rate_attr    = received_attr;
+      this->inertia_attr      = received_attr;
+      this->inertia_rate_attr = received_attr;
+   }
+
+   void transfer( DynamicalEntityHarness const &src )
+   {
+      EntityHarness< DynamicalEntity >::transfer( src );
+      this->de_packing_data = src.de_packing_data;
+   }
+};
+
+// Gives the benchmark access to the receive side lag compensation steps,
+// without the scenario time and attribute checks that need a federate.
+template < class LagCompType >
+class LagCompHarness : public LagCompType
+{
+  public:
+   template < class EntityType >
+   explicit LagCompHarness( EntityType &entity_ref )
+      : LagCompType( entity_ref )
+   {
+      return;
+   }
+
+   void run( double const t_begin, double const t_end )
+   {
+      this->load_lag_comp_data();
+      this->compensate( t_begin, t_end );
+      this->unload_lag_comp_data();
+   }
+};
+
+// Gives the benchmark access to the reference frame packing data that the
+// frame tree transformations use.
+class RefFrameHarness : public RefFrameState
+{
+  public:
+   explicit RefFrameHarness( RefFrameData &frame_data )
+      : RefFrameState( frame_data )
+   {
+      return;
+   }
+
+   void set_state( SpaceTimeCoordinateData const &state )
+   {
+      this->packing_data.state = state;
+   }
+};
+
+// One published entity with the sending and the receiving packing and the
+// receive side lag compensation, behind a common interface so that the
+// PhysicalEntity and DynamicalEntity objects are timed in the same loops.
+class EntityLoopback
+{
+  public:
+   virtual ~EntityLoopback()
+   {
+      return;
+   }
+   virtual void pack() = 0;
+   virtual void transfer() = 0;
+   virtual void unpack() = 0;
+   virtual void compensate( double const t_begin, double const t_end ) = 0;
+   virtual bool verify() const = 0;
+};
+
+template < class HarnessType, class LagCompType >
+class EntityLoopbackType : public EntityLoopback
+{
+  public:
+   EntityLoopbackType(
+      PhysicalEntityData const  &pe_init,
+      DynamicalEntityData const &de_init,
+      TrickHLA::Object          *obj,
+      TrickHLA::Attribute       *received_attr )
+      : send_pe( pe_init ),
+        send_de( de_init ),
+        recv_pe(),
+        recv_de(),
+        sender(),
+        receiver(),
+        lag_comp( receiver )
+   {
+      sender.set_working_data( &send_pe, &send_de );
+      receiver.set_working_data( &recv_pe, &recv_de );
+
+      sender.set_name( pe_init.name );
+      sender.set_parent_frame( pe_init.parent_frame );
+      receiver.set_name( pe_init.name );
+      receiver.set_parent_frame( pe_init.parent_frame );
+
+      // The sending object does not have lag compensation, so pack() packs
+      // the working data. The receiving attributes are all marked received.
+      sender.connect( obj, received_attr );
+      receiver.connect( obj, received_attr );
+
+      sender.initialize();
+      receiver.initialize();
+      lag_comp.initialize();
+   }
+
+   virtual void pack()
+   {
+      sender.pack();
+   }
+
+   virtual void transfer()
+   {
+      receiver.transfer( sender );
+   }
+
+   virtual void unpack()
+   {
+      receiver.unpack();
+   }
+
+   virtual void compensate( double const t_begin, double const t_end )
+   {
+      lag_comp.run( t_begin, t_end );
+   }
+
+   virtual bool verify() const
+   {
+      return ( recv_pe.name == send_pe.name )
+             && ( recv_pe.parent_frame == send_pe.parent_frame )
+             && ( memcmp( recv_pe.state.pos, send_pe.state.pos, sizeof( send_pe.state.pos ) ) == 0 )
+             && ( memcmp( recv_pe.state.vel, send_pe.state.vel, sizeof( send_pe.state.vel ) ) == 0 )
+             && ( recv_pe.state.att.scalar == send_pe.state.att.scalar )
+             && ( memcmp( recv_pe.state.att.vector, send_pe.state.att.vector, sizeof( send_pe.state.att.vector ) ) == 0 )
+             && ( memcmp( recv_pe.state.ang_vel, send_pe.state.ang_vel, sizeof( send_pe.state.ang_vel ) ) == 0 );
+   }
+
+  protected:
+   PhysicalEntityData  send_pe;
+   DynamicalEntityData send_de;
+   PhysicalEntityData  recv_pe;
+   DynamicalEntityData recv_de;
+
+   HarnessType                   sender;
+   HarnessType                   receiver;
+   LagCompHarness< LagCompType > lag_comp;
+};
+
+typedef EntityLoopbackType< PhysicalEntityHarness, PhysicalEntityLagCompClosedForm >   PhysicalEntityLoopback;
+typedef EntityLoopbackType< DynamicalEntityHarness, DynamicalEntityLagCompClosedForm > DynamicalEntityLoopback;
+
+// Distinct, deterministic state for the frame or entity with the given index.
+void init_state(
+   SpaceTimeCoordinateData &state,
+   int const                index )
+{
+   double const x = (double)( index + 1 );
+
+   state.pos[0] = 1000.0 * x;
+   state.pos[1] = -250.0 * x;
+   state.pos[2] = 10.0 * x;
+   state.vel[0] = 0.5 * x;
+   state.vel[1] = 7.5;
+   state.vel[2] = -0.1 * x;
+
+   state.att.scalar    = 1.0;
+   state.att.vector[0] = 0.01 * x;
+   state.att.vector[1] = -0.02;
+   state.att.vector[2] = 0.005 * x;
+   state.att.normalize();
+
+   state.ang_vel[0] = 1.0e-3;
+   state.ang_vel[1] = -2.0e-4 * x;
+   state.ang_vel[2] = 5.0e-4;
+
+   state.time = 0.0;
+}
+
+} // namespace
+
+/*!
+ * @job_class{initialization}
+ */
+ScaleBenchmark::ScaleBenchmark()
+   : frame_count( 0 ),
+     entity_count( 0 ),
+     transform_count( 0 ),
+     tree_build_time(),
+     pack_time(),
+     unpack_time(),
+     lag_comp_time(),
+     transform_time(),
+     fail_count( 0 ),
+     tree_depth( 3 ),
+     tree_fanout( 4 ),
+     physical_count( 100 ),
+     dynamical_count( 100 ),
+     compensate_dt( 0.05 ),
+     iterations( 100 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+ScaleBenchmark::~ScaleBenchmark()
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+bool ScaleBenchmark::configure()
+{
+   if ( ( tree_depth < 0 ) || ( tree_fanout < 1 )
+        || ( physical_count < 0 ) || ( dynamical_count < 0 )
+        || ( iterations < 1 ) ) {
+      ostringstream errmsg;
+      errmsg << "ScaleBenchmark::configure():" << __LINE__
+             << " ERROR: Invalid configuration, tree_depth:" << tree_depth
+             << " tree_fanout:" << tree_fanout
+             << " physical_count:" << physical_count
+             << " dynamical_count:" << dynamical_count
+             << " iterations:" << iterations << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return false;
+   }
+
+   // Count the frames level by level, stopping as soon as the tree is too big.
+   int64_t level_count = 1;
+   int64_t total       = 1;
+   for ( int level = 1; ( level <= tree_depth ) && ( total <= SCALE_BENCHMARK_MAX_FRAMES ); ++level ) {
+      level_count *= tree_fanout;
+      total += level_count;
+   }
+   if ( total > SCALE_BENCHMARK_MAX_FRAMES ) {
+      ostringstream errmsg;
+      errmsg << "ScaleBenchmark::configure():" << __LINE__
+             << " ERROR: A tree_depth of " << tree_depth << " and tree_fanout of "
+             << tree_fanout << " has more than the maximum of "
+             << SCALE_BENCHMARK_MAX_FRAMES << " frames!" << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return false;
+   }
+
+   this->frame_count     = (int)total;
+   this->entity_count    = physical_count + dynamical_count;
+   this->transform_count = frame_count * frame_count;
+   return true;
+}
+
+/*!
+ * @details The frames are numbered breadth first, so the parent of frame i
+ * is frame (i-1)/fanout and the leaf frames are the last frames.
+ * @job_class{initialization}
+ */
+void ScaleBenchmark::run()
+{
+   if ( !configure() ) {
+      return;
+   }
+
+   //
+   // Frames.
+   //
+   vector< RefFrameData * >    frame_data( frame_count, (RefFrameData *)NULL );
+   vector< RefFrameHarness * > frames( frame_count, (RefFrameHarness *)NULL );
+   for ( int i = 0; i < frame_count; ++i ) {
+      ostringstream name;
+      name << "Frame" << i;
+
+      SpaceTimeCoordinateData state;
+      init_state( state, i );
+
+      frame_data[i] = new RefFrameData();
+      frames[i]     = new RefFrameHarness( *frame_data[i] );
+      frames[i]->set_name( name.str() );
+      frames[i]->set_parent_frame( ( i > 0 ) ? frames[( i - 1 ) / tree_fanout] : NULL );
+      frames[i]->set_state( state );
+   }
+   int const first_leaf = ( frame_count - 1 ) / tree_fanout;
+   int const leaf_count = frame_count - first_leaf;
+
+   //
+   // Entities. Every entity shares the stand-in object, which has no lag
+   // compensation, and the stand-in received attribute.
+   //
+   TrickHLA::Object    object;
+   TrickHLA::Attribute received_attr;
+   received_attr.mark_changed();
+
+   vector< EntityLoopback * > entities;
+   entities.reserve( entity_count );
+   for ( int i = 0; i < entity_count; ++i ) {
+      PhysicalEntityData  pe_init;
+      DynamicalEntityData de_init;
+
+      ostringstream name;
+      name << "Entity" << i;
+      pe_init.name         = name.str();
+      pe_init.type         = ( i < physical_count ) ? "PhysicalEntity" : "DynamicalEntity";
+      pe_init.status       = "Active";
+      pe_init.parent_frame = frames[first_leaf + ( i % leaf_count )]->get_name();
+      init_state( pe_init.state, frame_count + i );
+      pe_init.accel[0]     = -0.01 * (double)( i + 1 );
+      pe_init.ang_accel[2] = 1.0e-5;
+
+      de_init.mass = 1000.0 + (double)i;
+      de_init.inertia[0][0] = 500.0;
+      de_init.inertia[1][1] = 500.0;
+      de_init.inertia[2][2] = 500.0;
+      de_init.force[0] = 10.0;
+
+      if ( i < physical_count ) {
+         entities.push_back( new PhysicalEntityLoopback( pe_init, de_init, &object, &received_attr ) );
+      } else {
+         entities.push_back( new DynamicalEntityLoopback( pe_init, de_init, &object, &received_attr ) );
+      }
+   }
+
+   //
+   // Run the phases.
+   //
+   RefFrameTree *tree = NULL;
+   RefFrameData  transform;
+   for ( int iter = 0; iter < iterations; ++iter ) {
+
+      // Tree build, where the previous tree is deleted outside of the timing.
+      delete tree;
+      int64_t start = monotonic_time();
+      tree          = new RefFrameTree();
+      for ( int i = 0; i < frame_count; ++i ) {
+         tree->add_frame( frames[i] );
+      }
+      tree->build_tree();
+      tree_build_time.record( monotonic_time() - start );
+
+      // Pack and encode.
+      start = monotonic_time();
+      for ( int i = 0; i < entity_count; ++i ) {
+         entities[i]->pack();
+      }
+      pack_time.record( monotonic_time() - start );
+
+      // Transfer the sent data to the receiving entities, which is the RTI
+      // part of the round trip and is not timed.
+      for ( int i = 0; i < entity_count; ++i ) {
+         entities[i]->transfer();
+      }
+
+      // Decode and unpack.
+      start = monotonic_time();
+      for ( int i = 0; i < entity_count; ++i ) {
+         entities[i]->unpack();
+      }
+      unpack_time.record( monotonic_time() - start );
+
+      // Lag compensation.
+      double const t_begin = iter * compensate_dt;
+      start                = monotonic_time();
+      for ( int i = 0; i < entity_count; ++i ) {
+         entities[i]->compensate( t_begin, t_begin + compensate_dt );
+      }
+      lag_comp_time.record( monotonic_time() - start );
+
+      // All-pairs frame transformations.
+      int transform_failures = 0;
+      start                  = monotonic_time();
+      for ( int i = 0; i < frame_count; ++i ) {
+         for ( int j = 0; j < frame_count; ++j ) {
+            if ( !tree->build_transform( frames[i], frames[j], &transform ) ) {
+               ++transform_failures;
+            }
+         }
+      }
+      transform_time.record( monotonic_time() - start );
+
+      // Only check the results of the first iteration, since every iteration
+      // repeats the same work.
+      if ( iter == 0 ) {
+         fail_count += transform_failures;
+         for ( int i = 0; i < entity_count; ++i ) {
+            if ( !entities[i]->verify() ) {
+               ++fail_count;
+            }
+         }
+      }
+   }
+
+   report();
+
+   delete tree;
+   for ( int i = 0; i < entity_count; ++i ) {
+      delete entities[i];
+   }
+   for ( int i = 0; i < frame_count; ++i ) {
+      delete frames[i];
+      delete frame_data[i];
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void ScaleBenchmark::report() const
+{
+   double const entities = ( entity_count > 0 ) ? (double)entity_count : 1.0;
+
+   ostringstream msg;
+   msg << "ScaleBenchmark::report():" << __LINE__ << endl
+       << "  frames: " << frame_count
+       << " (depth " << tree_depth << ", fan-out " << tree_fanout << ")"
+       << ", physical entities: " << physical_count
+       << ", dynamical entities: " << dynamical_count
+       << ", iterations: " << iterations << endl
+       << "  tree build time per iteration:" << endl
+       << tree_build_time.to_string( "microseconds", 1.0e-3 ) << endl
+       << "  pack time per iteration ("
+       << ( pack_time.get_mean() * 1.0e-3 / entities ) << " microseconds per entity):" << endl
+       << pack_time.to_string( "microseconds", 1.0e-3 ) << endl
+       << "  unpack time per iteration ("
+       << ( unpack_time.get_mean() * 1.0e-3 / entities ) << " microseconds per entity):" << endl
+       << unpack_time.to_string( "microseconds", 1.0e-3 ) << endl
+       << "  lag comp time per iteration ("
+       << ( lag_comp_time.get_mean() * 1.0e-3 / entities ) << " microseconds per entity):" << endl
+       << lag_comp_time.to_string( "microseconds", 1.0e-3 ) << endl
+       << "  transform time per iteration ("
+       << ( transform_time.get_mean() * 1.0e-3 / (double)( ( transform_count > 0 ) ? transform_count : 1 ) )
+       << " microseconds per transform, " << transform_count << " transforms):" << endl
+       << transform_time.to_string( "microseconds", 1.0e-3 ) << endl
+       << "  failures: " << fail_count << endl;
+
+   message_publish( ( fail_count == 0 ) ? MSG_INFO : MSG_ERROR, msg.str().c_str() );
+}
@@ -0,0 +1,137 @@
+/*!
+@ingroup Synthetic
+@file models/synthetic/include/SyntheticInteractionHandler.hh
+@brief This class sends and receives the synthetic load interactions.
+
+The handler sends send_rate interactions per second of simulation time, each
+carrying a sequence number, the wall clock send time and a payload of
+payload_size bytes. On receipt it checks the payload, counts skipped sequence
+numbers and records the wall clock latency, which is only meaningful when the
+clocks of the hosts are synchronized.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/InteractionHandler.cpp}
+@trick_link_dependency{../../../source/TrickHLA/utils/LatencyHistogram.cpp}
+@trick_link_dependency{synthetic/src/SyntheticPayload.cpp}
+@trick_link_dependency{synthetic/src/SyntheticInteractionHandler.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_SYNTHETIC_INTERACTION_HANDLER_HH
+#define TRICKHLA_MODEL_SYNTHETIC_INTERACTION_HANDLER_HH
+
+// System includes.
+#include <cstdint>
+#include <map>
+#include <string>
+
+// TrickHLA includes.
+#include "TrickHLA/HLAStandardSupport.hh"
+#include "TrickHLA/InteractionHandler.hh"
+#include "TrickHLA/utils/LatencyHistogram.hh"
+
+// Model includes.
+#include "SyntheticPayload.hh"
+
+// HLA includes.
+#include "RTI/VariableLengthData.h"
+
+namespace TrickHLAModel
+{
+
+class SyntheticInteractionHandler : public TrickHLA::InteractionHandler
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__SyntheticInteractionHandler();
+
+   //------------------------- TRICK LOGGABLE OUTPUTS -------------------------
+  public:
+   uint64_t send_count;    ///< @trick_units{count} Number of interactions sent.
+   uint64_t receive_count; ///< @trick_units{count} Number of interactions received.
+   uint64_t skipped_count; ///< @trick_units{count} Number of sequence numbers skipped by the received interactions.
+   uint64_t error_count;   ///< @trick_units{count} Number of received interactions with a broken payload pattern.
+
+   long long send_sequence; ///< @trick_units{--} Sequence number of the last interaction sent, counted per sender.
+
+   TrickHLA::LatencyHistogram latency; ///< @trick_units{--} Wall clock latency of the received interactions in microseconds.
+
+   //----------------------------- USER VARIABLES -----------------------------
+  public:
+   char  *name;         ///< @trick_units{--} Name of the sender, sent in the user supplied tag.
+   double send_rate;    ///< @trick_units{1/s} Interactions sent per second of simulation time, default: 0 (disabled).
+   int    payload_size; ///< @trick_units{count} Size of the interaction payload in bytes, default: 64.
+
+   // Interaction parameters. The same variables are encoded for the sent and
+   // decoded for the received interactions, so the sequence parameter is set
+   // from send_sequence just before each send and never used as the counter.
+   long long        received_sequence; ///< @trick_units{--} Sequence number parameter of the interaction.
+   long long        send_wall;         ///< @trick_units{--} Wall clock send time in microseconds.
+   SyntheticPayload payload;           ///< @trick_units{--} Interaction payload.
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLAModel SyntheticInteractionHandler class. */
+   SyntheticInteractionHandler();
+   /*! @brief Destructor for the TrickHLAModel SyntheticInteractionHandler class. */
+   virtual ~SyntheticInteractionHandler();
+
+   /*! @brief Allocate the interaction payload. */
+   virtual void initialize();
+
+   /*! @brief Send the interactions that are due, in Timestamp Order.
+    *  @param sim_time Current simulation time {s}. */
+   void send_interactions( double const sim_time );
+
+   /*! @brief Receive the HLA interaction.
+    *  @param the_user_supplied_tag User tag. */
+   virtual void receive_interaction( RTI1516_NAMESPACE::VariableLengthData const &the_user_supplied_tag );
+
+   /*! @brief Report the sent and received interactions and their latency. */
+   void report() const;
+
+  protected:
+   double send_budget;    ///< @trick_units{--} Fractional number of interactions due but not yet sent.
+   double last_send_time; ///< @trick_units{s} Simulation time of the last call to send_interactions().
+
+   std::map< std::string, long long > last_sequence; ///< @trick_io{**} Last sequence number received from each sender.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for SyntheticInteractionHandler class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   SyntheticInteractionHandler( SyntheticInteractionHandler const &rhs );
+   /*! @brief Assignment operator for SyntheticInteractionHandler class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   SyntheticInteractionHandler &operator=( SyntheticInteractionHandler const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_SYNTHETIC_INTERACTION_HANDLER_HH: Do NOT put anything after this line!
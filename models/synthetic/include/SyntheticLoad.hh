@@ -0,0 +1,97 @@
+/*!
+@ingroup Synthetic
+@file models/synthetic/include/SyntheticLoad.hh
+@brief This class holds the packing of all the synthetic load objects of a
+federate and reports their throughput at shutdown.
+
+The input file sizes the load with configure() and then configures each
+packing in the objects array, so the number of objects is not fixed in the
+S_define file.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{synthetic/src/SyntheticPacking.cpp}
+@trick_link_dependency{synthetic/src/SyntheticLoad.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_SYNTHETIC_LOAD_HH
+#define TRICKHLA_MODEL_SYNTHETIC_LOAD_HH
+
+// System includes.
+#include <cstdint>
+
+// Model includes.
+#include "SyntheticPacking.hh"
+
+namespace TrickHLAModel
+{
+
+class SyntheticLoad
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__SyntheticLoad();
+
+  public:
+   int               obj_count; ///< @trick_units{count} Number of synthetic load objects.
+   SyntheticPacking *objects;   ///< @trick_units{--} Packing of each synthetic load object.
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLAModel SyntheticLoad class. */
+   SyntheticLoad();
+   /*! @brief Destructor for the TrickHLAModel SyntheticLoad class. */
+   virtual ~SyntheticLoad();
+
+   /*! @brief Allocate the packing of the synthetic load objects.
+    *  @param count Number of synthetic load objects. */
+   void configure( int const count );
+
+   /*! @brief Initialize the packing of the synthetic load objects. */
+   void initialize();
+
+   /*! @brief Report the pack and unpack totals and throughput. */
+   void report() const;
+
+  protected:
+   int64_t start_time; ///< @trick_units{--} Monotonic time in nanoseconds at initialization.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for SyntheticLoad class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   SyntheticLoad( SyntheticLoad const &rhs );
+   /*! @brief Assignment operator for SyntheticLoad class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   SyntheticLoad &operator=( SyntheticLoad const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_SYNTHETIC_LOAD_HH: Do NOT put anything after this line!
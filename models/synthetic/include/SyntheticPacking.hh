@@ -0,0 +1,126 @@
+/*!
+@ingroup Synthetic
+@file models/synthetic/include/SyntheticPacking.hh
+@brief This class provides the data packing for a synthetic load object.
+
+Attribute i of the object has the FOM name "Payload<i>" and the data of
+payloads[i]. The pack() function refills every locally owned payload with a
+new sequence pattern, so the packing work scales with the attribute sizes. The
+unpack() function checks the pattern of every received payload.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/Attribute.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Object.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Packing.cpp}
+@trick_link_dependency{synthetic/src/SyntheticPayload.cpp}
+@trick_link_dependency{synthetic/src/SyntheticPacking.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_SYNTHETIC_PACKING_HH
+#define TRICKHLA_MODEL_SYNTHETIC_PACKING_HH
+
+// System includes.
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// TrickHLA includes.
+#include "TrickHLA/Attribute.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/Packing.hh"
+
+// Model includes.
+#include "SyntheticPayload.hh"
+
+// Number of "Payload<i>" attributes defined in the synthetic load FOM.
+#define SYNTHETIC_MAX_PAYLOADS 16
+
+namespace TrickHLAModel
+{
+
+class SyntheticPacking : public TrickHLA::Packing
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__SyntheticPacking();
+
+  public:
+   int               payload_count; ///< @trick_units{count} Number of payload attributes.
+   SyntheticPayload *payloads;      ///< @trick_units{--} Payload of each attribute.
+
+   uint64_t pack_count;     ///< @trick_units{count} Number of times pack() was called.
+   uint64_t unpack_count;   ///< @trick_units{count} Number of times unpack() was called.
+   uint64_t packed_bytes;   ///< @trick_units{count} Number of payload bytes filled by pack().
+   uint64_t unpacked_bytes; ///< @trick_units{count} Number of payload bytes checked by unpack().
+   uint64_t error_count;    ///< @trick_units{count} Number of received payloads with a broken pattern.
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLAModel SyntheticPacking class. */
+   SyntheticPacking();
+   /*! @brief Destructor for the TrickHLAModel SyntheticPacking class. */
+   virtual ~SyntheticPacking();
+
+   /*! @brief Allocate the payloads, which must then be sized with
+    * SyntheticPayload::allocate().
+    *  @param count Number of payload attributes. */
+   void configure( int const count );
+
+   /*! @brief Get the FOM name of a payload attribute.
+    *  @return The FOM name "Payload<index>".
+    *  @param index Index of the payload. */
+   static std::string get_payload_FOM_name( int const index );
+
+   /*! @brief Initialize the callback object to the supplied Object pointer.
+    *  @param obj Associated object for this class. */
+   virtual void initialize_callback( TrickHLA::Object *obj );
+
+   /*! @brief Fill the locally owned payloads before they are sent. */
+   virtual void pack();
+
+   /*! @brief Check the received payloads. */
+   virtual void unpack();
+
+  protected:
+   std::vector< TrickHLA::Attribute * > payload_attrs; ///< @trick_io{**} Attribute of each payload.
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for SyntheticPacking class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   SyntheticPacking( SyntheticPacking const &rhs );
+   /*! @brief Assignment operator for SyntheticPacking class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   SyntheticPacking &operator=( SyntheticPacking const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_SYNTHETIC_PACKING_HH: Do NOT put anything after this line!
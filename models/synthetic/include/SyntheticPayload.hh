@@ -0,0 +1,109 @@
+/*!
+@ingroup Synthetic
+@file models/synthetic/include/SyntheticPayload.hh
+@brief This class holds the data of one attribute of a synthetic load object.
+
+The payload is either an array of doubles, which exercises the big and little
+endian encoders, or an array of bytes, which exercises the opaque data and
+byte encoders. The sender fills the payload with a pattern derived from a
+sequence number and the receiver checks the pattern, so corrupted or partially
+decoded updates are counted.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@trick_parse{everything}
+
+@python_module{TrickHLAModel}
+
+@tldh
+@trick_link_dependency{synthetic/src/SyntheticPayload.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+#ifndef TRICKHLA_MODEL_SYNTHETIC_PAYLOAD_HH
+#define TRICKHLA_MODEL_SYNTHETIC_PAYLOAD_HH
+
+// System includes.
+#include <cstddef>
+#include <cstdint>
+
+namespace TrickHLAModel
+{
+
+class SyntheticPayload
+{
+   // Let the Trick input processor access protected and private data.
+   // InputProcessor is really just a marker class (does not really
+   // exists - at least yet). This friend statement just tells Trick
+   // to go ahead and process the protected and private data as well
+   // as the usual public data.
+   friend class InputProcessor;
+   // IMPORTANT Note: you must have the following line too.
+   // Syntax: friend void init_attr<namespace>__<class name>();
+   friend void init_attrTrickHLAModel__SyntheticPayload();
+
+  public:
+   int     value_count; ///< @trick_units{count} Number of doubles in the numeric payload.
+   double *values;      ///< @trick_units{--} Numeric payload, for the big and little endian encodings.
+
+   int            byte_count; ///< @trick_units{count} Number of bytes in the opaque payload.
+   unsigned char *bytes;      ///< @trick_units{--} Opaque payload, for the opaque data, byte and none encodings.
+
+  public:
+   // Public constructors and destructors.
+   /*! @brief Default constructor for the TrickHLAModel SyntheticPayload class. */
+   SyntheticPayload();
+   /*! @brief Destructor for the TrickHLAModel SyntheticPayload class. */
+   virtual ~SyntheticPayload();
+
+   /*! @brief Allocate the payload.
+    *  @param size   Size of the payload in bytes.
+    *  @param opaque True for a byte payload, false for a numeric payload. */
+   void allocate( int const size, bool const opaque );
+
+   /*! @brief Get the size of the payload in bytes.
+    *  @return The size of the payload in bytes. */
+   int get_size() const
+   {
+      return ( ( bytes != NULL ) ? byte_count : ( value_count * (int)sizeof( double ) ) );
+   }
+
+   /*! @brief Fill the payload with the pattern for a sequence number.
+    *  @param sequence The sequence number of the update. */
+   void fill( uint64_t const sequence );
+
+   /*! @brief Update the payload counts from the Trick allocation, which
+    * TrickHLA resizes when it decodes a payload of a different size. */
+   void update_size();
+
+   /*! @brief Check the payload holds a complete pattern.
+    *  @return True if the pattern is intact. */
+   bool verify() const;
+
+  private:
+   // Do not allow the copy constructor or assignment operator.
+   /*! @brief Copy constructor for SyntheticPayload class.
+    *  @details This constructor is private to prevent inadvertent copies. */
+   SyntheticPayload( SyntheticPayload const &rhs );
+   /*! @brief Assignment operator for SyntheticPayload class.
+    *  @details This assignment operator is private to prevent inadvertent copies. */
+   SyntheticPayload &operator=( SyntheticPayload const &rhs );
+};
+
+} // namespace TrickHLAModel
+
+#endif // TRICKHLA_MODEL_SYNTHETIC_PAYLOAD_HH: Do NOT put anything after this line!
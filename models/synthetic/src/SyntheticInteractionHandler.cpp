@@ -0,0 +1,209 @@
+/*!
+@ingroup Synthetic
+@file models/synthetic/src/SyntheticInteractionHandler.cpp
+@brief This class sends and receives the synthetic load interactions.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{../../../source/TrickHLA/InteractionHandler.cpp}
+@trick_link_dependency{../../../source/TrickHLA/time/Int64Interval.cpp}
+@trick_link_dependency{../../../source/TrickHLA/utils/LatencyHistogram.cpp}
+@trick_link_dependency{../../../source/TrickHLA/utils/StringUtilities.cpp}
+@trick_link_dependency{synthetic/src/SyntheticPayload.cpp}
+@trick_link_dependency{synthetic/src/SyntheticInteractionHandler.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System includes.
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <time.h>
+
+// Trick includes.
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+
+// TrickHLA includes.
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/HLAStandardSupport.hh"
+#include "TrickHLA/InteractionHandler.hh"
+#include "TrickHLA/Types.hh"
+#include "TrickHLA/time/Int64Interval.hh"
+#include "TrickHLA/utils/LatencyHistogram.hh"
+#include "TrickHLA/utils/StringUtilities.hh"
+
+// Model includes.
+#include "synthetic/include/SyntheticInteractionHandler.hh"
+#include "synthetic/include/SyntheticPayload.hh"
+
+// HLA includes.
+#include "RTI/VariableLengthData.h"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace TrickHLAModel;
+using namespace RTI1516_NAMESPACE;
+
+namespace
+{
+
+// Wall clock time in microseconds, which is comparable across hosts with
+// synchronized clocks.
+long long wall_time_micros()
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_REALTIME, &ts ); // NOLINT
+   return ( ( (long long)ts.tv_sec * 1000000 ) + ( (long long)ts.tv_nsec / 1000 ) );
+}
+
+} // namespace
+
+/*!
+ * @job_class{initialization}
+ */
+SyntheticInteractionHandler::SyntheticInteractionHandler()
+   : TrickHLA::InteractionHandler(),
+     send_count( 0 ),
+     receive_count( 0 ),
+     skipped_count( 0 ),
+     error_count( 0 ),
+     send_sequence( 0 ),
+     latency(),
+     name( NULL ),
+     send_rate( 0.0 ),
+     payload_size( 64 ),
+     received_sequence( 0 ),
+     send_wall( 0 ),
+     payload(),
+     send_budget( 0.0 ),
+     last_send_time( 0.0 ),
+     last_sequence()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+SyntheticInteractionHandler::~SyntheticInteractionHandler()
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void SyntheticInteractionHandler::initialize()
+{
+   payload.allocate( payload_size, true );
+
+   InteractionHandler::initialize();
+}
+
+/*!
+ * @details The interactions due since the last call are sent with the
+ * timestamp of the current simulation time plus the lookahead time, so a
+ * send rate above the calling rate sends a burst each call.
+ * @job_class{scheduled}
+ */
+void SyntheticInteractionHandler::send_interactions(
+   double const sim_time )
+{
+   if ( ( send_rate > 0.0 ) && ( sim_time > last_send_time ) ) {
+      send_budget += send_rate * ( sim_time - last_send_time );
+   }
+   last_send_time = sim_time;
+
+   if ( send_budget < 1.0 ) {
+      return;
+   }
+
+   // The name of the sender lets the receivers track each sender's sequence.
+   VariableLengthData user_supplied_tag;
+   if ( name != NULL ) {
+      string name_str   = name;
+      user_supplied_tag = VariableLengthData( name_str.c_str(), name_str.size() );
+   }
+
+   double const timestamp = sim_time + get_lookahead().get_time_in_seconds();
+
+   while ( send_budget >= 1.0 ) {
+      send_budget -= 1.0;
+
+      ++send_sequence;
+      received_sequence = send_sequence;
+      send_wall         = wall_time_micros();
+      payload.fill( send_sequence );
+
+      if ( InteractionHandler::send_interaction( timestamp, user_supplied_tag ) ) {
+         ++send_count;
+      }
+   }
+}
+
+void SyntheticInteractionHandler::receive_interaction(
+   VariableLengthData const &the_user_supplied_tag )
+{
+   ++receive_count;
+
+   // Clock offsets between the hosts can make the latency negative, which
+   // the histogram records as zero.
+   latency.record( wall_time_micros() - send_wall );
+
+   payload.update_size();
+   if ( !payload.verify() ) {
+      ++error_count;
+   }
+
+   string sender;
+   StringUtilities::to_string( sender, the_user_supplied_tag );
+
+   map< string, long long >::iterator iter = last_sequence.find( sender );
+   if ( ( iter != last_sequence.end() ) && ( received_sequence > ( iter->second + 1 ) ) ) {
+      skipped_count += (uint64_t)( received_sequence - iter->second - 1 );
+   }
+   last_sequence[sender] = received_sequence;
+
+   if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
+      ostringstream msg;
+      msg << "SyntheticInteractionHandler::receive_interaction():" << __LINE__
+          << " sender:'" << sender << "' sequence:" << received_sequence
+          << " receive-count:" << receive_count << endl;
+      message_publish( MSG_NORMAL, msg.str().c_str() );
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void SyntheticInteractionHandler::report() const
+{
+   ostringstream msg;
+   msg << "SyntheticInteractionHandler::report():" << __LINE__ << endl
+       << "  interactions sent:" << send_count
+       << " received:" << receive_count
+       << " skipped:" << skipped_count
+       << " errors:" << error_count << endl
+       << "  interaction latency:" << endl
+       << latency.to_string( "microseconds" ) << endl;
+   message_publish( MSG_NORMAL, msg.str().c_str() );
+}
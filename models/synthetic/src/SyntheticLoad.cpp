@@ -0,0 +1,152 @@
+/*!
+@ingroup Synthetic
+@file models/synthetic/src/SyntheticLoad.cpp
+@brief This class holds the packing of all the synthetic load objects of a
+federate and reports their throughput at shutdown.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{../../../source/TrickHLA/utils/QueueStats.cpp}
+@trick_link_dependency{synthetic/src/SyntheticPacking.cpp}
+@trick_link_dependency{synthetic/src/SyntheticLoad.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System includes.
+#include <cstdint>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+// Trick includes.
+#include "trick/MemoryManager.hh"
+#include "trick/exec_proto.h"
+#include "trick/memorymanager_c_intf.h"
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+
+// TrickHLA includes.
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/utils/QueueStats.hh"
+
+// Model includes.
+#include "synthetic/include/SyntheticLoad.hh"
+#include "synthetic/include/SyntheticPacking.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace TrickHLAModel;
+
+/*!
+ * @job_class{initialization}
+ */
+SyntheticLoad::SyntheticLoad()
+   : obj_count( 0 ),
+     objects( NULL ),
+     start_time( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+SyntheticLoad::~SyntheticLoad()
+{
+   if ( objects != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( objects ) ) ) {
+         message_publish( MSG_WARNING, "TrickHLAModel::SyntheticLoad::~SyntheticLoad():%d WARNING failed to delete Trick Memory for 'objects'\n",
+                          __LINE__ );
+      }
+      objects   = NULL;
+      obj_count = 0;
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void SyntheticLoad::configure(
+   int const count )
+{
+   if ( count <= 0 ) {
+      ostringstream errmsg;
+      errmsg << "SyntheticLoad::configure():" << __LINE__
+             << " ERROR: The object count " << count
+             << " must be greater than zero!" << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   obj_count = count;
+   objects   = static_cast< SyntheticPacking * >(
+      TMM_declare_var_1d( "TrickHLAModel::SyntheticPacking", obj_count ) );
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void SyntheticLoad::initialize()
+{
+   for ( int i = 0; i < obj_count; ++i ) {
+      objects[i].initialize();
+   }
+   start_time = QueueStats::monotonic_time();
+}
+
+/*!
+ * @details The throughput is per second of wall clock time from
+ * initialization to shutdown, so it includes the time spent waiting on the
+ * other federates.
+ * @job_class{shutdown}
+ */
+void SyntheticLoad::report() const
+{
+   uint64_t pack_count     = 0;
+   uint64_t unpack_count   = 0;
+   uint64_t packed_bytes   = 0;
+   uint64_t unpacked_bytes = 0;
+   uint64_t error_count    = 0;
+
+   for ( int i = 0; i < obj_count; ++i ) {
+      pack_count += objects[i].pack_count;
+      unpack_count += objects[i].unpack_count;
+      packed_bytes += objects[i].packed_bytes;
+      unpacked_bytes += objects[i].unpacked_bytes;
+      error_count += objects[i].error_count;
+   }
+
+   double const wall_time = (double)( QueueStats::monotonic_time() - start_time ) * 1.0e-9;
+   double const sim_time  = exec_get_sim_time();
+
+   ostringstream msg;
+   msg << "SyntheticLoad::report():" << __LINE__ << endl
+       << "  objects:" << obj_count << endl
+       << "  sim-time:" << sim_time << "s wall-time:" << wall_time << "s"
+       << " realtime-ratio:" << ( ( wall_time > 0.0 ) ? ( sim_time / wall_time ) : 0.0 ) << endl
+       << "  packed:" << pack_count << " updates, " << packed_bytes << " bytes" << endl
+       << "  unpacked:" << unpack_count << " updates, " << unpacked_bytes << " bytes" << endl
+       << "  payload-errors:" << error_count << endl;
+   if ( wall_time > 0.0 ) {
+      msg << "  pack-throughput:" << ( (double)pack_count / wall_time ) << " updates/s, "
+          << ( (double)packed_bytes / wall_time ) << " bytes/s" << endl
+          << "  unpack-throughput:" << ( (double)unpack_count / wall_time ) << " updates/s, "
+          << ( (double)unpacked_bytes / wall_time ) << " bytes/s" << endl;
+   }
+   message_publish( MSG_NORMAL, msg.str().c_str() );
+}
@@ -0,0 +1,176 @@
+/*!
+@ingroup Synthetic
+@file models/synthetic/src/SyntheticPacking.cpp
+@brief This class provides the data packing for a synthetic load object.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../../../source/TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{../../../source/TrickHLA/Packing.cpp}
+@trick_link_dependency{synthetic/src/SyntheticPayload.cpp}
+@trick_link_dependency{synthetic/src/SyntheticPacking.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System includes.
+#include <cstdint>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+// Trick includes.
+#include "trick/MemoryManager.hh"
+#include "trick/memorymanager_c_intf.h"
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+
+// TrickHLA includes.
+#include "TrickHLA/Attribute.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/Packing.hh"
+#include "TrickHLA/Types.hh"
+
+// Model includes.
+#include "synthetic/include/SyntheticPacking.hh"
+#include "synthetic/include/SyntheticPayload.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace TrickHLAModel;
+
+/*!
+ * @job_class{initialization}
+ */
+SyntheticPacking::SyntheticPacking()
+   : TrickHLA::Packing( "SyntheticPacking" ),
+     payload_count( 0 ),
+     payloads( NULL ),
+     pack_count( 0 ),
+     unpack_count( 0 ),
+     packed_bytes( 0 ),
+     unpacked_bytes( 0 ),
+     error_count( 0 ),
+     payload_attrs()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+SyntheticPacking::~SyntheticPacking()
+{
+   if ( payloads != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( payloads ) ) ) {
+         message_publish( MSG_WARNING, "TrickHLAModel::SyntheticPacking::~SyntheticPacking():%d WARNING failed to delete Trick Memory for 'payloads'\n",
+                          __LINE__ );
+      }
+      payloads      = NULL;
+      payload_count = 0;
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void SyntheticPacking::configure(
+   int const count )
+{
+   if ( ( count <= 0 ) || ( count > SYNTHETIC_MAX_PAYLOADS ) ) {
+      ostringstream errmsg;
+      errmsg << "SyntheticPacking::configure():" << __LINE__
+             << " ERROR: The payload count " << count
+             << " must be between 1 and " << SYNTHETIC_MAX_PAYLOADS
+             << ", the number of payload attributes in the FOM!" << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   payload_count = count;
+   payloads      = static_cast< SyntheticPayload * >(
+      TMM_declare_var_1d( "TrickHLAModel::SyntheticPayload", payload_count ) );
+}
+
+string SyntheticPacking::get_payload_FOM_name(
+   int const index )
+{
+   ostringstream name;
+   name << "Payload" << index;
+   return name.str();
+}
+
+/*!
+ * @details Look up the TrickHLA::Attribute of each payload once so that
+ * pack() and unpack() do not search for them every frame.
+ * @job_class{initialization}
+ */
+void SyntheticPacking::initialize_callback(
+   TrickHLA::Object *obj )
+{
+   // We must call the original function so that the callback is initialized.
+   Packing::initialize_callback( obj );
+
+   payload_attrs.resize( payload_count, NULL );
+   for ( int i = 0; i < payload_count; ++i ) {
+      payload_attrs[i] = get_attribute_and_validate( get_payload_FOM_name( i ) );
+   }
+}
+
+void SyntheticPacking::pack()
+{
+   ++pack_count;
+
+   for ( int i = 0; i < payload_count; ++i ) {
+      if ( payload_attrs[i]->is_publish() && payload_attrs[i]->is_locally_owned() ) {
+         payloads[i].fill( pack_count );
+         packed_bytes += payloads[i].get_size();
+      }
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_PACKING ) ) {
+      ostringstream msg;
+      msg << "SyntheticPacking::pack():" << __LINE__
+          << " Object:'" << ( ( object != NULL ) ? object->get_name() : "" ) << "'"
+          << " pack-count:" << pack_count
+          << " packed-bytes:" << packed_bytes << endl;
+      message_publish( MSG_NORMAL, msg.str().c_str() );
+   }
+}
+
+void SyntheticPacking::unpack()
+{
+   ++unpack_count;
+
+   for ( int i = 0; i < payload_count; ++i ) {
+      if ( payload_attrs[i]->is_received() ) {
+         payloads[i].update_size();
+         unpacked_bytes += payloads[i].get_size();
+         if ( !payloads[i].verify() ) {
+            ++error_count;
+            if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_PACKING ) ) {
+               ostringstream msg;
+               msg << "SyntheticPacking::unpack():" << __LINE__
+                   << " WARNING: Object:'" << ( ( object != NULL ) ? object->get_name() : "" )
+                   << "' attribute '" << get_payload_FOM_name( i )
+                   << "' has a broken payload pattern." << endl;
+               message_publish( MSG_WARNING, msg.str().c_str() );
+            }
+         }
+      }
+   }
+}
@@ -0,0 +1,140 @@
+/*!
+@ingroup Synthetic
+@file models/synthetic/src/SyntheticPayload.cpp
+@brief This class holds the data of one attribute of a synthetic load object.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{synthetic/src/SyntheticPayload.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System includes.
+#include <cstddef>
+#include <cstdint>
+
+// Trick includes.
+#include "trick/MemoryManager.hh"
+#include "trick/memorymanager_c_intf.h"
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+
+// Model includes.
+#include "synthetic/include/SyntheticPayload.hh"
+
+using namespace std;
+using namespace TrickHLAModel;
+
+/*!
+ * @job_class{initialization}
+ */
+SyntheticPayload::SyntheticPayload()
+   : value_count( 0 ),
+     values( NULL ),
+     byte_count( 0 ),
+     bytes( NULL )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+SyntheticPayload::~SyntheticPayload()
+{
+   if ( values != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( values ) ) ) {
+         message_publish( MSG_WARNING, "TrickHLAModel::SyntheticPayload::~SyntheticPayload():%d WARNING failed to delete Trick Memory for 'values'\n",
+                          __LINE__ );
+      }
+      values      = NULL;
+      value_count = 0;
+   }
+   if ( bytes != NULL ) {
+      if ( trick_MM->delete_var( static_cast< void * >( bytes ) ) ) {
+         message_publish( MSG_WARNING, "TrickHLAModel::SyntheticPayload::~SyntheticPayload():%d WARNING failed to delete Trick Memory for 'bytes'\n",
+                          __LINE__ );
+      }
+      bytes      = NULL;
+      byte_count = 0;
+   }
+}
+
+/*!
+ * @details A numeric payload is rounded up to a whole number of doubles.
+ * @job_class{initialization}
+ */
+void SyntheticPayload::allocate(
+   int const  size,
+   bool const opaque )
+{
+   int const payload_size = ( size > 0 ) ? size : 1;
+
+   if ( opaque ) {
+      byte_count = payload_size;
+      bytes      = static_cast< unsigned char * >( TMM_declare_var_1d( "unsigned char", byte_count ) );
+   } else {
+      value_count = ( payload_size + (int)sizeof( double ) - 1 ) / (int)sizeof( double );
+      values      = static_cast< double * >( TMM_declare_var_1d( "double", value_count ) );
+   }
+   fill( 0 );
+}
+
+void SyntheticPayload::fill(
+   uint64_t const sequence )
+{
+   if ( values != NULL ) {
+      for ( int i = 0; i < value_count; ++i ) {
+         values[i] = (double)( sequence + i );
+      }
+   }
+   if ( bytes != NULL ) {
+      for ( int i = 0; i < byte_count; ++i ) {
+         bytes[i] = (unsigned char)( ( sequence + i ) & 0xFF );
+      }
+   }
+}
+
+void SyntheticPayload::update_size()
+{
+   if ( values != NULL ) {
+      value_count = ::get_size( values );
+   }
+   if ( bytes != NULL ) {
+      byte_count = ::get_size( bytes );
+   }
+}
+
+bool SyntheticPayload::verify() const
+{
+   if ( values != NULL ) {
+      for ( int i = 1; i < value_count; ++i ) {
+         if ( values[i] != ( values[0] + i ) ) {
+            return false;
+         }
+      }
+   }
+   if ( bytes != NULL ) {
+      for ( int i = 1; i < byte_count; ++i ) {
+         if ( bytes[i] != (unsigned char)( ( bytes[0] + i ) & 0xFF ) ) {
+            return false;
+         }
+      }
+   }
+   return true;
+}
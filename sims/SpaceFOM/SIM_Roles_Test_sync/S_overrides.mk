@@ -15,5 +15,5 @@ endif
 # Construct Build Environment
 #=============================================================================
 
-TRICK_CFLAGS   += -I. -O3 -DTRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS -DTRICKHLA_CYCLIC_READ_TIME_STATS
-TRICK_CXXFLAGS += -I. -O3 -DTRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS -DTRICKHLA_CYCLIC_READ_TIME_STATS
+TRICK_CFLAGS   += -I. -O3 -DTRICKHLA_CYCLIC_READ_TIME_STATS
+TRICK_CXXFLAGS += -I. -O3 -DTRICKHLA_CYCLIC_READ_TIME_STATS
@@ -0,0 +1,17 @@
+##############################################################################
+# PURPOSE:
+#    (Python input file for configuring the SpaceFOM encoder check
+#     simulation.)
+#
+# REFERENCE:
+#    (Trick 19 documentation.)
+#
+# ASSUMPTIONS AND LIMITATIONS:
+#    ((None))
+#
+# PROGRAMMERS:
+#    (((Edwin Z. Crues) (NASA/ER7) (Oct 2026) (--) (Initial implementation.)))
+##############################################################################
+
+# The checks run and the simulation terminates in the initialization jobs.
+trick.exec_set_terminate_time( 1.0 )
@@ -0,0 +1,103 @@
+##############################################################################
+# PURPOSE:
+#    (Python input file for configuring the lag compensation test simulation.)
+#
+# REFERENCE:
+#    (Trick 19 documentation.)
+#
+# ASSUMPTIONS AND LIMITATIONS:
+#    ((None))
+#
+# PROGRAMMERS:
+#    (((Edwin Z. Crues) (NASA/ER7) (Oct 2026) (--) (Initial implementation.)))
+##############################################################################
+import sys
+sys.path.append( '../../../' )
+
+
+def print_usage_message():
+
+   print( ' ' )
+   print( 'TrickHLA Lag Compensation Test Simulation Command Line Configuration Options:' )
+   print( '  -h --help              : Print this help message.' )
+   print( ' ' )
+
+   trick.exec_terminate_with_return( -1,
+                                     sys._getframe( 0 ).f_code.co_filename,
+                                     sys._getframe( 0 ).f_lineno,
+                                     'Print usage message.' )
+   return
+
+
+def parse_command_line():
+
+   global print_usage
+
+   # Get the Trick command line arguments.
+   argc = trick.command_line_args_get_argc()
+   argv = trick.command_line_args_get_argv()
+
+   # Process the command line arguments.
+   # argv[0]=S_main*.exe, argv[1]=RUN/input.py file
+   index = 2
+   while ( index < argc ):
+
+      if ( ( str( argv[index] ) == '-h' ) | ( str( argv[index] ) == '--help' ) ):
+         print_usage = True
+
+      elif ( ( str( argv[index] ) == '-d' ) ):
+         # Pass this on to Trick.
+         break
+
+      else:
+         print( 'ERROR: Unknown command line argument ' + str( argv[index] ) )
+         print_usage = True
+
+      index = index + 1
+   return
+
+
+# Default: Don't show usage.
+print_usage = False
+
+parse_command_line()
+
+if ( print_usage == True ):
+   print_usage_message()
+
+#---------------------------------------------------------------------------
+# Initial state with non-parallel angular velocity and angular acceleration
+# so the closed-form attitude propagation exercises the commutator term.
+#---------------------------------------------------------------------------
+T.lag_comp_test.init_state.time       = 0.0
+T.lag_comp_test.init_state.pos        = [ 7000000.0, 1000.0, -2000.0 ]
+T.lag_comp_test.init_state.vel        = [ 10.0, 7500.0, 5.0 ]
+T.lag_comp_test.init_state.att.scalar = 0.8
+T.lag_comp_test.init_state.att.vector = [ 0.2, -0.3, 0.4 ]
+T.lag_comp_test.init_state.att.normalize()
+T.lag_comp_test.init_state.ang_vel    = [ 0.3, -0.2, 0.5 ]
+
+T.lag_comp_test.accel     = [ -8.1, 0.5, 0.01 ]
+T.lag_comp_test.ang_accel = [ 0.05, 0.1, -0.07 ]
+
+# Compensation interval and the reference integrator step size. The
+# reference solution uses the first order Euler integrator so the step
+# size must be small for the comparison to be meaningful.
+T.lag_comp_test.compensate_dt = 0.25
+T.lag_comp_test.integ_dt      = 1.0e-5
+
+# Local error tolerance for the adaptive step Dormand-Prince integrator.
+T.lag_comp_test.integ_tol = 1.0e-10
+
+# Received state history size and sample spacing.
+T.lag_comp_test.history_size = 8
+T.lag_comp_test.history_dt   = 0.01
+
+# Tolerances on the difference between the two solutions.
+T.lag_comp_test.pos_tol     = 1.0e-3
+T.lag_comp_test.vel_tol     = 1.0e-3
+T.lag_comp_test.att_tol     = 1.0e-5
+T.lag_comp_test.ang_vel_tol = 1.0e-8
+
+# Number of compensations used to time each method.
+T.lag_comp_test.timing_count = 100
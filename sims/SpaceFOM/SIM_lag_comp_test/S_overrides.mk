@@ -0,0 +1,20 @@
+#=============================================================================
+# Allow user to specify their own package locations.
+#   - File is skipped if not present
+#=============================================================================
+-include ${HOME}/.trickhla/S_user_env.mk
+
+ifdef TRICKHLA_HOME
+   TRICK_SFLAGS += -I${TRICKHLA_HOME}/S_modules
+   include ${TRICKHLA_HOME}/makefiles/S_hla.mk
+else
+   $(error S_overrides.mk:ERROR: You must set the TRICKHLA_HOME environment variable.)
+endif
+
+#=============================================================================
+# Construct Build Environment
+#=============================================================================
+
+# Add -Werror to turn warnings into errors.
+TRICK_CFLAGS   += -I. -I../../models
+TRICK_CXXFLAGS += -I. -I../../models
@@ -0,0 +1,144 @@
+##############################################################################
+# PURPOSE:
+#    (Python input file for configuring the SpaceFOM scale benchmark
+#     simulation.)
+#
+# REFERENCE:
+#    (Trick 19 documentation.)
+#
+# ASSUMPTIONS AND LIMITATIONS:
+#    ((None))
+#
+# PROGRAMMERS:
+#    (((Edwin Z. Crues) (NASA/ER7) (Oct 2026) (--) (Initial implementation.)))
+##############################################################################
+import sys
+sys.path.append( '../../../' )
+
+
+def print_usage_message():
+
+   print( ' ' )
+   print( 'TrickHLA SpaceFOM Scale Benchmark Simulation Command Line Configuration Options:' )
+   print( '  -h --help              : Print this help message.' )
+   print( '  --depth [levels]       : Number of frame levels below the root frame, default is 3.' )
+   print( '  --fanout [count]       : Number of child frames of each non-leaf frame, default is 4.' )
+   print( '  --physical [count]     : Number of PhysicalEntity objects, default is 100.' )
+   print( '  --dynamical [count]    : Number of DynamicalEntity objects, default is 100.' )
+   print( '  --iterations [count]   : Number of times each phase is timed, default is 100.' )
+   print( ' ' )
+
+   trick.exec_terminate_with_return( -1,
+                                     sys._getframe( 0 ).f_code.co_filename,
+                                     sys._getframe( 0 ).f_lineno,
+                                     'Print usage message.' )
+   return
+
+
+def parse_command_line():
+
+   global print_usage
+   global tree_depth
+   global tree_fanout
+   global physical_count
+   global dynamical_count
+   global iterations
+
+   # Get the Trick command line arguments.
+   argc = trick.command_line_args_get_argc()
+   argv = trick.command_line_args_get_argv()
+
+   # Process the command line arguments.
+   # argv[0]=S_main*.exe, argv[1]=RUN/input.py file
+   index = 2
+   while ( index < argc ):
+
+      if ( ( str( argv[index] ) == '-h' ) | ( str( argv[index] ) == '--help' ) ):
+         print_usage = True
+
+      elif ( str( argv[index] ) == '--depth' ):
+         index = index + 1
+         if ( index < argc ):
+            tree_depth = int( str( argv[index] ) )
+         else:
+            print( 'ERROR: Missing --depth [levels] argument.' )
+            print_usage = True
+
+      elif ( str( argv[index] ) == '--fanout' ):
+         index = index + 1
+         if ( index < argc ):
+            tree_fanout = int( str( argv[index] ) )
+         else:
+            print( 'ERROR: Missing --fanout [count] argument.' )
+            print_usage = True
+
+      elif ( str( argv[index] ) == '--physical' ):
+         index = index + 1
+         if ( index < argc ):
+            physical_count = int( str( argv[index] ) )
+         else:
+            print( 'ERROR: Missing --physical [count] argument.' )
+            print_usage = True
+
+      elif ( str( argv[index] ) == '--dynamical' ):
+         index = index + 1
+         if ( index < argc ):
+            dynamical_count = int( str( argv[index] ) )
+         else:
+            print( 'ERROR: Missing --dynamical [count] argument.' )
+            print_usage = True
+
+      elif ( str( argv[index] ) == '--iterations' ):
+         index = index + 1
+         if ( index < argc ):
+            iterations = int( str( argv[index] ) )
+         else:
+            print( 'ERROR: Missing --iterations [count] argument.' )
+            print_usage = True
+
+      elif ( ( str( argv[index] ) == '-d' ) ):
+         # Pass this on to Trick.
+         break
+
+      else:
+         print( 'ERROR: Unknown command line argument ' + str( argv[index] ) )
+         print_usage = True
+
+      index = index + 1
+   return
+
+
+# Default: Don't show usage.
+print_usage = False
+
+# Default benchmark size: 85 frames and 200 entities.
+tree_depth      = 3
+tree_fanout     = 4
+physical_count  = 100
+dynamical_count = 100
+iterations      = 100
+
+parse_command_line()
+
+if ( print_usage == True ):
+   print_usage_message()
+
+#---------------------------------------------------------------------------
+# Reference frame tree shape. The tree has 1 + fanout + ... + fanout^depth
+# frames, and the tree paths and the all-pairs transformations grow with the
+# square of the number of frames.
+#---------------------------------------------------------------------------
+B.benchmark.tree_depth  = tree_depth
+B.benchmark.tree_fanout = tree_fanout
+
+#---------------------------------------------------------------------------
+# Entities, which are parented to the leaf frames of the tree.
+#---------------------------------------------------------------------------
+B.benchmark.physical_count  = physical_count
+B.benchmark.dynamical_count = dynamical_count
+
+# Lag compensation interval.
+B.benchmark.compensate_dt = 0.05
+
+# Number of times each phase is timed.
+B.benchmark.iterations = iterations
@@ -0,0 +1,119 @@
+##############################################################################
+# PURPOSE:
+#    (This is an input file python routine to configure the TrickHLA object
+#     pool for the PoolEntity class and the entity spawner of a federate.
+#     All the federates of a run read this file so they agree on the pool.)
+#
+# REFERENCE:
+#    (Trick 17 documentation.)
+#
+# ASSUMPTIONS AND LIMITATIONS:
+#    ((Assumes that trick, THLA, THLA_INIT and EP are available globally.))
+#
+# PROGRAMMERS:
+#    (((Edwin Z. Crues) (NASA/ER7) (Oct 2026) (--) (Initial implementation.)))
+##############################################################################
+import sys
+
+#---------------------------------------------
+# Object pool parameters.
+#---------------------------------------------
+# Federates in the run. The first one owns the simulation configuration.
+pool_federates = [ 'A-side-Federate', 'P-side-Federate' ]
+
+# Number of PoolEntity instances each federate keeps alive, where a
+# federate with none only receives the instances of the other federates.
+pool_max_live = { 'A-side-Federate' : 8,
+                  'P-side-Federate' : 3 }
+
+# Time between the new instances and the time each instance lives.
+pool_spawn_period = 0.5
+pool_lifetime     = 2.0
+
+# Slots allocated at initialization and the free slots the main thread keeps
+# allocated ahead of the discoveries. These are smaller than the number of
+# live instances so the pool grows and the discoveries wait for free slots.
+pool_initial_capacity = 2
+pool_min_free_slots   = 1
+
+# Data cycle time, which must match THLA_DATA_CYCLE_TIME in the S_define.
+pool_data_cycle_time = 0.050
+
+pool_run_duration = 20.0
+
+
+#---------------------------------------------
+# Generate the configuration.
+#---------------------------------------------
+def configure_object_pool( federate_name ):
+
+   if federate_name not in pool_federates:
+      trick.exec_terminate_with_return( -1,
+                                        sys._getframe( 0 ).f_code.co_filename,
+                                        sys._getframe( 0 ).f_lineno,
+                                        'Federate \'' + federate_name + '\' is not in pool_federates.' )
+
+   trick.exec_set_software_frame( pool_data_cycle_time )
+   trick.exec_set_terminate_time( pool_run_duration )
+
+   # Federate and federation.
+   THLA.federate.name             = federate_name
+   THLA.federate.FOM_modules      = 'FOMs/ObjectPool.xml,FOMs/TrickHLAFreezeInteraction.xml'
+   THLA.federate.federation_name  = 'ObjectPoolSim'
+   THLA.federate.local_settings   = 'crcHost = localhost\n crcPort = 8989'
+   THLA.federate.lookahead_time   = pool_data_cycle_time
+   THLA.federate.time_regulating  = True
+   THLA.federate.time_constrained = True
+   THLA.federate.set_HLA_base_time_unit_and_scale_trick_tics( trick.HLA_BASE_TIME_MICROSECONDS )
+
+   THLA.execution_control.sim_timeline      = THLA_INIT.sim_timeline
+   THLA.execution_control.scenario_timeline = THLA_INIT.scenario_timeline
+
+   THLA.federate.enable_known_feds = True
+   THLA.federate.known_feds_count  = len( pool_federates )
+   THLA.federate.known_feds        = trick.sim_services.alloc_type( THLA.federate.known_feds_count, 'TrickHLA::KnownFederate' )
+   for indx in range( len( pool_federates ) ):
+      THLA.federate.known_feds[indx].name     = pool_federates[indx]
+      THLA.federate.known_feds[indx].required = True
+
+   THLA.simple_sim_config.owner        = pool_federates[0]
+   THLA.simple_sim_config.run_duration = pool_run_duration
+
+   # The instances come and go at runtime, so there are no TrickHLA objects
+   # in the objects array, only the pool for the PoolEntity class. The
+   # attribute Trick names are relative to the TrickHLAModel::PoolEntity
+   # data the pool allocates for each instance. The federate publishes the
+   # attributes of its own instances and subscribes to the attributes of
+   # the instances of the other federates.
+   THLA.manager.pool_count   = 1
+   THLA.manager.object_pools = trick.sim_services.alloc_type( THLA.manager.pool_count, 'TrickHLA::ObjectPool' )
+
+   pool = THLA.manager.object_pools[0]
+   pool.FOM_name         = 'PoolEntity'
+   pool.data_type        = 'TrickHLAModel::PoolEntity'
+   pool.initial_capacity = pool_initial_capacity
+   pool.min_free_slots   = pool_min_free_slots
+   pool.attr_count       = 2
+   pool.attributes       = trick.sim_services.alloc_type( pool.attr_count, 'TrickHLA::Attribute' )
+
+   pool.attributes[0].FOM_name     = 'Time'
+   pool.attributes[0].trick_name   = 'time'
+   pool.attributes[0].config       = trick.CONFIG_CYCLIC
+   pool.attributes[0].publish      = True
+   pool.attributes[0].subscribe    = True
+   pool.attributes[0].rti_encoding = trick.ENCODING_LITTLE_ENDIAN
+
+   pool.attributes[1].FOM_name     = 'Position'
+   pool.attributes[1].trick_name   = 'position'
+   pool.attributes[1].config       = trick.CONFIG_CYCLIC
+   pool.attributes[1].publish      = True
+   pool.attributes[1].subscribe    = True
+   pool.attributes[1].rti_encoding = trick.ENCODING_LITTLE_ENDIAN
+
+   # Entity spawner.
+   EP.spawner.FOM_name     = 'PoolEntity'
+   EP.spawner.max_live     = pool_max_live[federate_name]
+   EP.spawner.spawn_period = pool_spawn_period
+   EP.spawner.lifetime     = pool_lifetime
+
+   return
@@ -0,0 +1,23 @@
+#---------------------------------------------
+# Set up Trick executive parameters.
+#---------------------------------------------
+#instruments.echo_jobs.echo_jobs_on()
+trick.exec_set_trap_sigfpe(True)
+trick.exec_set_stack_trace(False)
+
+
+#---------------------------------------------
+# Set up the object pool.
+#---------------------------------------------
+# The pool parameters are shared by all the federates of a run, so change
+# them in Modified_data/object_pool.py.
+exec(open( "Modified_data/object_pool.py" ).read())
+
+configure_object_pool( 'P-side-Federate' )
+
+
+# =========================================================================
+# Set up HLA interoperability.
+# =========================================================================
+# Show or hide the TrickHLA debug messages.
+THLA.federate.debug_level = trick.DEBUG_LEVEL_1_TRACE
@@ -0,0 +1,236 @@
+##############################################################################
+# PURPOSE:
+#    (This is an input file python routine to set the parameters of the
+#     synthetic load and to generate the TrickHLA object, attribute and
+#     interaction configuration from them. All the federates of a run
+#     read this file so they agree on the load.)
+#
+# REFERENCE:
+#    (Trick 17 documentation.)
+#
+# ASSUMPTIONS AND LIMITATIONS:
+#    ((Assumes that trick, THLA and SL are available globally.)
+#     (Each object has at most 16 attributes, the Payload0 to Payload15
+#      attributes of the SyntheticLoad class in FOMs/SyntheticLoad.xml.))
+#
+# PROGRAMMERS:
+#    (((Edwin Z. Crues) (NASA/ER7) (Oct 2026) (--) (Initial implementation.)))
+##############################################################################
+import sys
+
+#---------------------------------------------
+# Synthetic load parameters.
+#---------------------------------------------
+# Federates in the run. The first one owns the simulation configuration.
+# Add a name here and a RUN directory setting federate_name to it to run
+# more federates.
+load_federates = [ 'A-side-Federate', 'P-side-Federate' ]
+
+# Number of object instances each federate creates and publishes. Each
+# federate also subscribes to the objects of all the other federates.
+load_obj_count = 10
+
+# Number of attributes per object, from 1 to 16.
+load_attr_count = 4
+
+# Size of each attribute in bytes, repeated over the attributes.
+load_attr_sizes = [ 8, 64, 512, 4096 ]
+
+# Encoding of each attribute, repeated over the attributes. The endian
+# encodings send a double array and the opaque data encoding a byte array.
+load_attr_encodings = [ trick.ENCODING_LITTLE_ENDIAN,
+                        trick.ENCODING_BIG_ENDIAN,
+                        trick.ENCODING_OPAQUE_DATA ]
+
+# Send cycle time of each attribute in seconds, repeated over the attributes.
+# Each must be a multiple of the data cycle time (THLA_DATA_CYCLE_TIME).
+load_attr_cycle_times = [ 0.05, 0.1, 0.25, 1.0 ]
+
+# Trick thread of each object, repeated over the objects, where 0 is the
+# main thread and 1 and 2 are the child threads associated in the S_define.
+load_thread_ids = [ 0, 1, 2 ]
+
+# Interactions each federate sends per second and their payload in bytes.
+load_interaction_rate = 20.0
+load_interaction_size = 256
+
+# Data cycle time of the main and child threads, which must match
+# THLA_DATA_CYCLE_TIME in the S_define.
+load_data_cycle_time = 0.05
+
+# Run length in seconds, and whether to run in real time. Without real time
+# the federation runs as fast as the slowest federate, which shows the
+# scaling limit.
+load_run_duration = 30.0
+load_real_time    = False
+
+# Measure the update latency with the latency header in the user supplied tag.
+load_measure_latency = True
+
+# Number of frames between the frame profiler reports, the CSV file in the
+# RUN directory the frame-time breakdown is appended to, and the number of
+# objects, attributes and interactions in the shutdown traffic report.
+load_frame_report_period  = 200
+load_frame_profile_csv    = 'frame_profile.csv'
+load_traffic_report_count = 10
+
+# Name the federate holding back the time advance grant in the waiting
+# messages and report the time each federate held it back at shutdown,
+# sampling the MOM time attributes every this many seconds of a slow wait.
+load_time_straggler_monitor       = True
+load_time_straggler_sample_period = 0.1
+
+# Record the traffic each federate receives to a binary log in its RUN
+# directory, or replay a recorded log through the receive side of a single
+# federate running alone, at full speed (pace rate 0.0) or paced by the
+# recorded wall clock (pace rate 1.0 for the recorded rate).
+load_traffic_record_file      = ''
+load_traffic_replay_file      = ''
+load_traffic_replay_pace_rate = 0.0
+
+
+#---------------------------------------------
+# Generate the configuration.
+#---------------------------------------------
+def configure_synthetic_load( federate_name ):
+
+   if federate_name not in load_federates:
+      trick.exec_terminate_with_return( -1,
+                                        sys._getframe( 0 ).f_code.co_filename,
+                                        sys._getframe( 0 ).f_lineno,
+                                        'Federate \'' + federate_name + '\' is not in load_federates.' )
+
+   # Trick executive and threads.
+   if load_real_time:
+      trick.real_time_enable()
+   trick.exec_set_software_frame( load_data_cycle_time )
+   trick.exec_set_terminate_time( load_run_duration )
+
+   child_thread_ids = sorted( set( [ id for id in load_thread_ids if id > 0 ] ) )
+   for thread_id in child_thread_ids:
+      trick.exec_set_thread_process_type( thread_id, trick.PROCESS_TYPE_AMF_CHILD )
+      trick.exec_set_thread_amf_cycle_time( thread_id, load_data_cycle_time )
+   unused_thread_ids = [ str( id ) for id in [ 1, 2 ] if id not in child_thread_ids ]
+   if unused_thread_ids:
+      THLA.federate.disable_trick_child_thread_associations( ', '.join( unused_thread_ids ) )
+
+   # Federate and federation.
+   THLA.federate.name             = federate_name
+   THLA.federate.FOM_modules      = 'FOMs/SyntheticLoad.xml,FOMs/TrickHLAFreezeInteraction.xml'
+   THLA.federate.federation_name  = 'SyntheticLoadSim'
+   THLA.federate.local_settings   = 'crcHost = localhost\n crcPort = 8989'
+   THLA.federate.lookahead_time   = load_data_cycle_time
+   THLA.federate.time_regulating  = True
+   THLA.federate.time_constrained = True
+   THLA.federate.set_HLA_base_time_unit_and_scale_trick_tics( trick.HLA_BASE_TIME_MICROSECONDS )
+
+   THLA.execution_control.sim_timeline      = THLA_INIT.sim_timeline
+   THLA.execution_control.scenario_timeline = THLA_INIT.scenario_timeline
+
+   # A replaying federate runs alone, so it is the only required federate
+   # and it owns the simulation configuration.
+   replaying = ( load_traffic_replay_file != '' )
+
+   THLA.federate.enable_known_feds = True
+   THLA.federate.known_feds_count  = len( load_federates )
+   THLA.federate.known_feds        = trick.sim_services.alloc_type( THLA.federate.known_feds_count, 'TrickHLA::KnownFederate' )
+   for indx in range( len( load_federates ) ):
+      THLA.federate.known_feds[indx].name     = load_federates[indx]
+      THLA.federate.known_feds[indx].required = ( not replaying ) or ( load_federates[indx] == federate_name )
+
+   THLA.simple_sim_config.owner        = federate_name if replaying else load_federates[0]
+   THLA.simple_sim_config.run_duration = load_run_duration
+
+   # Reports: the frame-time breakdown, the traffic totals and the update
+   # latency are reported at shutdown, along with the SyntheticLoad
+   # throughput and the interaction latency.
+   THLA.federate.frame_profiler.enabled       = True
+   THLA.federate.frame_profiler.report_period = load_frame_report_period
+   THLA.federate.frame_profiler.csv_file      = trick.command_line_args_get_output_dir() + '/' + load_frame_profile_csv
+   THLA.manager.traffic_report_count          = load_traffic_report_count
+   THLA.federate.time_straggler_monitor.enabled       = load_time_straggler_monitor and not replaying
+   THLA.federate.time_straggler_monitor.sample_period = load_time_straggler_sample_period
+
+   # Traffic recording and replay.
+   if load_traffic_record_file != '':
+      THLA.manager.traffic_recorder.file_name = trick.command_line_args_get_output_dir() + '/' + load_traffic_record_file
+   if replaying:
+      THLA.manager.traffic_replay.file_name = load_traffic_replay_file
+      THLA.manager.traffic_replay.pace_rate = load_traffic_replay_pace_rate
+
+   # Objects: each federate creates its own objects and subscribes to the
+   # objects of all the other federates.
+   obj_count = len( load_federates ) * load_obj_count
+   SL.load.configure( obj_count )
+
+   THLA.manager.obj_count = obj_count
+   THLA.manager.objects   = trick.sim_services.alloc_type( THLA.manager.obj_count, 'TrickHLA::Object' )
+
+   indx = 0
+   for fed_name in load_federates:
+      is_local = ( fed_name == federate_name )
+
+      for obj in range( load_obj_count ):
+         packing = SL.load.objects[indx]
+         packing.configure( load_attr_count )
+
+         hla_obj = THLA.manager.objects[indx]
+         hla_obj.FOM_name               = 'SyntheticLoad'
+         hla_obj.name                   = fed_name + '.Load' + str( obj )
+         hla_obj.create_HLA_instance    = is_local
+         hla_obj.required               = is_local or not replaying
+         hla_obj.thread_ids             = str( load_thread_ids[obj % len( load_thread_ids )] )
+         hla_obj.packing                = packing
+         hla_obj.update_latency.enabled = load_measure_latency
+         hla_obj.attr_count             = load_attr_count
+         hla_obj.attributes             = trick.sim_services.alloc_type( hla_obj.attr_count, 'TrickHLA::Attribute' )
+
+         for attr in range( load_attr_count ):
+            encoding = load_attr_encodings[attr % len( load_attr_encodings )]
+            opaque   = ( encoding == trick.ENCODING_OPAQUE_DATA )
+            packing.payloads[attr].allocate( load_attr_sizes[attr % len( load_attr_sizes )], opaque )
+
+            trick_name  = 'SL.load.objects[' + str( indx ) + '].payloads[' + str( attr ) + ']'
+            trick_name += '.bytes' if opaque else '.values'
+
+            hla_attr = hla_obj.attributes[attr]
+            hla_attr.FOM_name      = 'Payload' + str( attr )
+            hla_attr.trick_name    = trick_name
+            hla_attr.config        = trick.CONFIG_CYCLIC
+            hla_attr.publish       = is_local
+            hla_attr.subscribe     = not is_local
+            hla_attr.locally_owned = is_local
+            hla_attr.rti_encoding  = encoding
+            hla_attr.cycle_time    = load_attr_cycle_times[attr % len( load_attr_cycle_times )]
+
+         indx += 1
+
+   # Interactions: every federate publishes and subscribes to the one
+   # SyntheticEvent interaction class.
+   SL.interaction_handler.name         = federate_name
+   SL.interaction_handler.send_rate    = load_interaction_rate
+   SL.interaction_handler.payload_size = load_interaction_size
+
+   THLA.manager.inter_count  = 1
+   THLA.manager.interactions = trick.sim_services.alloc_type( THLA.manager.inter_count, 'TrickHLA::Interaction' )
+
+   THLA.manager.interactions[0].FOM_name    = 'SyntheticEvent'
+   THLA.manager.interactions[0].publish     = True
+   THLA.manager.interactions[0].subscribe   = True
+   THLA.manager.interactions[0].handler     = SL.interaction_handler
+   THLA.manager.interactions[0].param_count = 3
+   THLA.manager.interactions[0].parameters  = trick.sim_services.alloc_type( THLA.manager.interactions[0].param_count, 'TrickHLA::Parameter' )
+
+   THLA.manager.interactions[0].parameters[0].FOM_name     = 'Sequence'
+   THLA.manager.interactions[0].parameters[0].trick_name   = 'SL.interaction_handler.received_sequence'
+   THLA.manager.interactions[0].parameters[0].rti_encoding = trick.ENCODING_LITTLE_ENDIAN
+
+   THLA.manager.interactions[0].parameters[1].FOM_name     = 'SendWallTime'
+   THLA.manager.interactions[0].parameters[1].trick_name   = 'SL.interaction_handler.send_wall'
+   THLA.manager.interactions[0].parameters[1].rti_encoding = trick.ENCODING_LITTLE_ENDIAN
+
+   THLA.manager.interactions[0].parameters[2].FOM_name     = 'Payload'
+   THLA.manager.interactions[0].parameters[2].trick_name   = 'SL.interaction_handler.payload.bytes'
+   THLA.manager.interactions[0].parameters[2].rti_encoding = trick.ENCODING_OPAQUE_DATA
+
+   return
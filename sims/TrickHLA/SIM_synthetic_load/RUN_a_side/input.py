@@ -0,0 +1,23 @@
+#---------------------------------------------
+# Set up Trick executive parameters.
+#---------------------------------------------
+#instruments.echo_jobs.echo_jobs_on()
+trick.exec_set_trap_sigfpe(True)
+trick.exec_set_stack_trace(False)
+
+
+#---------------------------------------------
+# Set up the synthetic load.
+#---------------------------------------------
+# The load parameters are shared by all the federates of a run, so change
+# them in Modified_data/synthetic_load.py.
+exec(open( "Modified_data/synthetic_load.py" ).read())
+
+configure_synthetic_load( 'A-side-Federate' )
+
+
+# =========================================================================
+# Set up HLA interoperability.
+# =========================================================================
+# Show or hide the TrickHLA debug messages.
+THLA.federate.debug_level = trick.DEBUG_LEVEL_1_TRACE
@@ -184,6 +184,19 @@ void DynamicalEntityLagComp::unload()
       *( integ_states[iinc] ) = integrator->state[iinc];
    }
 
+   // Compute the derivative of the attitude quaternion from the
+   // angular velocity vector.
+   Q_dot.derivative_first( this->lag_comp_data.att, this->lag_comp_data.ang_vel );
+
+   // Return to calling routine.
+   return;
+}
+
+/*!
+ * @job_class{integration}
+ */
+void DynamicalEntityLagComp::normalize_state()
+{
    // Normalize the propagated attitude quaternion.
    lag_comp_data.att.normalize();
 
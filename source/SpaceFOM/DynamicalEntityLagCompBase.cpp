@@ -154,136 +154,38 @@ void DynamicalEntityLagCompBase::initialize_states()
    return;
 }
 
-/*! @brief Sending side latency compensation callback interface from the
- *  TrickHLALagCompensation class. */
-void DynamicalEntityLagCompBase::send_lag_compensation()
-{
-   double begin_t = get_scenario_time();
-   double end_t;
-
-   // Save the compensation time step.
-   this->compensate_dt = get_lookahead().get_time_in_seconds();
-   end_t               = begin_t + this->compensate_dt;
-
-   // Use the inherited debug-handler to allow debug comments to be turned
-   // on and off from a setting in the input file.
-   if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
-      ostringstream errmsg;
-      errmsg << "******* DynamicalEntityLagCompInteg::send_lag_compensation():" << __LINE__ << endl
-             << " scenario-time:" << get_scenario_time() << endl
-             << "     lookahead:" << this->compensate_dt << endl
-             << " adjusted-time:" << end_t << endl;
-      message_publish( MSG_WARNING, errmsg.str().c_str() );
-   }
-
-   // Copy the current DynamicalEntity state over to the lag compensated state.
-   entity.pack_from_working_data();
-   load_lag_comp_data();
-   Q_dot.derivative_first( this->lag_comp_data.att, this->lag_comp_data.ang_vel );
-
-   // Print out debug information if desired.
-   if ( debug ) {
-      ostringstream msg;
-      msg << "Send data before compensation: " << endl;
-      print_lag_comp_data( msg );
-      message_publish( MSG_NORMAL, msg.str().c_str() );
-   }
-
-   // Compensate the data
-   compensate( begin_t, end_t );
-
-   // Print out debug information if desired.
-   if ( debug ) {
-      ostringstream msg;
-      msg << "Send data after compensation: " << endl;
-      print_lag_comp_data( msg );
-      message_publish( MSG_NORMAL, msg.str().c_str() );
-   }
-
-   // Copy the compensated state to the packing data.
-   unload_lag_comp_data();
-
-   // Return to calling routine.
-   return;
-}
-
-/*! @brief Receive side latency compensation callback interface from the
- *  TrickHLALagCompensation class. */
-void DynamicalEntityLagCompBase::receive_lag_compensation()
+/*!
+ * @job_class{scheduled}
+ */
+bool DynamicalEntityLagCompBase::begin_receive_lag_compensation()
 {
-   double end_t  = get_scenario_time();
-   double data_t = entity.get_time();
+   // Load the received state using the base class implementation.
+   bool const state_received = PhysicalEntityLagCompBase::begin_receive_lag_compensation();
 
-   // Save the compensation time step.
-   this->compensate_dt = end_t - data_t;
-
-   // Use the inherited debug-handler to allow debug comments to be turned
-   // on and off from a setting in the input file.
-   if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
+   if ( !state_received && debug ) {
       ostringstream errmsg;
-      errmsg << "******* DynamicalEntityLagCompInteg::receive_lag_compensation():" << __LINE__ << endl
-             << "  scenario-time:" << end_t << endl
-             << "      data-time:" << data_t << endl
-             << " comp-time-step:" << this->compensate_dt << endl;
+      errmsg << "DynamicalEntityLagCompBase::begin_receive_lag_compensation(): No state data received." << endl
+             << "\tvalue_changed: " << state_attr->is_changed()
+             << "; locally owned: " << state_attr->locally_owned << endl;
       message_publish( MSG_WARNING, errmsg.str().c_str() );
    }
 
-   // Because of ownership transfers and attributes being sent at different
-   // rates we need to check to see if we received attribute data.
-   if ( state_attr->is_received() ) {
-
-      // Copy the current DynamicalEntity state over to the lag compensated state.
-      load_lag_comp_data();
-      Q_dot.derivative_first( this->lag_comp_data.att, this->lag_comp_data.ang_vel );
-
-      // Print out debug information if desired.
-      if ( debug ) {
-         ostringstream msg;
-         msg << "Receive data before compensation: " << endl;
-         print_lag_comp_data( msg );
-         message_publish( MSG_NORMAL, msg.str().c_str() );
-      }
-
-      // Compensate the data
-      compensate( data_t, end_t );
-
-      // Print out debug information if desired.
-      if ( debug ) {
-         ostringstream msg;
-         msg << "Receive data after compensation: " << endl;
-         print_lag_comp_data( msg );
-         message_publish( MSG_NORMAL, msg.str().c_str() );
-      }
-
-   } else {
-      if ( debug ) {
-         ostringstream errmsg;
-         errmsg << "DynamicalEntityLagCompInteg::receive_lag_compensation(): No state data received." << endl
-                << "\tvalue_changed: " << state_attr->is_changed()
-                << "; locally owned: " << state_attr->locally_owned << endl;
-         message_publish( MSG_WARNING, errmsg.str().c_str() );
-      }
-   }
+   // Check for the inertia here, while the received flags are still set,
+   // since a batched compensation is finished after the object is marked
+   // as unchanged.
    if ( inertia_attr->is_received() ) {
       // Compute the inverse of the inertia matrix.  If this fails, the
       // inverse matrix will be set to all zeros.  This will zero out any
       // torque affects in the lag compensation dynamics.
       if ( dm_invert_symm( this->inertia_inv, this->inertia ) != TM_SUCCESS ) {
          message_publish( MSG_WARNING,
-                          "SpaceFOM::DynamicalEntityLagCompInteg::receive_lag_compensation():%d ERROR: Singular inertia matrix! Inversion failed!\n",
+                          "SpaceFOM::DynamicalEntityLagCompBase::begin_receive_lag_compensation():%d ERROR: Singular inertia matrix! Inversion failed!\n",
                           __LINE__ );
          M_INIT( this->inertia_inv );
       }
    }
 
-   // Copy the compensated state to the packing data.
-   unload_lag_comp_data();
-
-   // Move the unpacked data into the working data.
-   entity.unpack_into_working_data();
-
-   // Return to calling routine.
-   return;
+   return state_received;
 }
 
 /*!
@@ -27,6 +27,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../TrickHLA/time/Int64BaseTime.cpp}
 @trick_link_dependency{../TrickHLA/time/Int64Time.cpp}
 @trick_link_dependency{../TrickHLA/utils/SleepTimeout.cpp}
+@trick_link_dependency{../TrickHLA/utils/StartupProfiler.cpp}
 @trick_link_dependency{ExecutionConfiguration.cpp}
 @trick_link_dependency{ExecutionControl.cpp}
 @trick_link_dependency{RefFrameBase.cpp}
@@ -84,6 +85,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/time/ScenarioTimeline.hh"
 #include "TrickHLA/time/SimTimeline.hh"
 #include "TrickHLA/utils/SleepTimeout.hh"
+#include "TrickHLA/utils/StartupProfiler.hh"
 #include "TrickHLA/utils/StringUtilities.hh"
 #include "TrickHLA/utils/Utilities.hh"
 
@@ -645,6 +647,8 @@ described in section 7.2 and figure 7-4.
 */
 void ExecutionControl::role_determination_process()
 {
+   StartupProfilerScope profile_scope( "SpaceFOM::ExecutionControl::role_determination_process", "phase" );
+
    // Initialize the MOM interface handles.
    federate->initialize_MOM_handles();
 
@@ -804,6 +808,8 @@ initialization process described in section 7.2 and figure 7-5.
 */
 void ExecutionControl::early_joiner_hla_init_process()
 {
+   StartupProfilerScope profile_scope( "SpaceFOM::ExecutionControl::early_joiner_hla_init_process", "phase" );
+
    // Wait for the SpaceFOM initialization ExecutionConrtol synchronization
    // points for Early Joiner: INIT_STARTED_SYNC_POINT,
    // OBJECTS_DISCOVERED_SYNC_POINT, and ROOT_FRAME_DISCOVERED_SYNC_POINT.
@@ -879,6 +885,8 @@ waits for the initialization_complete sync-point to be announced.
 */
 void ExecutionControl::designated_late_joiner_init_process()
 {
+   StartupProfilerScope profile_scope( "SpaceFOM::ExecutionControl::designated_late_joiner_init_process", "phase" );
+
    // Master Federate can not be a designated late joiner or if are not
    // configured by the user to be a designated late joiner just return.
    if ( is_master() || !is_designated_late_joiner() ) {
@@ -973,6 +981,8 @@ described in section 7.2 and figure 7-9.
 */
 void ExecutionControl::late_joiner_hla_init_process()
 {
+   StartupProfilerScope profile_scope( "SpaceFOM::ExecutionControl::late_joiner_hla_init_process", "phase" );
+
    ExecutionConfiguration *ExCO = get_execution_configuration();
 
    // Setup all the RTI handles for the objects, attributes and interaction
@@ -1062,6 +1072,8 @@ process described in section 7.2 figure 7-2.
 */
 void ExecutionControl::pre_multi_phase_init_processes()
 {
+   StartupProfilerScope profile_scope( "SpaceFOM::ExecutionControl::pre_multi_phase_init_processes", "phase" );
+
    ExecutionConfiguration *ExCO = get_execution_configuration();
 
    // The User Must specify an ExCO.
@@ -1217,6 +1229,8 @@ process described in section 7.2 and figures 7-8 and 7-9.
 */
 void ExecutionControl::post_multi_phase_init_processes()
 {
+   StartupProfilerScope profile_scope( "SpaceFOM::ExecutionControl::post_multi_phase_init_processes", "phase" );
+
    ExecutionConfiguration *ExCO = get_execution_configuration();
 
    // Setup HLA time management.
@@ -2738,6 +2752,8 @@ Discovery initialization process described in section 7.2 and figure 7-6.
 */
 void ExecutionControl::epoch_and_root_frame_discovery_process()
 {
+   StartupProfilerScope profile_scope( "SpaceFOM::ExecutionControl::epoch_and_root_frame_discovery_process", "wait" );
+
    ExecutionConfiguration *ExCO = get_execution_configuration();
 
    // Proceed in to the Root Reference Frame discovery process.
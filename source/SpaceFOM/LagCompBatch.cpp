@@ -0,0 +1,471 @@
+/*!
+@file SpaceFOM/LagCompBatch.cpp
+@ingroup SpaceFOM
+@brief This class provides the implementation for the TrickHLA SpaceFOM
+batched latency/lag compensation class.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{../TrickHLA/LagCompensationBatch.cpp}
+@trick_link_dependency{DynamicalEntityLagCompClosedForm.cpp}
+@trick_link_dependency{LagCompBatch.cpp}
+@trick_link_dependency{PhysicalEntityLagCompBase.cpp}
+@trick_link_dependency{PhysicalEntityLagCompClosedForm.cpp}
+@trick_link_dependency{QuaternionData.cpp}
+@trick_link_dependency{RefFrameLagCompBase.cpp}
+@trick_link_dependency{RefFrameLagCompClosedForm.cpp}
+
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System includes.
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <sstream>
+#include <vector>
+
+// Trick includes.
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+
+// SpaceFOM includes.
+#include "SpaceFOM/DynamicalEntityLagCompClosedForm.hh"
+#include "SpaceFOM/LagCompBatch.hh"
+#include "SpaceFOM/PhysicalEntityLagCompBase.hh"
+#include "SpaceFOM/PhysicalEntityLagCompClosedForm.hh"
+#include "SpaceFOM/RefFrameLagCompBase.hh"
+#include "SpaceFOM/RefFrameLagCompClosedForm.hh"
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
+
+// TrickHLA includes.
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/LagCompensation.hh"
+#include "TrickHLA/LagCompensationBatch.hh"
+#include "TrickHLA/Types.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace SpaceFOM;
+
+/*!
+ * @job_class{initialization}
+ */
+LagCompBatch::LagCompBatch() // RETURN: -- None.
+   : TrickHLA::LagCompensationBatch(),
+     entities(),
+     entities_received(),
+     frames(),
+     frames_received(),
+     dt(),
+     t_end(),
+     att_scalar()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+LagCompBatch::~LagCompBatch() // RETURN: -- None.
+{
+   entities.clear();
+   entities_received.clear();
+   frames.clear();
+   frames_received.clear();
+   return;
+}
+
+/*!
+ * @details The batch propagates the states with the closed-form solution
+ * instead of calling the compensate() function of each instance, so only the
+ * closed-form lag compensation classes give the same result in a batch.
+ * @job_class{initialization}
+ */
+bool LagCompBatch::is_supported(
+   TrickHLA::LagCompensation const *lag_comp ) const
+{
+   return ( ( dynamic_cast< PhysicalEntityLagCompClosedForm const * >( lag_comp ) != NULL )
+            || ( dynamic_cast< DynamicalEntityLagCompClosedForm const * >( lag_comp ) != NULL )
+            || ( dynamic_cast< RefFrameLagCompClosedForm const * >( lag_comp ) != NULL ) );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void LagCompBatch::add_send_lag_compensation(
+   TrickHLA::LagCompensation *lag_comp )
+{
+   PhysicalEntityLagCompBase *entity_lag_comp = dynamic_cast< PhysicalEntityLagCompBase * >( lag_comp );
+   if ( entity_lag_comp != NULL ) {
+      entity_lag_comp->begin_send_lag_compensation();
+      entities.push_back( entity_lag_comp );
+      entities_received.push_back( true );
+      return;
+   }
+
+   RefFrameLagCompBase *frame_lag_comp = dynamic_cast< RefFrameLagCompBase * >( lag_comp );
+   if ( frame_lag_comp != NULL ) {
+      frame_lag_comp->begin_send_lag_compensation();
+      frames.push_back( frame_lag_comp );
+      frames_received.push_back( true );
+      return;
+   }
+
+   ostringstream errmsg;
+   errmsg << "SpaceFOM::LagCompBatch::add_send_lag_compensation():" << __LINE__
+          << " ERROR: The lag compensation instance is not a SpaceFOM"
+          << " PhysicalEntity, DynamicalEntity or RefFrame closed-form lag"
+          << " compensation!"
+          << " Please check your input or modified-data files to make sure"
+          << " only SpaceFOM lag compensation instances use this batch." << endl;
+   DebugHandler::terminate_with_message( errmsg.str() );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void LagCompBatch::send_lag_compensation()
+{
+   if ( entities.empty() && frames.empty() ) {
+      return;
+   }
+
+   // Compensate all the states in the batch in one pass.
+   compensate( true );
+
+   // Copy the compensated states to the packing data.
+   for ( size_t i = 0; i < entities.size(); ++i ) {
+      entities[i]->end_send_lag_compensation();
+   }
+   for ( size_t i = 0; i < frames.size(); ++i ) {
+      frames[i]->end_send_lag_compensation();
+   }
+
+   // Empty the batch for the next send.
+   entities.clear();
+   entities_received.clear();
+   frames.clear();
+   frames_received.clear();
+
+   return;
+}
+
+/*!
+ * @details An object only adds the last of its queued updates in a frame to
+ * the batch and compensates the earlier ones by itself, so an instance is in
+ * the batch at most once.
+ * @job_class{scheduled}
+ */
+void LagCompBatch::add_receive_lag_compensation(
+   TrickHLA::LagCompensation *lag_comp )
+{
+   PhysicalEntityLagCompBase *entity_lag_comp = dynamic_cast< PhysicalEntityLagCompBase * >( lag_comp );
+   if ( entity_lag_comp != NULL ) {
+      entities_received.push_back( entity_lag_comp->begin_receive_lag_compensation() );
+      entities.push_back( entity_lag_comp );
+      return;
+   }
+
+   RefFrameLagCompBase *frame_lag_comp = dynamic_cast< RefFrameLagCompBase * >( lag_comp );
+   if ( frame_lag_comp != NULL ) {
+      frames_received.push_back( frame_lag_comp->begin_receive_lag_compensation() );
+      frames.push_back( frame_lag_comp );
+      return;
+   }
+
+   ostringstream errmsg;
+   errmsg << "SpaceFOM::LagCompBatch::add_receive_lag_compensation():" << __LINE__
+          << " ERROR: The lag compensation instance is not a SpaceFOM"
+          << " PhysicalEntity, DynamicalEntity or RefFrame closed-form lag"
+          << " compensation!"
+          << " Please check your input or modified-data files to make sure"
+          << " only SpaceFOM lag compensation instances use this batch." << endl;
+   DebugHandler::terminate_with_message( errmsg.str() );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void LagCompBatch::receive_lag_compensation()
+{
+   if ( entities.empty() && frames.empty() ) {
+      return;
+   }
+
+   // Compensate all the received states in the batch in one pass.
+   compensate( false );
+
+   // Copy the compensated states to the working data.
+   for ( size_t i = 0; i < entities.size(); ++i ) {
+      entities[i]->end_receive_lag_compensation();
+   }
+   for ( size_t i = 0; i < frames.size(); ++i ) {
+      frames[i]->end_receive_lag_compensation();
+   }
+
+   // Empty the batch for the next receive.
+   entities.clear();
+   entities_received.clear();
+   frames.clear();
+   frames_received.clear();
+
+   return;
+}
+
+/*!
+ * @details The states are propagated with the closed-form solution used by
+ * the PhysicalEntityLagCompClosedForm, DynamicalEntityLagCompClosedForm and
+ * RefFrameLagCompClosedForm classes, which are the only instances
+ * is_supported() accepts. Reference frames are propagated with constant
+ * velocities.
+ * @job_class{scheduled}
+ */
+void LagCompBatch::compensate(
+   bool const sending )
+{
+   // Count the states to compensate. On the receive side we only compensate
+   // the states that were received.
+   unsigned int count = 0;
+   for ( size_t i = 0; i < entities.size(); ++i ) {
+      if ( sending || entities_received[i] ) {
+         ++count;
+      }
+   }
+   for ( size_t i = 0; i < frames.size(); ++i ) {
+      if ( sending || frames_received[i] ) {
+         ++count;
+      }
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
+      ostringstream msg;
+      msg << "SpaceFOM::LagCompBatch::compensate():" << __LINE__
+          << ( sending ? " Send" : " Receive" ) << " side"
+          << " entities:" << entities.size()
+          << " frames:" << frames.size()
+          << " compensated states:" << count << endl;
+      message_publish( MSG_NORMAL, msg.str().c_str() );
+   }
+
+   if ( count == 0 ) {
+      return;
+   }
+
+   resize( count );
+
+   // Gather the states into the structure-of-arrays storage.
+   unsigned int k = 0;
+   for ( size_t i = 0; i < entities.size(); ++i ) {
+      if ( sending || entities_received[i] ) {
+         PhysicalEntityLagCompBase const *lag_comp = entities[i];
+         SpaceTimeCoordinateData const   &state    = lag_comp->lag_comp_data;
+
+         dt[k]    = ( lag_comp->compensate_dt > 0.0 ) ? lag_comp->compensate_dt : 0.0;
+         t_end[k] = sending ? ( lag_comp->get_scenario_time() + lag_comp->compensate_dt )
+                            : lag_comp->get_scenario_time();
+         for ( int iinc = 0; iinc < 3; ++iinc ) {
+            pos[iinc][k]        = state.pos[iinc];
+            vel[iinc][k]        = state.vel[iinc];
+            accel[iinc][k]      = lag_comp->accel[iinc];
+            att_vector[iinc][k] = state.att.vector[iinc];
+            ang_vel[iinc][k]    = state.ang_vel[iinc];
+            ang_accel[iinc][k]  = lag_comp->ang_accel[iinc];
+         }
+         att_scalar[k] = state.att.scalar;
+         ++k;
+      }
+   }
+   for ( size_t i = 0; i < frames.size(); ++i ) {
+      if ( sending || frames_received[i] ) {
+         RefFrameLagCompBase const     *lag_comp = frames[i];
+         SpaceTimeCoordinateData const &state    = lag_comp->lag_comp_data;
+
+         dt[k]    = ( lag_comp->compensate_dt > 0.0 ) ? lag_comp->compensate_dt : 0.0;
+         t_end[k] = sending ? ( lag_comp->get_scenario_time() + lag_comp->compensate_dt )
+                            : lag_comp->get_scenario_time();
+         for ( int iinc = 0; iinc < 3; ++iinc ) {
+            pos[iinc][k]        = state.pos[iinc];
+            vel[iinc][k]        = state.vel[iinc];
+            accel[iinc][k]      = 0.0;
+            att_vector[iinc][k] = state.att.vector[iinc];
+            ang_vel[iinc][k]    = state.ang_vel[iinc];
+            ang_accel[iinc][k]  = 0.0;
+         }
+         att_scalar[k] = state.att.scalar;
+         ++k;
+      }
+   }
+
+   // Propagate all the states together.
+   propagate( count );
+
+   // Scatter the compensated states back. A state with a zero or negative
+   // compensation time step keeps its original time tag.
+   k = 0;
+   for ( size_t i = 0; i < entities.size(); ++i ) {
+      if ( sending || entities_received[i] ) {
+         PhysicalEntityLagCompBase *lag_comp = entities[i];
+         SpaceTimeCoordinateData   &state    = lag_comp->lag_comp_data;
+
+         for ( int iinc = 0; iinc < 3; ++iinc ) {
+            state.pos[iinc]        = pos[iinc][k];
+            state.vel[iinc]        = vel[iinc][k];
+            state.att.vector[iinc] = att_vector[iinc][k];
+            state.ang_vel[iinc]    = ang_vel[iinc][k];
+         }
+         state.att.scalar = att_scalar[k];
+         if ( dt[k] > 0.0 ) {
+            state.time = t_end[k];
+         }
+         lag_comp->Q_dot.derivative_first( state.att, state.ang_vel );
+         ++k;
+      }
+   }
+   for ( size_t i = 0; i < frames.size(); ++i ) {
+      if ( sending || frames_received[i] ) {
+         RefFrameLagCompBase     *lag_comp = frames[i];
+         SpaceTimeCoordinateData &state    = lag_comp->lag_comp_data;
+
+         for ( int iinc = 0; iinc < 3; ++iinc ) {
+            state.pos[iinc]        = pos[iinc][k];
+            state.vel[iinc]        = vel[iinc][k];
+            state.att.vector[iinc] = att_vector[iinc][k];
+            state.ang_vel[iinc]    = ang_vel[iinc][k];
+         }
+         state.att.scalar = att_scalar[k];
+         if ( dt[k] > 0.0 ) {
+            state.time = t_end[k];
+         }
+         lag_comp->Q_dot.derivative_first( state.att, state.ang_vel );
+         ++k;
+      }
+   }
+
+   return;
+}
+
+/*!
+ * @details The storage only grows, so after the first few frames there are
+ * no more allocations.
+ * @job_class{scheduled}
+ */
+void LagCompBatch::resize(
+   unsigned int const count )
+{
+   if ( dt.size() >= count ) {
+      return;
+   }
+   dt.resize( count );
+   t_end.resize( count );
+   att_scalar.resize( count );
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      pos[iinc].resize( count );
+      vel[iinc].resize( count );
+      accel[iinc].resize( count );
+      att_vector[iinc].resize( count );
+      ang_vel[iinc].resize( count );
+      ang_accel[iinc].resize( count );
+   }
+   return;
+}
+
+/*!
+ * @details Each loop runs over one component of all the states so the
+ * compiler can vectorize it. The attitude uses the same second order Magnus
+ * rotation vector as QuaternionData::compute_propagation().
+ * @job_class{scheduled}
+ */
+void LagCompBatch::propagate(
+   unsigned int const count )
+{
+   double const *const step = &dt[0];
+
+   // Translational state with constant acceleration.
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      double       *p = &pos[iinc][0];
+      double       *v = &vel[iinc][0];
+      double const *a = &accel[iinc][0];
+      for ( unsigned int k = 0; k < count; ++k ) {
+         p[k] += ( v[k] + ( 0.5 * a[k] * step[k] ) ) * step[k];
+         v[k] += a[k] * step[k];
+      }
+   }
+
+   // Attitude with a linearly varying angular velocity.
+   double       *qs  = &att_scalar[0];
+   double       *qx  = &att_vector[0][0];
+   double       *qy  = &att_vector[1][0];
+   double       *qz  = &att_vector[2][0];
+   double const *wx  = &ang_vel[0][0];
+   double const *wy  = &ang_vel[1][0];
+   double const *wz  = &ang_vel[2][0];
+   double const *wdx = &ang_accel[0][0];
+   double const *wdy = &ang_accel[1][0];
+   double const *wdz = &ang_accel[2][0];
+   for ( unsigned int k = 0; k < count; ++k ) {
+      double const h    = step[k];
+      double const h_sq = h * h;
+      double const c3   = h_sq * h / 12.0;
+
+      // Rotation vector:
+      // theta = omega*dt + 1/2*omega_dot*dt^2 + 1/12*(omega X omega_dot)*dt^3
+      double const tx = ( wx[k] * h ) + ( 0.5 * wdx[k] * h_sq ) + ( c3 * ( ( wy[k] * wdz[k] ) - ( wz[k] * wdy[k] ) ) );
+      double const ty = ( wy[k] * h ) + ( 0.5 * wdy[k] * h_sq ) + ( c3 * ( ( wz[k] * wdx[k] ) - ( wx[k] * wdz[k] ) ) );
+      double const tz = ( wz[k] * h ) + ( 0.5 * wdz[k] * h_sq ) + ( c3 * ( ( wx[k] * wdy[k] ) - ( wy[k] * wdx[k] ) ) );
+
+      double const half_angle = 0.5 * sqrt( ( tx * tx ) + ( ty * ty ) + ( tz * tz ) );
+
+      // sin(half_angle)/(2*half_angle), with the Taylor series for small angles.
+      double const sin_ratio = ( half_angle < 1.0e-4 )
+                                  ? 0.5 * ( 1.0 - ( ( half_angle * half_angle ) / 6.0 ) )
+                                  : 0.5 * sin( half_angle ) / half_angle;
+
+      // Incremental rotation quaternion exp(-1/2 [0:theta]).
+      double const ds = cos( half_angle );
+      double const dx = -sin_ratio * tx;
+      double const dy = -sin_ratio * ty;
+      double const dz = -sin_ratio * tz;
+
+      // q = dq * q
+      double const s = ( ds * qs[k] ) - ( ( dx * qx[k] ) + ( dy * qy[k] ) + ( dz * qz[k] ) );
+      double const x = ( ( dy * qz[k] ) - ( dz * qy[k] ) ) + ( ds * qx[k] ) + ( dx * qs[k] );
+      double const y = ( ( dz * qx[k] ) - ( dx * qz[k] ) ) + ( ds * qy[k] ) + ( dy * qs[k] );
+      double const z = ( ( dx * qy[k] ) - ( dy * qx[k] ) ) + ( ds * qz[k] ) + ( dz * qs[k] );
+
+      // Remove any accumulated round off.
+      double const norm_fact = 1.0 / sqrt( ( s * s ) + ( x * x ) + ( y * y ) + ( z * z ) );
+
+      qs[k] = s * norm_fact;
+      qx[k] = x * norm_fact;
+      qy[k] = y * norm_fact;
+      qz[k] = z * norm_fact;
+   }
+
+   // Angular velocity with constant angular acceleration.
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      double       *w  = &ang_vel[iinc][0];
+      double const *wd = &ang_accel[iinc][0];
+      for ( unsigned int k = 0; k < count; ++k ) {
+         w[k] += wd[k] * step[k];
+      }
+   }
+
+   return;
+}
@@ -71,6 +71,8 @@ PhysicalEntityLagCompBase::PhysicalEntityLagCompBase( PhysicalEntityBase &entity
      ang_accel_attr( NULL ),
      cm_attr( NULL ),
      body_frame_attr( NULL ),
+     history(),
+     history_delay( 0.0 ),
      compensate_dt( 0.0 )
 {
    // Initialize the acceleration values.
@@ -156,21 +158,59 @@ void PhysicalEntityLagCompBase::initialize_states()
  *  TrickHLALagCompensation class. */
 void PhysicalEntityLagCompBase::send_lag_compensation()
 {
-   double begin_t = get_scenario_time();
-   double end_t;
+   double const begin_t = get_scenario_time();
+
+   // Load the current PhysicalEntity state to compensate.
+   begin_send_lag_compensation();
+
+   // Compensate the data
+   compensate( begin_t, begin_t + this->compensate_dt );
+
+   // Copy the compensated state to the packing data.
+   end_send_lag_compensation();
+
+   // Return to calling routine.
+   return;
+}
+
+/*! @brief Receive side latency compensation callback interface from the
+ *  TrickHLALagCompensation class. */
+void PhysicalEntityLagCompBase::receive_lag_compensation()
+{
+   double const end_t = get_scenario_time();
+
+   // Load the received PhysicalEntity state to compensate.
+   if ( begin_receive_lag_compensation() && !is_history_playback() ) {
+
+      // Compensate the data
+      compensate( entity.get_time(), end_t );
+   }
+
+   // Copy the compensated state to the working data.
+   end_receive_lag_compensation();
+
+   // Return to calling routine.
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void PhysicalEntityLagCompBase::begin_send_lag_compensation()
+{
+   double const begin_t = get_scenario_time();
 
    // Save the compensation time step.
    this->compensate_dt = get_lookahead().get_time_in_seconds();
-   end_t               = begin_t + this->compensate_dt;
 
    // Use the inherited debug-handler to allow debug comments to be turned
    // on and off from a setting in the input file.
    if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
       ostringstream errmsg;
-      errmsg << "******* PhysicalEntityLagCompInteg::send_lag_compensation():" << __LINE__ << endl
-             << " scenario-time:" << get_scenario_time() << endl
+      errmsg << "******* PhysicalEntityLagCompBase::begin_send_lag_compensation():" << __LINE__ << endl
+             << " scenario-time:" << begin_t << endl
              << "     lookahead:" << this->compensate_dt << endl
-             << " adjusted-time:" << end_t << endl;
+             << " adjusted-time:" << ( begin_t + this->compensate_dt ) << endl;
       message_publish( MSG_WARNING, errmsg.str().c_str() );
    }
 
@@ -187,9 +227,15 @@ void PhysicalEntityLagCompBase::send_lag_compensation()
       message_publish( MSG_NORMAL, msg.str().c_str() );
    }
 
-   // Compensate the data
-   compensate( begin_t, end_t );
+   // Return to calling routine.
+   return;
+}
 
+/*!
+ * @job_class{scheduled}
+ */
+void PhysicalEntityLagCompBase::end_send_lag_compensation()
+{
    // Print out debug information if desired.
    if ( debug ) {
       ostringstream msg;
@@ -205,12 +251,13 @@ void PhysicalEntityLagCompBase::send_lag_compensation()
    return;
 }
 
-/*! @brief Receive side latency compensation callback interface from the
- *  TrickHLALagCompensation class. */
-void PhysicalEntityLagCompBase::receive_lag_compensation()
+/*!
+ * @job_class{scheduled}
+ */
+bool PhysicalEntityLagCompBase::begin_receive_lag_compensation()
 {
-   double end_t  = get_scenario_time();
-   double data_t = entity.get_time();
+   double const end_t  = get_scenario_time();
+   double const data_t = entity.get_time();
 
    // Save the compensation time step.
    this->compensate_dt = end_t - data_t;
@@ -219,7 +266,7 @@ void PhysicalEntityLagCompBase::receive_lag_compensation()
    // on and off from a setting in the input file.
    if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
       ostringstream errmsg;
-      errmsg << "******* PhysicalEntityLagCompInteg::receive_lag_compensation():" << __LINE__ << endl
+      errmsg << "******* PhysicalEntityLagCompBase::begin_receive_lag_compensation():" << __LINE__ << endl
              << "  scenario-time:" << end_t << endl
              << "      data-time:" << data_t << endl
              << " comp-time-step:" << this->compensate_dt << endl;
@@ -228,30 +275,48 @@ void PhysicalEntityLagCompBase::receive_lag_compensation()
 
    // Because of ownership transfers and attributes being sent at different
    // rates we need to check to see if we received attribute data.
-   if ( state_attr->is_received() ) {
+   if ( !state_attr->is_received() ) {
+      return false;
+   }
 
-      // Copy the current PhysicalEntity state over to the lag compensated state.
-      load_lag_comp_data();
-      Q_dot.derivative_first( lag_comp_data.att, lag_comp_data.ang_vel );
+   // Copy the current PhysicalEntity state over to the lag compensated state.
+   load_lag_comp_data();
+   Q_dot.derivative_first( lag_comp_data.att, lag_comp_data.ang_vel );
 
-      // Print out debug information if desired.
-      if ( debug ) {
-         ostringstream msg;
-         msg << "Receive data before compensation:" << endl;
-         print_lag_comp_data( msg );
-         message_publish( MSG_NORMAL, msg.str().c_str() );
-      }
+   // Save the received state in the history.
+   if ( history.is_enabled() ) {
+      history.add_sample( lag_comp_data, accel, ang_accel );
+   }
 
-      // Compensate the data
-      compensate( data_t, end_t );
-
-      // Print out debug information if desired.
-      if ( debug ) {
-         ostringstream msg;
-         msg << "Receive data after compensation:" << endl;
-         print_lag_comp_data( msg );
-         message_publish( MSG_NORMAL, msg.str().c_str() );
-      }
+   // Print out debug information if desired.
+   if ( debug ) {
+      ostringstream msg;
+      msg << "Receive data before compensation:" << endl;
+      print_lag_comp_data( msg );
+      message_publish( MSG_NORMAL, msg.str().c_str() );
+   }
+
+   return true;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void PhysicalEntityLagCompBase::end_receive_lag_compensation()
+{
+   // Play back the state from the history at the delayed time, which replaces
+   // the extrapolation from the latest received state.
+   if ( is_history_playback()
+        && history.get_state( get_scenario_time() - history_delay, lag_comp_data ) ) {
+      Q_dot.derivative_first( lag_comp_data.att, lag_comp_data.ang_vel );
+   }
+
+   // Print out debug information if desired.
+   if ( debug ) {
+      ostringstream msg;
+      msg << "Receive data after compensation:" << endl;
+      print_lag_comp_data( msg );
+      message_publish( MSG_NORMAL, msg.str().c_str() );
    }
 
    // Copy the compensated state to the packing data.
@@ -288,6 +353,45 @@ void PhysicalEntityLagCompBase::bypass_receive_lag_compensation()
    return;
 }
 
+/*!
+ * @job_class{scheduled}
+ */
+void PhysicalEntityLagCompBase::idle_receive_lag_compensation()
+{
+   // Without a history playback the working state keeps the latest received
+   // state until the next one arrives.
+   if ( !is_history_playback() || state_attr->is_locally_owned() ) {
+      return;
+   }
+
+   // Play back the state from the history at the delayed time.
+   if ( !history.get_state( get_scenario_time() - history_delay, lag_comp_data ) ) {
+      return;
+   }
+   Q_dot.derivative_first( lag_comp_data.att, lag_comp_data.ang_vel );
+
+   // Print out debug information if desired.
+   if ( debug ) {
+      ostringstream msg;
+      msg << "Receive data played back from the history:" << endl;
+      print_lag_comp_data( msg );
+      message_publish( MSG_NORMAL, msg.str().c_str() );
+   }
+
+   // Copy the played back state to the packing data.
+   unload_lag_comp_data();
+
+   // The entity only unpacks a received state into the working data, so
+   // mark the state attribute as received for this unpack. The attributes
+   // are only decoded on the main thread, so this does not hide new data.
+   state_attr->mark_changed();
+   entity.unpack_into_working_data();
+   state_attr->mark_unchanged();
+
+   // Return to calling routine.
+   return;
+}
+
 /*!
  * @job_class{scheduled}
  */
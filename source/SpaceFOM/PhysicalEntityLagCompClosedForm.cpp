@@ -0,0 +1,109 @@
+/*!
+@file SpaceFOM/PhysicalEntityLagCompClosedForm.cpp
+@ingroup SpaceFOM
+@brief This class provides the implementation for a TrickHLA SpaceFOM
+physical entity latency/lag compensation class that uses a closed-form
+solution to compensate the state.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{PhysicalEntityLagCompBase.cpp}
+@trick_link_dependency{PhysicalEntityLagCompClosedForm.cpp}
+@trick_link_dependency{SpaceTimeCoordinateData.cpp}
+
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System includes.
+#include <ostream>
+#include <sstream>
+
+// Trick includes.
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+
+// SpaceFOM includes.
+#include "SpaceFOM/PhysicalEntityBase.hh"
+#include "SpaceFOM/PhysicalEntityLagCompBase.hh"
+#include "SpaceFOM/PhysicalEntityLagCompClosedForm.hh"
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
+
+// TrickHLA includes.
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Types.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace SpaceFOM;
+
+/*!
+ * @job_class{initialization}
+ */
+PhysicalEntityLagCompClosedForm::PhysicalEntityLagCompClosedForm( PhysicalEntityBase &entity_ref ) // RETURN: -- None.
+   : PhysicalEntityLagCompBase( entity_ref )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+PhysicalEntityLagCompClosedForm::~PhysicalEntityLagCompClosedForm() // RETURN: -- None.
+{
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+int PhysicalEntityLagCompClosedForm::compensate(
+   double const t_begin,
+   double const t_end )
+{
+   this->compensate_dt = t_end - t_begin;
+
+   // Use the inherited debug-handler to allow debug comments to be turned
+   // on and off from a setting in the input file.
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
+      ostringstream msg;
+      msg << "PhysicalEntityLagCompClosedForm::compensate(): " << __LINE__
+          << " Compensate: t_begin, t_end, dt: "
+          << t_begin << ", " << t_end << ", " << this->compensate_dt << endl;
+      message_publish( MSG_NORMAL, msg.str().c_str() );
+   }
+
+   // Like the integrator based compensation, we only propagate forward.
+   if ( this->compensate_dt > 0.0 ) {
+
+      // Propagate the state in one step using the constant acceleration and
+      // constant angular acceleration assumption.
+      this->lag_comp_data.propagate( this->compensate_dt, this->accel, this->ang_accel );
+
+      // Update the lag compensated time.
+      this->lag_comp_data.time = t_end;
+   } else {
+      this->lag_comp_data.time = t_begin;
+   }
+
+   // Compute the derivative of the attitude quaternion from the
+   // angular velocity vector.
+   Q_dot.derivative_first( this->lag_comp_data.att, this->lag_comp_data.ang_vel );
+
+   return ( 0 );
+}
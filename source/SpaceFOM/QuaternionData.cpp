@@ -461,6 +461,70 @@ void QuaternionData::derivative_second(
    return;
 }
 
+/*!
+ * @job_class{scheduled}
+ */
+void QuaternionData::propagate(
+   QuaternionData const &quat,
+   double const          omega[3],
+   double const          omega_dot[3],
+   double const          dt )
+{
+   compute_propagation( quat.scalar, quat.vector, omega, omega_dot, dt,
+                        &( this->scalar ), this->vector );
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void QuaternionData::slerp(
+   QuaternionData const &q_begin,
+   QuaternionData const &q_end,
+   double const          fraction )
+{
+   double end_scalar = q_end.scalar;
+   double end_vector[3];
+   V_COPY( end_vector, q_end.vector );
+
+   // The quaternions q and -q represent the same attitude; so, flip the
+   // end quaternion if needed to interpolate along the shortest path.
+   double cos_theta = ( q_begin.scalar * end_scalar ) + V_DOT( q_begin.vector, end_vector );
+   if ( cos_theta < 0.0 ) {
+      cos_theta  = -cos_theta;
+      end_scalar = -end_scalar;
+      V_SCALE( end_vector, end_vector, -1.0 );
+   }
+
+   double scale_begin;
+   double scale_end;
+   if ( cos_theta > ( 1.0 - 1.0e-9 ) ) {
+      // The quaternions are nearly parallel; so, a linear interpolation is
+      // accurate and avoids dividing by a vanishing sine.
+      scale_begin = 1.0 - fraction;
+      scale_end   = fraction;
+   } else {
+      double const theta     = acos( cos_theta );
+      double const sin_theta = sin( theta );
+      scale_begin            = sin( ( 1.0 - fraction ) * theta ) / sin_theta;
+      scale_end              = sin( fraction * theta ) / sin_theta;
+   }
+
+   // Save the begin values before setting this quaternion, in case this
+   // quaternion is also q_begin.
+   double const begin_scalar = q_begin.scalar;
+   double       begin_vector[3];
+   V_COPY( begin_vector, q_begin.vector );
+
+   this->scalar = ( scale_begin * begin_scalar ) + ( scale_end * end_scalar );
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      this->vector[iinc] = ( scale_begin * begin_vector[iinc] ) + ( scale_end * end_vector[iinc] );
+   }
+   normalize();
+
+   return;
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -829,6 +893,66 @@ void QuaternionData::compute_2nd_derivative(
    return;
 }
 
+/*!
+ * @job_class{scheduled}
+ */
+void QuaternionData::compute_propagation(
+   double const quat_scalar,
+   double const quat_vector[3],
+   double const omega[3],
+   double const omega_dot[3],
+   double const dt,
+   double      *prop_scalar,
+   double       prop_vector[3] )
+{
+   double omega_X_omega_dot[3];
+   double theta[3];
+   double half_angle;
+   double sin_ratio;
+   double dq_scalar;
+   double dq_vector[3];
+   double const dt_sq = dt * dt;
+
+   // Compute the rotation vector over the interval from a second order
+   // Magnus expansion of the quaternion kinematics with a linearly varying
+   // angular velocity:
+   // theta = omega*dt + 1/2*omega_dot*dt^2 + 1/12*(omega X omega_dot)*dt^3
+   // The cross product term corrects for omega and omega_dot not being
+   // parallel, and vanishes for a pure spin about a fixed axis.
+   V_CROSS( omega_X_omega_dot, omega, omega_dot );
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      theta[iinc] = ( omega[iinc] * dt )
+                    + ( 0.5 * omega_dot[iinc] * dt_sq )
+                    + ( ( dt_sq * dt / 12.0 ) * omega_X_omega_dot[iinc] );
+   }
+   half_angle = 0.5 * V_MAG( theta );
+
+   // Compute sin(half_angle)/(2*half_angle), using the Taylor series for
+   // small angles to avoid dividing by zero.
+   if ( half_angle < 1.0e-4 ) {
+      sin_ratio = 0.5 * ( 1.0 - ( ( half_angle * half_angle ) / 6.0 ) );
+   } else {
+      sin_ratio = 0.5 * sin( half_angle ) / half_angle;
+   }
+
+   // Exponential map of the rotation vector. The attitude quaternion rate is
+   // q_dot = -1/2 [0:omega] * q (see compute_derivative), so the incremental
+   // rotation quaternion is exp(-1/2 [0:theta]) and multiplies on the left.
+   dq_scalar    = cos( half_angle );
+   dq_vector[0] = -sin_ratio * theta[0];
+   dq_vector[1] = -sin_ratio * theta[1];
+   dq_vector[2] = -sin_ratio * theta[2];
+
+   multiply_sv( dq_scalar, dq_vector,
+                quat_scalar, quat_vector,
+                prop_scalar, prop_vector );
+
+   // Remove any accumulated round off.
+   normalize( prop_scalar, prop_vector );
+
+   return;
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -16,18 +16,14 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{QuaternionEncoder.cpp}
+@trick_link_dependency{../TrickHLA/OpaqueBuffer.cpp}
 
 @revs_begin
 @rev_entry{Edwin Z. Crues, NASA ER7, --, July 2018, NExSyS, Initial version}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Single-pass fixed layout encoding.}
 @revs_end
 */
 
-// System includes.
-#include <cstring>
-#include <ostream>
-#include <sstream>
-#include <string>
-
 // Trick includes.
 #include "trick/message_proto.h"
 #include "trick/message_type.h"
@@ -37,27 +33,8 @@ NASA, Johnson Space Center\n
 #include "SpaceFOM/QuaternionEncoder.hh"
 
 // TrickHLA includes.
-#include "TrickHLA/DebugHandler.hh"
-#include "TrickHLA/HLAStandardSupport.hh"
-#include "TrickHLA/utils/StringUtilities.hh"
-
-// C++11 deprecated dynamic exception specifications for a function so we need
-// to silence the warnings coming from the IEEE 1516 declared functions.
-// This should work for both GCC and Clang.
-#if defined( IEEE_1516_2010 )
-#   pragma GCC diagnostic push
-#   pragma GCC diagnostic ignored "-Wdeprecated"
-#endif
-
-// HLA include files.
-#include "RTI/VariableLengthData.h"
-#include "RTI/encoding/EncodingExceptions.h"
-
-#if defined( IEEE_1516_2010 )
-#   pragma GCC diagnostic pop
-#endif
-
-using namespace RTI1516_NAMESPACE;
+#include "TrickHLA/OpaqueBuffer.hh"
+
 using namespace std;
 using namespace TrickHLA;
 using namespace SpaceFOM;
@@ -67,37 +44,22 @@ using namespace SpaceFOM;
  */
 QuaternionEncoder::QuaternionEncoder(
    QuaternionData &quat_data )
-   : data( quat_data ),
-     scalar_encoder( &data.scalar ),
-     vector_encoder( HLAfloat64LE(), 3 ),
-     encoder()
+   : data( quat_data )
 {
-   // Build up the QuaternionData encoder.
+   // Encoding layout:
    // DataType: AttitudeQuaternion
    // Encoding: HLAfixedRecord
    // FOM-Module: SISO_SpaceFOM_datatypes.xml
    //    field-name: scalar, dataType: Scalar, representation: HLAfloat64LE
    //    field-name: vector, dataType: Vector, dataType:(Scalar,representation:HLAfloat64LE), encoding:HLAfixedArray, cardinality: 3
-
-   // Build up the attitude quaternion encoder:
-   // Quaternion scalar: The attitude quaternion scalar encoder was configured
-   // in the constructor initialization list above.
-   // Quaternion vector:
-   for ( int i = 0; i < 3; ++i ) {
-      vector[i].setDataPointer( &data.vector[i] );
-      vector_encoder.setElementPointer( i, &vector[i] );
-   }
-   // Add the scalar and vector encoders to the quaternion encoder.
-   encoder.appendElementPointer( &scalar_encoder );
-   encoder.appendElementPointer( &vector_encoder );
+   //
+   // Every field is an HLAfloat64LE with an 8 byte octet boundary; so, the
+   // fixed record has no padding and is 4 consecutive little-endian doubles.
 
    // Setup the TrickHLA buffer based on the size of the encoded fixed record.
    // We can do this here because the record is a fixed size all the time.
    set_byte_alignment( 1 );
-   ensure_buffer_capacity( encoder.getEncodedLength() );
-
-   // Initialize the variable length data to point to the buffer.
-   encoded_data.setDataPointer( buffer, capacity );
+   ensure_buffer_capacity( 4 * sizeof( double ) );
 
    return;
 }
@@ -107,40 +69,10 @@ QuaternionEncoder::QuaternionEncoder(
  */
 void QuaternionEncoder::encode() // Return: -- Nothing.
 {
-
-   // Encode the quaternion data into the VariableLengthData encoded data.
-   try {
-      encoder.encode( encoded_data );
-   } catch ( RTI1516_NAMESPACE::EncoderException &e ) {
-      ostringstream errmsg;
-      std::string   what_s;
-      StringUtilities::to_string( what_s, e.what() );
-      errmsg << "SpaceFOM::QuaternionEncoder::encode():" << __LINE__
-             << " Error: Encoder exception!" << endl;
-      errmsg << what_s;
-      // Print message and terminate.
-      TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
-   }
-
-   // Copy the encoded data into the outgoing buffer.
-   if ( get_capacity() >= encoded_data.size() ) {
-
-      // Note that the encode operation above encodes into the encoded_data
-      // VariableLengthData instance but into a different data area that the
-      // one set in the constructor above.  So, we have to copy the encoded
-      // data into the transmission buffer.
-      memcpy( buffer, encoded_data.data(), encoded_data.size() ); // flawfinder: ignore
-
-   } else {
-
-      // Print message and terminate.
-      ostringstream errmsg;
-      errmsg << "SpaceFOM::QuaternionEncoder::encode():" << __LINE__
-             << " Warning: Encoded data size does not match buffer!"
-             << "    Encoded size: " << encoded_data.size()
-             << " but Expected size: " << get_capacity();
-      message_publish( MSG_WARNING, errmsg.str().c_str() );
-   }
+   // Encode the quaternion data straight into the transmission buffer.
+   reset_push_position();
+   push_float64_le_to_buffer( &data.scalar, 1 );
+   push_float64_le_to_buffer( data.vector, 3 );
 
    return;
 }
@@ -150,21 +82,20 @@ void QuaternionEncoder::encode() // Return: -- Nothing.
  */
 void QuaternionEncoder::decode() // Return: -- Nothing.
 {
-
-   // Decode the quaternion fixed record.  This will decode the incoming data
-   // directly into the QuaternionData instance passed into the constructor.
-   try {
-      encoder.decode( encoded_data );
-   } catch ( RTI1516_NAMESPACE::EncoderException &e ) {
-      ostringstream errmsg;
-      std::string   what_s;
-      StringUtilities::to_string( what_s, e.what() );
-      errmsg << "SpaceFOM::QuaternionEncoder::decode():" << __LINE__
-             << " Error: Encoder exception!" << endl;
-      errmsg << what_s;
-      // Print message and terminate.
-      TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
+   // Decode the quaternion fixed record straight from the received buffer
+   // into the QuaternionData instance passed into the constructor.
+   reset_pull_position();
+
+   // Ignore a short record instead of pulling past the end of the data.
+   if ( get_data_size() < ( 4 * sizeof( double ) ) ) {
+      message_publish( MSG_WARNING, "SpaceFOM::QuaternionEncoder::decode():%d WARNING: \
+Received %d bytes but the encoded AttitudeQuaternion is %d bytes, ignoring the data!\n",
+                       __LINE__, (int)get_data_size(), (int)( 4 * sizeof( double ) ) );
+      return;
    }
 
+   pull_float64_le_from_buffer( &data.scalar, 1 );
+   pull_float64_le_from_buffer( data.vector, 3 );
+
    return;
 }
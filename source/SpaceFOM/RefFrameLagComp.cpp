@@ -182,6 +182,15 @@ void RefFrameLagComp::unload()
    // angular velocity vector.
    Q_dot.derivative_first( this->lag_comp_data.att, this->lag_comp_data.ang_vel );
 
+   // Return to calling routine.
+   return;
+}
+
+/*!
+ * @job_class{integration}
+ */
+void RefFrameLagComp::normalize_state()
+{
    // Normalize the propagated attitude quaternion.
    lag_comp_data.att.normalize();
 
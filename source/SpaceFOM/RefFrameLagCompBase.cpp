@@ -32,14 +32,20 @@ NASA, Johnson Space Center\n
 // System includes.
 #include <cstddef>
 #include <ostream>
+#include <sstream>
 
 // Trick includes.
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
 #include "trick/reference_frame.h"
 #include "trick/trick_math_proto.h"
 
 // TrickHLA includes.
+#include "TrickHLA/Attribute.hh"
+#include "TrickHLA/DebugHandler.hh"
 #include "TrickHLA/LagCompensation.hh"
 #include "TrickHLA/Object.hh"
+#include "TrickHLA/Types.hh"
 
 // SpaceFOM includes.
 #include "SpaceFOM/RefFrameBase.hh"
@@ -120,6 +126,169 @@ void RefFrameLagCompBase::initialize_states()
    return;
 }
 
+/*! @brief Sending side latency compensation callback interface from the
+ *  TrickHLALagCompensation class. */
+void RefFrameLagCompBase::send_lag_compensation()
+{
+   double const begin_t = get_scenario_time();
+
+   // Load the current RefFrame state to compensate.
+   begin_send_lag_compensation();
+
+   // Compensate the data
+   compensate( begin_t, begin_t + this->compensate_dt );
+
+   // Copy the compensated state to the packing data.
+   end_send_lag_compensation();
+
+   // Return to calling routine.
+   return;
+}
+
+/*! @brief Receive side latency compensation callback interface from the
+ *  TrickHLALagCompensation class. */
+void RefFrameLagCompBase::receive_lag_compensation()
+{
+   double const end_t = get_scenario_time();
+
+   // Load the received RefFrame state to compensate.
+   if ( begin_receive_lag_compensation() ) {
+
+      // Compensate the data
+      compensate( ref_frame.get_time(), end_t );
+   }
+
+   // Copy the compensated state to the working data.
+   end_receive_lag_compensation();
+
+   // Return to calling routine.
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void RefFrameLagCompBase::begin_send_lag_compensation()
+{
+   double const begin_t = get_scenario_time();
+
+   // Save the compensation time step.
+   this->compensate_dt = get_lookahead().get_time_in_seconds();
+
+   // Use the inherited debug-handler to allow debug comments to be turned
+   // on and off from a setting in the input file.
+   if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
+      ostringstream errmsg;
+      errmsg << "****** RefFrameLagCompBase::begin_send_lag_compensation():" << __LINE__ << endl
+             << " scenario-time:" << begin_t << endl
+             << "     lookahead:" << this->compensate_dt << endl
+             << " adjusted-time:" << ( begin_t + this->compensate_dt ) << endl;
+      message_publish( MSG_WARNING, errmsg.str().c_str() );
+   }
+
+   // Copy the current RefFrame state over to the lag compensated state.
+   ref_frame.pack_from_working_data();
+   load_lag_comp_data();
+   Q_dot.derivative_first( lag_comp_data.att, lag_comp_data.ang_vel );
+
+   // Print out debug information if desired.
+   if ( debug ) {
+      ostringstream msg;
+      msg << "Send data before compensation:" << endl;
+      print_lag_comp_data( msg );
+      message_publish( MSG_NORMAL, msg.str().c_str() );
+   }
+
+   // Return to calling routine.
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void RefFrameLagCompBase::end_send_lag_compensation()
+{
+   // Print out debug information if desired.
+   if ( debug ) {
+      ostringstream msg;
+      msg << "Send data after compensation:" << endl;
+      print_lag_comp_data( msg );
+      message_publish( MSG_NORMAL, msg.str().c_str() );
+   }
+
+   // Copy the compensated state to the packing data.
+   unload_lag_comp_data();
+
+   // Return to calling routine.
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+bool RefFrameLagCompBase::begin_receive_lag_compensation()
+{
+   double const end_t  = get_scenario_time();
+   double const data_t = ref_frame.get_time();
+
+   // Save the compensation time step.
+   this->compensate_dt = end_t - data_t;
+
+   // Use the inherited debug-handler to allow debug comments to be turned
+   // on and off from a setting in the input file.
+   if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
+      ostringstream errmsg;
+      errmsg << "******* RefFrameLagCompBase::begin_receive_lag_compensation():" << __LINE__ << endl
+             << "  scenario-time:" << end_t << endl
+             << "      data-time:" << data_t << endl
+             << " comp-time-step:" << this->compensate_dt << endl;
+      message_publish( MSG_WARNING, errmsg.str().c_str() );
+   }
+
+   // Because of ownership transfers and attributes being sent at different
+   // rates we need to check to see if we received attribute data.
+   if ( !state_attr->is_received() ) {
+      return false;
+   }
+
+   // Copy the current RefFrame state over to the lag compensated state.
+   load_lag_comp_data();
+   Q_dot.derivative_first( lag_comp_data.att, lag_comp_data.ang_vel );
+
+   // Print out debug information if desired.
+   if ( debug ) {
+      ostringstream msg;
+      msg << "Receive data before compensation:" << endl;
+      print_lag_comp_data( msg );
+      message_publish( MSG_NORMAL, msg.str().c_str() );
+   }
+
+   return true;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void RefFrameLagCompBase::end_receive_lag_compensation()
+{
+   // Print out debug information if desired.
+   if ( debug ) {
+      ostringstream msg;
+      msg << "Receive data after compensation:" << endl;
+      print_lag_comp_data( msg );
+      message_publish( MSG_NORMAL, msg.str().c_str() );
+   }
+
+   // Copy the compensated state to the packing data.
+   unload_lag_comp_data();
+
+   // Move the unpacked data into the working data.
+   ref_frame.unpack_into_working_data();
+
+   // Return to calling routine.
+   return;
+}
+
 /*!
  * @job_class{scheduled}
  */
@@ -0,0 +1,110 @@
+/*!
+@file SpaceFOM/RefFrameLagCompClosedForm.cpp
+@ingroup SpaceFOM
+@brief This class provides the implementation for a TrickHLA SpaceFOM
+reference frame latency/lag compensation class that uses a closed-form
+solution to compensate the state.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../TrickHLA/DebugHandler.cpp}
+@trick_link_dependency{RefFrameLagCompBase.cpp}
+@trick_link_dependency{RefFrameLagCompClosedForm.cpp}
+@trick_link_dependency{SpaceTimeCoordinateData.cpp}
+
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System includes.
+#include <ostream>
+#include <sstream>
+
+// Trick includes.
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+
+// SpaceFOM includes.
+#include "SpaceFOM/RefFrameBase.hh"
+#include "SpaceFOM/RefFrameLagCompBase.hh"
+#include "SpaceFOM/RefFrameLagCompClosedForm.hh"
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
+
+// TrickHLA includes.
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Types.hh"
+
+using namespace std;
+using namespace TrickHLA;
+using namespace SpaceFOM;
+
+/*!
+ * @job_class{initialization}
+ */
+RefFrameLagCompClosedForm::RefFrameLagCompClosedForm( RefFrameBase &ref_frame_ref ) // RETURN: -- None.
+   : RefFrameLagCompBase( ref_frame_ref )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+RefFrameLagCompClosedForm::~RefFrameLagCompClosedForm() // RETURN: -- None.
+{
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+int RefFrameLagCompClosedForm::compensate(
+   double const t_begin,
+   double const t_end )
+{
+   this->compensate_dt = t_end - t_begin;
+
+   // Use the inherited debug-handler to allow debug comments to be turned
+   // on and off from a setting in the input file.
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
+      ostringstream msg;
+      msg << "RefFrameLagCompClosedForm::compensate(): " << __LINE__
+          << " Compensate: t_begin, t_end, dt: "
+          << t_begin << ", " << t_end << ", " << this->compensate_dt << endl;
+      message_publish( MSG_NORMAL, msg.str().c_str() );
+   }
+
+   // Like the integrator based compensation, we only propagate forward.
+   if ( this->compensate_dt > 0.0 ) {
+
+      // Reference frames are propagated assuming constant translational
+      // and rotational velocities.
+      double const zero_accel[3] = { 0.0, 0.0, 0.0 };
+      this->lag_comp_data.propagate( this->compensate_dt, zero_accel, zero_accel );
+
+      // Update the lag compensated time.
+      this->lag_comp_data.time = t_end;
+   } else {
+      this->lag_comp_data.time = t_begin;
+   }
+
+   // Compute the derivative of the attitude quaternion from the
+   // angular velocity vector.
+   Q_dot.derivative_first( this->lag_comp_data.att, this->lag_comp_data.ang_vel );
+
+   return ( 0 );
+}
@@ -92,115 +92,3 @@ void RefFrameLagCompInteg::initialize()
    // Return to calling routine.
    return;
 }
-
-/*! @brief Sending side latency compensation callback interface from the
- *  TrickHLALagCompensation class. */
-void RefFrameLagCompInteg::send_lag_compensation()
-{
-   double begin_t = get_scenario_time();
-   double end_t;
-
-   // Save the compensation time step.
-   this->compensate_dt = get_lookahead().get_time_in_seconds();
-   end_t               = begin_t + this->compensate_dt;
-
-   // Use the inherited debug-handler to allow debug comments to be turned
-   // on and off from a setting in the input file.
-   if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
-      ostringstream errmsg;
-      errmsg << "****** RefFrameLagCompInteg::send_lag_compensation():" << __LINE__ << endl
-             << " scenario-time:" << get_scenario_time() << endl
-             << "     lookahead:" << this->compensate_dt << endl
-             << " adjusted-time:" << end_t << endl;
-      message_publish( MSG_WARNING, errmsg.str().c_str() );
-   }
-
-   // Copy the current RefFrame state over to the lag compensated state.
-   ref_frame.pack_from_working_data();
-   load_lag_comp_data();
-   Q_dot.derivative_first( lag_comp_data.att, lag_comp_data.ang_vel );
-
-   // Print out debug information if desired.
-   if ( debug ) {
-      ostringstream msg;
-      msg << "Send data before compensation:" << endl;
-      print_lag_comp_data( msg );
-      message_publish( MSG_NORMAL, msg.str().c_str() );
-   }
-
-   // Compensate the data
-   compensate( begin_t, end_t );
-
-   // Print out debug information if desired.
-   if ( debug ) {
-      ostringstream msg;
-      msg << "Send data after compensation:" << endl;
-      print_lag_comp_data( msg );
-      message_publish( MSG_NORMAL, msg.str().c_str() );
-   }
-
-   // Copy the compensated state to the packing data.
-   unload_lag_comp_data();
-
-   // Return to calling routine.
-   return;
-}
-
-/*! @brief Receive side latency compensation callback interface from the
- *  TrickHLALagCompensation class. */
-void RefFrameLagCompInteg::receive_lag_compensation()
-{
-   double end_t  = get_scenario_time();
-   double data_t = ref_frame.get_time();
-
-   // Save the compensation time step.
-   this->compensate_dt = end_t - data_t;
-
-   // Use the inherited debug-handler to allow debug comments to be turned
-   // on and off from a setting in the input file.
-   if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
-      ostringstream errmsg;
-      errmsg << "******* RefFrameLagCompInteg::receive_lag_compensation():" << __LINE__ << endl
-             << "  scenario-time:" << end_t << endl
-             << "      data-time:" << data_t << endl
-             << " comp-time-step:" << this->compensate_dt << endl;
-      message_publish( MSG_WARNING, errmsg.str().c_str() );
-   }
-
-   // Because of ownership transfers and attributes being sent at different
-   // rates we need to check to see if we received attribute data.
-   if ( state_attr->is_received() ) {
-
-      // Copy the current RefFrame state over to the lag compensated state.
-      load_lag_comp_data();
-      Q_dot.derivative_first( lag_comp_data.att, lag_comp_data.ang_vel );
-
-      // Print out debug information if desired.
-      if ( debug ) {
-         ostringstream msg;
-         msg << "Receive data before compensation:" << endl;
-         print_lag_comp_data( msg );
-         message_publish( MSG_NORMAL, msg.str().c_str() );
-      }
-
-      // Compensate the data
-      compensate( data_t, end_t );
-
-      // Print out debug information if desired.
-      if ( debug ) {
-         ostringstream msg;
-         msg << "Receive data after compensation:" << endl;
-         print_lag_comp_data( msg );
-         message_publish( MSG_NORMAL, msg.str().c_str() );
-      }
-   }
-
-   // Copy the compensated state to the packing data.
-   unload_lag_comp_data();
-
-   // Move the unpacked data into the working data.
-   ref_frame.unpack_into_working_data();
-
-   // Return to calling routine.
-   return;
-}
@@ -158,6 +158,30 @@ bool SpaceTimeCoordinateData::is_equal(
    return ( true );
 }
 
+/*!
+ * @job_class{scheduled}
+ */
+void SpaceTimeCoordinateData::propagate(
+   double const dt,
+   double const accel[3],
+   double const ang_accel[3] )
+{
+   double const half_dt_sq = 0.5 * dt * dt;
+
+   // Propagate the attitude first since it depends on the angular
+   // velocity at the start of the interval.
+   att.propagate( att, ang_vel, ang_accel, dt );
+
+   // Translational and rotational rates.
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      pos[iinc] += ( vel[iinc] * dt ) + ( accel[iinc] * half_dt_sq );
+      vel[iinc] += accel[iinc] * dt;
+      ang_vel[iinc] += ang_accel[iinc] * dt;
+   }
+
+   return;
+}
+
 /*!
  * @job_class{scheduled}
  */
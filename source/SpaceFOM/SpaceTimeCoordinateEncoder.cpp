@@ -16,19 +16,15 @@ NASA, Johnson Space Center\n
 
 @tldh
 @trick_link_dependency{SpaceTimeCoordinateEncoder.cpp}
+@trick_link_dependency{../TrickHLA/OpaqueBuffer.cpp}
 
 @revs_title
 @revs_begin
 @rev_entry{Edwin Z. Crues, NASA ER7, --, May 2016, NExSyS, Initial version}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Single-pass fixed layout encoding.}
 @revs_end
 */
 
-// System includes.
-#include <cstring>
-#include <ostream>
-#include <sstream>
-#include <string>
-
 // Trick includes.
 #include "trick/message_proto.h"
 #include "trick/message_type.h"
@@ -39,27 +35,8 @@ NASA, Johnson Space Center\n
 #include "SpaceFOM/SpaceTimeCoordinateEncoder.hh"
 
 // TrickHLA includes.
-#include "TrickHLA/DebugHandler.hh"
-#include "TrickHLA/HLAStandardSupport.hh"
-#include "TrickHLA/utils/StringUtilities.hh"
-
-// C++11 deprecated dynamic exception specifications for a function so we need
-// to silence the warnings coming from the IEEE 1516 declared functions.
-// This should work for both GCC and Clang.
-#if defined( IEEE_1516_2010 )
-#   pragma GCC diagnostic push
-#   pragma GCC diagnostic ignored "-Wdeprecated"
-#endif
-
-// HLA Encoder helper includes.
-#include "RTI/VariableLengthData.h"
-#include "RTI/encoding/EncodingExceptions.h"
-
-#if defined( IEEE_1516_2010 )
-#   pragma GCC diagnostic pop
-#endif
-
-using namespace RTI1516_NAMESPACE;
+#include "TrickHLA/OpaqueBuffer.hh"
+
 using namespace std;
 using namespace TrickHLA;
 using namespace SpaceFOM;
@@ -69,19 +46,9 @@ using namespace SpaceFOM;
  */
 SpaceTimeCoordinateEncoder::SpaceTimeCoordinateEncoder(
    SpaceTimeCoordinateData &stc_data )
-   : data( stc_data ),
-     position_encoder( HLAfloat64LE(), 3 ),
-     velocity_encoder( HLAfloat64LE(), 3 ),
-     trans_state_encoder(),
-     quat_scalar_encoder( &data.att.scalar ),
-     quat_vector_encoder( HLAfloat64LE(), 3 ),
-     quat_encoder(),
-     ang_vel_encoder( HLAfloat64LE(), 3 ),
-     rot_state_encoder(),
-     time_encoder( &data.time ),
-     encoder()
+   : data( stc_data )
 {
-   // Build up the encoders.
+   // Encoding layout:
    // ObjectClass: ReferenceFrame, FOM-Module: SISO_SpaceFOM_environment.xml
    //   Attribute-Name: state, dataType: SpaceTimeCoordinateState, encoding: HLAfixedRecord, FOM-Module: SISO_SpaceFOM_datatypes.xml
    //     field-Name: translational_state, dataType: ReferenceFrameTranslation, encoding: HLAfixedRecord, FOM-Module: SISO_SpaceFOM_datatypes.xml
@@ -93,60 +60,15 @@ SpaceTimeCoordinateEncoder::SpaceTimeCoordinateEncoder(
    //         field-name: vector, dataType: Vector, dataType:(Scalar,representation:HLAfloat64LE), encoding:HLAfixedArray, cardinality: 3
    //       field-Name: angular_velocity, dataType: AngularVelocityVector
    //         AngularVelocityVector: dataType:(AngularRate,representation:HLAfloat64LE), encoding:HLAfixedArray, cardinality:3
+   //     field-Name: time, dataType: Time, representation: HLAfloat64LE
    //
-
-   // Build up the Translational state encoder.
-   for ( int i = 0; i < 3; ++i ) {
-      // Position.
-      position[i].setDataPointer( &data.pos[i] );
-      position_encoder.setElementPointer( i, &position[i] );
-      // Velocity.
-      velocity[i].setDataPointer( &data.vel[i] );
-      velocity_encoder.setElementPointer( i, &velocity[i] );
-   }
-   // Add position and velocity encoders to the translational state encoder.
-   trans_state_encoder.appendElementPointer( &position_encoder );
-   trans_state_encoder.appendElementPointer( &velocity_encoder );
-
-   // Build up the Rotational state encoder.
-   // Quaternion:
-   // Quaternion scalar: The attitude quaternion scalar encoder was configured
-   // in the constructor initialization list above.
-   // Quaternion vector:
-   for ( int i = 0; i < 3; ++i ) {
-      quat_vector[i].setDataPointer( &data.att.vector[i] );
-      quat_vector_encoder.setElementPointer( i, &quat_vector[i] );
-   }
-   // Add the scalar and vector encoders to the quaternion encoder.
-   quat_encoder.appendElementPointer( &quat_scalar_encoder );
-   quat_encoder.appendElementPointer( &quat_vector_encoder );
-
-   // Angular velocity:
-   for ( int i = 0; i < 3; ++i ) {
-      angular_velocity[i].setDataPointer( &data.ang_vel[i] );
-      ang_vel_encoder.setElementPointer( i, &angular_velocity[i] );
-   }
-   // Add attitude quaternion and angular velocity encoders to the
-   // rotational state encoder.
-   rot_state_encoder.appendElementPointer( &quat_encoder );
-   rot_state_encoder.appendElementPointer( &ang_vel_encoder );
-
-   // Build up the time encoder.
-   // NOTE: The time encoder was configured in the constructor initialization
-   // list above.
-
-   // Add the translation and rotational state encoders to space/time encoder.
-   encoder.appendElementPointer( &trans_state_encoder );
-   encoder.appendElementPointer( &rot_state_encoder );
-   encoder.appendElementPointer( &time_encoder );
+   // Every field is an HLAfloat64LE with an 8 byte octet boundary; so, the
+   // fixed record has no padding and is 14 consecutive little-endian doubles.
 
    // Setup the TrickHLA buffer based on the size of the encoded fixed record.
    // We can do this here because the record is a fixed size all the time.
    set_byte_alignment( 1 );
-   ensure_buffer_capacity( encoder.getEncodedLength() );
-
-   // Initialize the variable length data to point to the buffer.
-   encoded_data.setDataPointer( buffer, capacity );
+   ensure_buffer_capacity( 14 * sizeof( double ) );
 
    return;
 }
@@ -156,39 +78,14 @@ SpaceTimeCoordinateEncoder::SpaceTimeCoordinateEncoder(
  */
 void SpaceTimeCoordinateEncoder::encode()
 {
-   // Encode the STC data into the VariableLengthData encoded data.
-   try {
-      encoder.encode( encoded_data );
-   } catch ( RTI1516_NAMESPACE::EncoderException &e ) {
-      ostringstream errmsg;
-      std::string   what_s;
-      StringUtilities::to_string( what_s, e.what() );
-      errmsg << "SpaceFOM::SpaceTimeCoordinateEncoder::encode():" << __LINE__
-             << " Error: Encoder exception!" << endl;
-      errmsg << what_s;
-      // Print message and terminate.
-      TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
-   }
-
-   // Copy the encoded data into the buffer.
-   if ( get_capacity() >= encoded_data.size() ) {
-
-      // Note that the encode operation above encodes into the encoded_data
-      // VariableLengthData instance but into a different data area that the
-      // one set in the constructor above.  So, we have to copy the encoded
-      // data into the transmission buffer.
-      memcpy( buffer, encoded_data.data(), encoded_data.size() ); // flawfinder: ignore
-
-   } else {
-
-      // Print message and terminate.
-      ostringstream errmsg;
-      errmsg << "SpaceFOM::SpaceTimeCoordinateEncoder::encode():" << __LINE__
-             << " WARNING: Encoded data size does not match buffer!"
-             << "    Encoded size: " << encoded_data.size()
-             << " but Expected size: " << get_capacity();
-      message_publish( MSG_WARNING, errmsg.str().c_str() );
-   }
+   // Encode the STC data straight into the transmission buffer.
+   reset_push_position();
+   push_float64_le_to_buffer( data.pos, 3 );
+   push_float64_le_to_buffer( data.vel, 3 );
+   push_float64_le_to_buffer( &data.att.scalar, 1 );
+   push_float64_le_to_buffer( data.att.vector, 3 );
+   push_float64_le_to_buffer( data.ang_vel, 3 );
+   push_float64_le_to_buffer( &data.time, 1 );
 
    return;
 }
@@ -198,21 +95,24 @@ void SpaceTimeCoordinateEncoder::encode()
  */
 void SpaceTimeCoordinateEncoder::decode()
 {
-
-   // Decode the STC fixed record.  This will decode the incoming data
-   // directly into the STC data instance passed into the constructor.
-   try {
-      encoder.decode( encoded_data );
-   } catch ( RTI1516_NAMESPACE::EncoderException &e ) {
-      ostringstream errmsg;
-      std::string   what_s;
-      StringUtilities::to_string( what_s, e.what() );
-      errmsg << "SpaceFOM::SpaceTimeCoordinateEncoder::decode():" << __LINE__
-             << " Error: Encoder exception!" << endl;
-      errmsg << what_s;
-      // Print message and terminate.
-      TrickHLA::DebugHandler::terminate_with_message( errmsg.str() );
+   // Decode the STC fixed record straight from the received buffer into the
+   // STC data instance passed into the constructor.
+   reset_pull_position();
+
+   // Ignore a short record instead of pulling past the end of the data.
+   if ( get_data_size() < ( 14 * sizeof( double ) ) ) {
+      message_publish( MSG_WARNING, "SpaceFOM::SpaceTimeCoordinateEncoder::decode():%d WARNING: \
+Received %d bytes but the encoded SpaceTimeCoordinateState is %d bytes, ignoring the data!\n",
+                       __LINE__, (int)get_data_size(), (int)( 14 * sizeof( double ) ) );
+      return;
    }
 
+   pull_float64_le_from_buffer( data.pos, 3 );
+   pull_float64_le_from_buffer( data.vel, 3 );
+   pull_float64_le_from_buffer( &data.att.scalar, 1 );
+   pull_float64_le_from_buffer( data.att.vector, 3 );
+   pull_float64_le_from_buffer( data.ang_vel, 3 );
+   pull_float64_le_from_buffer( &data.time, 1 );
+
    return;
 }
@@ -0,0 +1,233 @@
+/*!
+@file SpaceFOM/SpaceTimeCoordinateHistory.cpp
+@ingroup SpaceFOM
+@brief This class provides the implementation of a fixed capacity
+time-stamped state history for received SpaceFOM space/time coordinate states.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{SpaceTimeCoordinateHistory.cpp}
+@trick_link_dependency{SpaceTimeCoordinateData.cpp}
+@trick_link_dependency{QuaternionData.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// System includes.
+#include <vector>
+
+// Trick includes.
+#include "trick/vector_macros.h"
+
+// SpaceFOM includes.
+#include "SpaceFOM/SpaceTimeCoordinateData.hh"
+#include "SpaceFOM/SpaceTimeCoordinateHistory.hh"
+
+using namespace std;
+using namespace SpaceFOM;
+
+/*!
+ * @job_class{initialization}
+ */
+SpaceTimeCoordinateSample::SpaceTimeCoordinateSample()
+   : state()
+{
+   V_INIT( accel );
+   V_INIT( ang_accel );
+}
+
+/*!
+ * @job_class{initialization}
+ */
+SpaceTimeCoordinateHistory::SpaceTimeCoordinateHistory()
+   : samples(),
+     oldest( 0 ),
+     count( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+SpaceTimeCoordinateHistory::~SpaceTimeCoordinateHistory()
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void SpaceTimeCoordinateHistory::set_capacity(
+   unsigned int const size )
+{
+   samples.resize( size );
+   clear();
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void SpaceTimeCoordinateHistory::clear()
+{
+   oldest = 0;
+   count  = 0;
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+bool SpaceTimeCoordinateHistory::add_sample(
+   SpaceTimeCoordinateData const &state,
+   double const                   accel[3],
+   double const                   ang_accel[3] )
+{
+   if ( samples.empty() ) {
+      return false;
+   }
+
+   unsigned int index;
+   if ( count > 0 ) {
+      unsigned int const newest      = ( oldest + count - 1 ) % samples.size();
+      double const       newest_time = samples[newest].state.time;
+      if ( state.time < newest_time ) {
+         // Out of order sample.
+         return false;
+      }
+      if ( state.time == newest_time ) {
+         // Replace a resent sample for the same time.
+         index = newest;
+      } else if ( count < samples.size() ) {
+         index = ( oldest + count ) % samples.size();
+         ++count;
+      } else {
+         // The history is full; so, overwrite the oldest sample.
+         index  = oldest;
+         oldest = ( oldest + 1 ) % samples.size();
+      }
+   } else {
+      index = oldest;
+      count = 1;
+   }
+
+   samples[index].state = state;
+   V_COPY( samples[index].accel, accel );
+   V_COPY( samples[index].ang_accel, ang_accel );
+
+   return true;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+double SpaceTimeCoordinateHistory::get_oldest_time() const
+{
+   return ( ( count > 0 ) ? get_sample( 0 ).state.time : 0.0 );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+double SpaceTimeCoordinateHistory::get_newest_time() const
+{
+   return ( ( count > 0 ) ? get_sample( count - 1 ).state.time : 0.0 );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+bool SpaceTimeCoordinateHistory::get_state(
+   double const             time,
+   SpaceTimeCoordinateData &state ) const
+{
+   if ( count == 0 ) {
+      return false;
+   }
+
+   SpaceTimeCoordinateSample const &first = get_sample( 0 );
+   SpaceTimeCoordinateSample const &last  = get_sample( count - 1 );
+
+   if ( time >= last.state.time ) {
+      // Extrapolate forward from the newest sample.
+      state = last.state;
+      state.propagate( time - last.state.time, last.accel, last.ang_accel );
+   } else if ( time <= first.state.time ) {
+      // Extrapolate backward from the oldest sample.
+      state = first.state;
+      state.propagate( time - first.state.time, first.accel, first.ang_accel );
+   } else {
+      // Binary search for the samples that bracket the time.
+      unsigned int lower = 0;
+      unsigned int upper = count - 1;
+      while ( ( upper - lower ) > 1 ) {
+         unsigned int const middle = ( lower + upper ) / 2;
+         if ( get_sample( middle ).state.time <= time ) {
+            lower = middle;
+         } else {
+            upper = middle;
+         }
+      }
+      interpolate( get_sample( lower ), get_sample( upper ), time, state );
+   }
+
+   state.time = time;
+
+   return true;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void SpaceTimeCoordinateHistory::interpolate(
+   SpaceTimeCoordinateSample const &begin,
+   SpaceTimeCoordinateSample const &end,
+   double const                     time,
+   SpaceTimeCoordinateData         &state )
+{
+   double const h  = end.state.time - begin.state.time;
+   double const s  = ( time - begin.state.time ) / h;
+   double const s2 = s * s;
+   double const s3 = s2 * s;
+
+   // Cubic Hermite basis functions and their derivatives with respect to s.
+   // The position basis functions sum to one; so, the position terms are
+   // written in terms of the position difference to limit round off.
+   double const h01 = ( -2.0 * s3 ) + ( 3.0 * s2 );
+   double const h10 = s3 - ( 2.0 * s2 ) + s;
+   double const h11 = s3 - s2;
+
+   double const dh01 = ( -6.0 * s2 ) + ( 6.0 * s );
+   double const dh10 = ( 3.0 * s2 ) - ( 4.0 * s ) + 1.0;
+   double const dh11 = ( 3.0 * s2 ) - ( 2.0 * s );
+
+   for ( int iinc = 0; iinc < 3; ++iinc ) {
+      double const dp = end.state.pos[iinc] - begin.state.pos[iinc];
+      double const v0 = begin.state.vel[iinc];
+      double const v1 = end.state.vel[iinc];
+
+      state.pos[iinc] = begin.state.pos[iinc] + ( h01 * dp ) + ( h * ( ( h10 * v0 ) + ( h11 * v1 ) ) );
+      state.vel[iinc] = ( dh01 * dp / h ) + ( dh10 * v0 ) + ( dh11 * v1 );
+
+      state.ang_vel[iinc] = ( ( 1.0 - s ) * begin.state.ang_vel[iinc] ) + ( s * end.state.ang_vel[iinc] );
+   }
+
+   state.att.slerp( begin.state.att, end.state.att, s );
+
+   return;
+}
@@ -26,6 +26,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{Types.cpp}
 @trick_link_dependency{encoding/EncoderBase.cpp}
 @trick_link_dependency{time/Int64BaseTime.cpp}
+@trick_link_dependency{utils/TrafficCounters.cpp}
 @trick_link_dependency{utils/Utilities.cpp}
 
 
@@ -93,6 +94,8 @@ Attribute::Attribute()
      subscribe( false ),
      locally_owned( false ),
      cycle_time( -std::numeric_limits< double >::max() ),
+     traffic(),
+     class_attribute( NULL ),
      value_changed( false ),
      update_requested( false ),
      cycle_ratio( 1 ),
@@ -118,13 +121,69 @@ void Attribute::initialize(
    std::string const &obj_FOM_name,
    int const          object_index,
    int const          attribute_index )
+{
+   ostringstream config_name;
+   config_name << "THLA.manager.objects[" << object_index
+               << "].attributes[" << attribute_index << "]";
+   initialize( obj_FOM_name, config_name.str() );
+}
+
+void Attribute::initialize(
+   std::string const &obj_FOM_name,
+   std::string const &config_name )
 {
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 
+   validate( obj_FOM_name, config_name );
+
+   // Initialize the element encoders including a fixed record encoder.
+   initialize_element_encoder();
+
+   if ( this->encoder == NULL ) {
+      ostringstream errmsg;
+      errmsg << "Attribute::initialize():" << __LINE__
+             << " ERROR: Unexpected NULL encoder for Trick variable '"
+             << get_trick_name() << "' with an 'rti_encoding' value of "
+             << encoding_enum_to_string( rti_encoding ) << "." << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+      ostringstream msg;
+      msg << "Attribute::initialize():" << __LINE__ << endl;
+      message_publish( MSG_NORMAL, msg.str().c_str() );
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
+      string attr_handle_string;
+      StringUtilities::to_string( attr_handle_string, this->attr_handle );
+      ostringstream msg;
+      msg << "Attribute::initialize():" << __LINE__ << endl
+          << "========================================================" << endl
+          << "  FOM_name:'" << get_FOM_name() << "'" << endl
+          << "  trick_name:'" << get_trick_name() << "'" << endl
+          << "  AttributeHandle:" << attr_handle_string << endl
+          << "  publish:" << publish << endl
+          << "  subscribe:" << subscribe << endl
+          << "  locally_owned:" << locally_owned << endl
+          << "  rti_encoding:" << rti_encoding << endl
+          << "  changed:" << ( is_changed() ? "Yes" : "No" ) << endl;
+      message_publish( MSG_NORMAL, msg.str().c_str() );
+   }
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void Attribute::validate(
+   std::string const &obj_FOM_name,
+   std::string const &config_name )
+{
    // Make sure we have a valid Object FOM name.
    if ( obj_FOM_name.empty() ) {
       ostringstream errmsg;
-      errmsg << "Attribute::initialize():" << __LINE__
+      errmsg << "Attribute::validate():" << __LINE__
              << " ERROR: Unexpected NULL Object FOM-Name argument passed to this"
              << " function.";
       if ( !get_FOM_name().empty() ) {
@@ -137,11 +196,10 @@ void Attribute::initialize(
    // Make sure we have a valid attribute FOM name.
    if ( get_FOM_name().empty() ) {
       ostringstream errmsg;
-      errmsg << "Attribute::initialize():" << __LINE__
+      errmsg << "Attribute::validate():" << __LINE__
              << " ERROR: Object with FOM Name '" << obj_FOM_name << "' has a missing"
-             << " FOM name for the attribute. Make sure THLA.manager.objects["
-             << object_index << "].attributes[" << attribute_index
-             << "].FOM_name' in either your input.py file or modified-data files"
+             << " FOM name for the attribute. Make sure '"
+             << config_name << ".FOM_name' in either your input.py file or modified-data files"
              << " is correctly specified." << endl;
       DebugHandler::terminate_with_message( errmsg.str() );
    }
@@ -150,12 +208,11 @@ void Attribute::initialize(
       // Make sure we have a valid attribute Trick-Name.
       if ( trick_name.empty() ) {
          ostringstream errmsg;
-         errmsg << "Attribute::initialize():" << __LINE__
+         errmsg << "Attribute::validate():" << __LINE__
                 << " ERROR: FOM Object Attribute '"
                 << obj_FOM_name << "'->'" << get_FOM_name() << "' has a missing Trick name"
-                << " for the attribute. Make sure THLA.manager.objects["
-                << object_index << "].attributes[" << attribute_index
-                << "].trick_name' in either your input.py file or modified-data files"
+                << " for the attribute. Make sure '"
+                << config_name << ".trick_name' in either your input.py file or modified-data files"
                 << " is correctly specified." << endl;
          DebugHandler::terminate_with_message( errmsg.str() );
       }
@@ -164,7 +221,7 @@ void Attribute::initialize(
    // Do a quick bounds check on the 'rti_encoding' value.
    if ( ( rti_encoding < ENCODING_FIRST_VALUE ) || ( rti_encoding > ENCODING_LAST_VALUE ) ) {
       ostringstream errmsg;
-      errmsg << "Attribute::initialize():" << __LINE__
+      errmsg << "Attribute::validate():" << __LINE__
              << " ERROR: FOM Object Attribute '"
              << obj_FOM_name << "'->'" << get_FOM_name() << "' with Trick name '"
              << get_trick_name() << "' has an 'rti_encoding' value of " << rti_encoding
@@ -178,7 +235,7 @@ void Attribute::initialize(
    // Do a quick bounds check on the 'preferred_order' value.
    if ( ( preferred_order < TRANSPORT_FIRST_VALUE ) || ( preferred_order > TRANSPORT_LAST_VALUE ) ) {
       ostringstream errmsg;
-      errmsg << "Attribute::initialize():" << __LINE__
+      errmsg << "Attribute::validate():" << __LINE__
              << " ERROR: FOM Object Attribute '"
              << obj_FOM_name << "'->'" << get_FOM_name() << "' with Trick name '"
              << get_trick_name() << "' has an invalid 'preferred_order' and it must be"
@@ -191,7 +248,7 @@ void Attribute::initialize(
    // Do a bounds check on the 'config' value.
    if ( ( config < CONFIG_NONE ) || ( config > CONFIG_MAX_VALUE ) ) {
       ostringstream errmsg;
-      errmsg << "Attribute::initialize():" << __LINE__
+      errmsg << "Attribute::validate():" << __LINE__
              << " ERROR: FOM Object Attribute '"
              << obj_FOM_name << "'->'" << get_FOM_name() << "' with Trick name '"
              << get_trick_name() << "' has a 'config' value of " << config
@@ -206,7 +263,7 @@ void Attribute::initialize(
    if ( config == CONFIG_NONE ) {
       if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
          ostringstream errmsg;
-         errmsg << "Attribute::initialize():" << __LINE__
+         errmsg << "Attribute::validate():" << __LINE__
                 << " WARNING: FOM Object Attribute '"
                 << obj_FOM_name << "'->'" << get_FOM_name() << "' with Trick name '"
                 << get_trick_name() << "' has a 'config' value of CONFIG_TYPE_NONE." << endl;
@@ -218,7 +275,7 @@ void Attribute::initialize(
    // job-cycle-time we will do another bounds check against that value.
    if ( ( this->cycle_time <= 0.0 ) && ( this->cycle_time > -std::numeric_limits< double >::max() ) ) {
       ostringstream errmsg;
-      errmsg << "Attribute::initialize():" << __LINE__
+      errmsg << "Attribute::validate():" << __LINE__
              << " ERROR: FOM Object Attribute '"
              << obj_FOM_name << "'->'" << get_FOM_name()
              << "' with Trick name '" << get_trick_name()
@@ -228,41 +285,56 @@ void Attribute::initialize(
              << " the value for the 'cycle_time' is correctly specified." << endl;
       DebugHandler::terminate_with_message( errmsg.str() );
    }
+}
 
-   // Initialize the element encoders including a fixed record encoder.
-   initialize_element_encoder();
+/*!
+ * @details The Trick type information of the class level attribute has
+ * already been resolved once, so the instance only needs the address of its
+ * own data to build the encoder. The FOM name is not copied and comes from
+ * the class level attribute.
+ * @job_class{initialization}
+ */
+void Attribute::initialize_instance(
+   Attribute const   *class_attr,
+   std::string const &obj_FOM_name,
+   std::string const &config_name,
+   std::string const &instance_trick_name,
+   void              *address,
+   ATTRIBUTES        *attr )
+{
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+   if ( class_attr == NULL ) {
+      ostringstream errmsg;
+      errmsg << "Attribute::initialize_instance():" << __LINE__
+             << " ERROR: Unexpected NULL class level attribute!" << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+
+   this->class_attribute = class_attr;
+   this->trick_name      = instance_trick_name;
+   this->rti_encoding    = class_attr->rti_encoding;
+   this->config          = class_attr->config;
+   this->preferred_order = class_attr->preferred_order;
+   this->publish         = class_attr->publish;
+   this->subscribe       = class_attr->subscribe;
+   this->cycle_time      = class_attr->cycle_time;
+   this->attr_handle     = class_attr->attr_handle;
+
+   validate( obj_FOM_name, config_name );
+
+   // Only the instance address differs from the class level attribute.
+   initialize_element_encoder( address, attr );
 
    if ( this->encoder == NULL ) {
       ostringstream errmsg;
-      errmsg << "Attribute::initialize():" << __LINE__
+      errmsg << "Attribute::initialize_instance():" << __LINE__
              << " ERROR: Unexpected NULL encoder for Trick variable '"
              << get_trick_name() << "' with an 'rti_encoding' value of "
              << encoding_enum_to_string( rti_encoding ) << "." << endl;
       DebugHandler::terminate_with_message( errmsg.str() );
    }
-
-   if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-      ostringstream msg;
-      msg << "Attribute::initialize():" << __LINE__ << endl;
-      message_publish( MSG_NORMAL, msg.str().c_str() );
-   }
-
-   if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_ATTRIBUTE ) ) {
-      string attr_handle_string;
-      StringUtilities::to_string( attr_handle_string, this->attr_handle );
-      ostringstream msg;
-      msg << "Attribute::initialize():" << __LINE__ << endl
-          << "========================================================" << endl
-          << "  FOM_name:'" << get_FOM_name() << "'" << endl
-          << "  trick_name:'" << get_trick_name() << "'" << endl
-          << "  AttributeHandle:" << attr_handle_string << endl
-          << "  publish:" << publish << endl
-          << "  subscribe:" << subscribe << endl
-          << "  locally_owned:" << locally_owned << endl
-          << "  rti_encoding:" << rti_encoding << endl
-          << "  changed:" << ( is_changed() ? "Yes" : "No" ) << endl;
-      message_publish( MSG_NORMAL, msg.str().c_str() );
-   }
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 }
 
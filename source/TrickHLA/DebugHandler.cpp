@@ -47,6 +47,10 @@ using namespace TrickHLA;
 DebugLevelEnum  DebugHandler::debug_level  = DEBUG_LEVEL_NO_TRACE;
 DebugSourceEnum DebugHandler::code_section = DEBUG_SOURCE_ALL_MODULES;
 
+// Initialize the queue warning thresholds, which are disabled by default.
+int    DebugHandler::queue_depth_warning = 0;
+double DebugHandler::queue_age_warning   = 0.0;
+
 bool DebugHandler::show(
    DebugLevelEnum const  level,
    DebugSourceEnum const code )
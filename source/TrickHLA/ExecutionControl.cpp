@@ -23,6 +23,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{Manager.cpp}
 @trick_link_dependency{Types.cpp}
 @trick_link_dependency{time/Int64BaseTime.cpp}
+@trick_link_dependency{utils/StartupProfiler.cpp}
 
 @revs_title
 @revs_begin
@@ -53,6 +54,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Manager.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/time/Int64BaseTime.hh"
+#include "TrickHLA/utils/StartupProfiler.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
 // to silence the warnings coming from the IEEE 1516 declared functions.
@@ -159,6 +161,8 @@ void ExecutionControl::initialize()
 */
 void ExecutionControl::pre_multi_phase_init_processes()
 {
+   StartupProfilerScope profile_scope( "ExecutionControl::pre_multi_phase_init_processes", "phase" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_EXECUTION_CONTROL ) ) {
       message_publish( MSG_NORMAL, "TrickHLA::ExecutionControl::pre_multi_phase_init_processes():%d\n", __LINE__ );
    }
@@ -265,6 +269,8 @@ void ExecutionControl::pre_multi_phase_init_processes()
 */
 void ExecutionControl::post_multi_phase_init_processes()
 {
+   StartupProfilerScope profile_scope( "ExecutionControl::post_multi_phase_init_processes", "phase" );
+
    // Make sure we setup time constrained and time regulating with the RTI.
    federate->setup_time_management();
 
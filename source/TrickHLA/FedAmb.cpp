@@ -32,6 +32,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{FedAmb.cpp}
 @trick_link_dependency{Federate.cpp}
 @trick_link_dependency{Manager.cpp}
+@trick_link_dependency{TrafficRecorder.cpp}
 @trick_link_dependency{Types.cpp}
 @trick_link_dependency{utils/MutexLock.cpp}
 @trick_link_dependency{utils/MutexProtection.cpp}
@@ -69,6 +70,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/HLAStandardSupport.hh"
 #include "TrickHLA/Manager.hh"
 #include "TrickHLA/Object.hh"
+#include "TrickHLA/TrafficRecorder.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/time/Int64Time.hh"
 #include "TrickHLA/utils/MutexProtection.hh"
@@ -675,6 +677,8 @@ NULL Manager! Can't do anything with discovered object '%s' Instance-ID:%s\n",
          message_publish( MSG_WARNING, "FedAmb::discoverObjectInstance():%d Object '%s' with Instance-ID:%s is UNKNOWN to me!\n",
                           __LINE__, name_str.c_str(), id_str.c_str() );
       }
+   } else if ( manager->traffic_recorder.is_recording() ) {
+      manager->traffic_recorder.record_discover( objectInstance );
    }
 }
 #endif // IEEE_1516_2010
@@ -717,6 +721,8 @@ NULL Manager! Can't do anything with discovered object '%s' Instance-ID:%s\n",
          message_publish( MSG_WARNING, "FedAmb::discoverObjectInstance():%d Object '%s' with Instance-ID:%s is UNKNOWN to me!\n",
                           __LINE__, name_str.c_str(), id_str.c_str() );
       }
+   } else if ( manager->traffic_recorder.is_recording() ) {
+      manager->traffic_recorder.record_discover( objectInstance );
    }
 }
 
@@ -746,11 +752,11 @@ void FedAmb::reflectAttributeValues(
                           __LINE__, trickhla_obj->get_name().c_str() );
       }
 
-      trickhla_obj->enqueue_data( const_cast< AttributeHandleValueMap & >( attributeValues ) );
+      if ( manager->traffic_recorder.is_recording() ) {
+         manager->traffic_recorder.record_reflect( trickhla_obj, attributeValues, userSuppliedTag, NULL );
+      }
 
-#ifdef TRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS
-      ++trickhla_obj->receive_count;
-#endif
+      trickhla_obj->enqueue_data( attributeValues, userSuppliedTag );
    } else if ( ( federate != NULL ) && federate->is_federate_instance_id( objectInstance ) ) {
 
       if ( federation_restored_rebuild_federate_handle_set ) {
@@ -780,6 +786,11 @@ void FedAmb::reflectAttributeValues(
                           __LINE__, id_str.c_str() );
       }
       federate->set_MOM_HLAfederation_instance_attributes( objectInstance, attributeValues );
+   } else if ( ( federate != NULL ) && federate->time_straggler_monitor.is_enabled()
+               && federate->is_MOM_HLAfederate_instance_id( objectInstance ) ) {
+      // The time attributes of a MOM HLAfederate instance whose name was
+      // already absorbed into the running federates.
+      federate->time_straggler_monitor.reflect_MOM_time_attributes( objectInstance, attributeValues );
    } else {
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
          string handle_str;
@@ -825,11 +836,11 @@ void FedAmb::reflectAttributeValues(
                           __LINE__, trickhla_obj->get_name().c_str(), i64time.get_time_in_seconds() );
       }
 
-      trickhla_obj->enqueue_data( const_cast< AttributeHandleValueMap & >( attributeValues ) );
+      if ( manager->traffic_recorder.is_recording() ) {
+         manager->traffic_recorder.record_reflect( trickhla_obj, attributeValues, userSuppliedTag, &time );
+      }
 
-#   ifdef TRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS
-      ++trickhla_obj->receive_count;
-#   endif
+      trickhla_obj->enqueue_data( attributeValues, userSuppliedTag );
    } else {
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
          string id_str;
@@ -877,11 +888,11 @@ void FedAmb::reflectAttributeValues(
                           __LINE__, trickhla_obj->get_name().c_str(), i64time.get_time_in_seconds() );
       }
 
-      trickhla_obj->enqueue_data( const_cast< AttributeHandleValueMap & >( attributeValues ) );
+      if ( manager->traffic_recorder.is_recording() ) {
+         manager->traffic_recorder.record_reflect( trickhla_obj, attributeValues, userSuppliedTag, &time );
+      }
 
-#ifdef TRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS
-      ++trickhla_obj->receive_count;
-#endif
+      trickhla_obj->enqueue_data( attributeValues, userSuppliedTag );
    } else {
       if ( DebugHandler::show( DEBUG_LEVEL_8_TRACE, DEBUG_SOURCE_FED_AMB ) ) {
          string id_str;
@@ -920,6 +931,11 @@ void FedAmb::receiveInteraction(
                           __LINE__ );
       }
 
+      if ( manager->traffic_recorder.is_recording() ) {
+         manager->traffic_recorder.record_interaction( interactionClass, parameterValues,
+                                                       userSuppliedTag, NULL, false );
+      }
+
       // Process the interaction.
       manager->receive_interaction( interactionClass,
                                     const_cast< ParameterHandleValueMap & >( parameterValues ),
@@ -952,6 +968,12 @@ void FedAmb::receiveInteraction(
                           __LINE__, i64time.get_time_in_seconds() );
       }
 
+      if ( manager->traffic_recorder.is_recording() ) {
+         manager->traffic_recorder.record_interaction( interactionClass, parameterValues,
+                                                       userSuppliedTag, &time,
+                                                       ( receivedOrderType == RTI1516_NAMESPACE::TIMESTAMP ) );
+      }
+
       manager->receive_interaction( interactionClass,
                                     const_cast< ParameterHandleValueMap & >( parameterValues ),
                                     userSuppliedTag,
@@ -996,6 +1018,12 @@ void FedAmb::receiveInteraction(
                           __LINE__, i64time.get_time_in_seconds() );
       }
 
+      if ( manager->traffic_recorder.is_recording() ) {
+         manager->traffic_recorder.record_interaction( interactionClass, parameterValues,
+                                                       userSuppliedTag, &time,
+                                                       ( receivedOrderType == RTI1516_NAMESPACE::TIMESTAMP ) );
+      }
+
       // Process the interaction.
       manager->receive_interaction( interactionClass,
                                     const_cast< ParameterHandleValueMap & >( parameterValues ),
@@ -1068,6 +1096,10 @@ void FedAmb::removeObjectInstance(
    // Remove the instance ID for a federate, which this function will test for.
    federate->remove_MOM_HLAfederate_instance_id( objectInstance );
 
+   if ( manager->traffic_recorder.is_recording() ) {
+      manager->traffic_recorder.record_remove( objectInstance );
+   }
+
    // Mark this object as deleted from the RTI.
    manager->mark_object_as_deleted_from_federation( objectInstance );
 }
@@ -1100,6 +1132,10 @@ void FedAmb::removeObjectInstance(
       }
    }
 
+   if ( manager->traffic_recorder.is_recording() ) {
+      manager->traffic_recorder.record_remove( objectInstance );
+   }
+
    // Mark this object as deleted from the RTI.
    manager->mark_object_as_deleted_from_federation( objectInstance );
 }
@@ -1144,6 +1180,10 @@ void FedAmb::removeObjectInstance(
       }
    }
 
+   if ( manager->traffic_recorder.is_recording() ) {
+      manager->traffic_recorder.record_remove( objectInstance );
+   }
+
    // Mark this object as deleted from the RTI.
    manager->mark_object_as_deleted_from_federation( objectInstance );
 }
@@ -1862,6 +1902,9 @@ void FedAmb::timeAdvanceGrant(
    throw( FederateInternalError )
 #endif // IEEE_1516_2010
 {
+   if ( ( manager != NULL ) && manager->traffic_recorder.is_recording() ) {
+      manager->traffic_recorder.record_time_advance_grant( time );
+   }
    federate->set_time_advance_granted( time );
 }
 
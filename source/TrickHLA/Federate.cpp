@@ -23,10 +23,14 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{SaveRestoreServices.cpp}
 @trick_link_dependency{Types.cpp}
 @trick_link_dependency{time/TimeManagementServices.cpp}
+@trick_link_dependency{time/TimeStragglerMonitor.cpp}
 @trick_link_dependency{time/TrickThreadCoordinator.cpp}
+@trick_link_dependency{utils/FrameProfiler.cpp}
 @trick_link_dependency{utils/MutexLock.cpp}
 @trick_link_dependency{utils/MutexProtection.cpp}
 @trick_link_dependency{utils/SleepTimeout.cpp}
+@trick_link_dependency{utils/StartupProfiler.cpp}
+@trick_link_dependency{utils/UpdateLatencyStats.cpp}
 @trick_link_dependency{utils/Utilities.cpp}
 
 @revs_title
@@ -45,6 +49,7 @@ NASA, Johnson Space Center\n
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <map>
 #include <ostream>
 #include <set>
 #include <sstream>
@@ -73,9 +78,13 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/SaveRestoreServices.hh"
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/time/TimeManagementServices.hh"
+#include "TrickHLA/time/TimeStragglerMonitor.hh"
+#include "TrickHLA/utils/FrameProfiler.hh"
 #include "TrickHLA/utils/MutexProtection.hh"
 #include "TrickHLA/utils/SleepTimeout.hh"
+#include "TrickHLA/utils/StartupProfiler.hh"
 #include "TrickHLA/utils/StringUtilities.hh"
+#include "TrickHLA/utils/UpdateLatencyStats.hh"
 #include "TrickHLA/utils/Utilities.hh"
 
 #if defined( IEEE_1516_2025 )
@@ -142,6 +151,10 @@ Federate::Federate()
      debug_level( TrickHLA::DEBUG_LEVEL_NO_TRACE ),
      code_section( TrickHLA::DEBUG_SOURCE_ALL_MODULES ),
      wait_status_time( 30.0 ),
+     startup_profile( false ),
+     startup_profile_file(),
+     frame_profiler(),
+     time_straggler_monitor(),
      can_rejoin_federation( false ),
      freeze_delay_frames( 2 ),
      unfreeze_after_save( false ),
@@ -383,6 +396,21 @@ void Federate::initialize()
       this->type = name;
    }
 
+   // Start recording the startup phases now that we know the federate name.
+   if ( startup_profile ) {
+      if ( startup_profile_file.empty() ) {
+         this->startup_profile_file = name + "_startup_trace.json";
+      }
+      StartupProfiler::start( name, startup_profile_file );
+   }
+   StartupProfilerScope profile_scope( "Federate::initialize", "phase" );
+
+   // Allocate the rolling window of the frame profiler if enabled.
+   frame_profiler.initialize();
+
+   // Verify the time straggler monitor configuration if enabled.
+   time_straggler_monitor.initialize( this );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
       message_publish( MSG_NORMAL, "Federate::initialize():%d Federate:\"%s\" Type:\"%s\"\n",
                        __LINE__, name.c_str(), type.c_str() );
@@ -503,6 +531,8 @@ void Federate::restart_initialization()
  */
 void Federate::pre_multiphase_initialization()
 {
+   StartupProfilerScope profile_scope( "Federate::pre_multiphase_initialization", "phase" );
+
    // The P1 ("initialization") federate.initialize_thread_state( data_cycle_time );
    // job should be called before this one, but verify the HLA cycle time
    // again to catch the case where a user did not pick up the changes to
@@ -544,8 +574,15 @@ void Federate::pre_multiphase_initialization()
  */
 void Federate::post_multiphase_initialization()
 {
-   // Perform the Execution Control specific post-multi-phase initialization.
-   execution_control->post_multi_phase_init_processes();
+   {
+      StartupProfilerScope profile_scope( "Federate::post_multiphase_initialization", "phase" );
+
+      // Perform the Execution Control specific post-multi-phase initialization.
+      execution_control->post_multi_phase_init_processes();
+   }
+
+   // The startup is complete, so write the startup trace.
+   StartupProfiler::finish();
 
    // Debug printout.
    if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
@@ -562,6 +599,8 @@ void Federate::post_multiphase_initialization()
  */
 void Federate::create_RTI_ambassador_and_connect()
 {
+   StartupProfilerScope profile_scope( "Federate::create_RTI_ambassador_and_connect", "rti" );
+
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
@@ -949,6 +988,9 @@ void Federate::set_MOM_HLAfederate_instance_attributes(
    ObjectInstanceHandle const    &id,
    AttributeHandleValueMap const &values )
 {
+   // Save any time attributes subscribed to by the time straggler monitor.
+   time_straggler_monitor.reflect_MOM_time_attributes( id, values );
+
    // Concurrency critical code section because joined-federate state used by
    // the blocking Federate::wait_for_required_federates_to_join() function.
    //
@@ -1348,6 +1390,8 @@ bool Federate::is_joined_federate(
  */
 string Federate::wait_for_required_federates_to_join()
 {
+   StartupProfilerScope profile_scope( "Federate::wait_for_required_federates_to_join", "wait" );
+
    string status_string;
 
    // If the known Federates list is disabled then just return.
@@ -2474,6 +2518,9 @@ void Federate::exit_freeze()
    execution_control->exit_freeze();
 
    execution_control->set_freeze_pending( false );
+
+   // Do not let the frame that spans the freeze skew the frame profile.
+   frame_profiler.discard_frame();
 }
 
 /*!
@@ -2565,6 +2612,8 @@ void Federate::perform_restore()
  */
 void Federate::create_federation()
 {
+   StartupProfilerScope profile_scope( "Federate::create_federation", "rti" );
+
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
@@ -2742,6 +2791,8 @@ void Federate::join_federation(
    string const &federate_name,
    string const &federate_type )
 {
+   StartupProfilerScope profile_scope( "Federate::join_federation", "rti" );
+
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
@@ -3009,6 +3060,8 @@ void Federate::create_and_join_federation()
  */
 void Federate::enable_async_delivery()
 {
+   StartupProfilerScope profile_scope( "Federate::enable_async_delivery", "rti" );
+
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
@@ -3397,39 +3450,79 @@ void Federate::shutdown()
       message_publish( MSG_NORMAL, "Federate::shutdown():%d\n", __LINE__ );
    }
 
-#if defined( TRICKHLA_COLLECT_TAG_STATS )
-   double const  tag_wait_time     = (double)tag_wait_sum / exec_get_time_tic_value();
-   double const  avg_tag_wait_time = ( tag_wait_count != 0 )
-                                        ? ( tag_wait_time / tag_wait_count )
-                                        : tag_wait_time;
-   ostringstream tag_msg;
-   tag_msg << "Federate::shutdown():" << __LINE__ << endl
-           << "Total # waits for TAG:" << tag_wait_count << endl
-           << "  Total TAG wait time:" << tag_wait_time << " seconds" << endl
-           << "Average TAG wait time:" << avg_tag_wait_time << " seconds" << endl;
-   message_publish( MSG_INFO, tag_msg.str().c_str() );
-#endif // TRICKHLA_COLLECT_TAG_STATS
-
-#ifdef TRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS
-   for ( int i = 0; i < manager->obj_count; ++i ) {
-      ostringstream msg1;
-      msg1 << "Federate::shutdown():" << __LINE__
-           << " Object[" << i << "]:'" << manager->objects[i].get_name() << "'"
-           << " send_count:" << manager->objects[i].send_count
-           << " receive_count:" << manager->objects[i].receive_count << endl;
-      message_publish( MSG_INFO, msg1.str().c_str() );
-   }
-#endif // TRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS
-
-#ifdef TRICKHLA_CYCLIC_READ_TIME_STATS
-   for ( int i = 0; i < manager->obj_count; ++i ) {
+   // Write the startup trace if the startup never completed.
+   StartupProfiler::finish();
+
+   // Report the final frame profile statistics.
+   if ( frame_profiler.is_enabled() ) {
+      frame_profiler.shutdown();
+      message_publish( MSG_NORMAL, "%s", frame_profiler.to_string().c_str() );
+   }
+
+   if ( TAG_wait_stats_enabled ) {
+      ostringstream tag_msg;
+      tag_msg << "Federate::shutdown():" << __LINE__ << " TAG wait time:" << endl
+              << TAG_wait_stats.to_string( "milliseconds", 0.001 ) << endl;
+      message_publish( MSG_INFO, tag_msg.str().c_str() );
+   }
+
+   // Report which federates held back our time advancement.
+   if ( time_straggler_monitor.is_enabled() ) {
+      message_publish( MSG_INFO, "%s", time_straggler_monitor.to_string().c_str() );
+   }
+
+   // Report the top bandwidth consumers and close any traffic log.
+   if ( manager != NULL ) {
+      manager->report_traffic();
+      manager->traffic_recorder.shutdown();
+      manager->traffic_replay.shutdown();
+   }
+
+   // Report the cyclic read time statistics of the objects that measure them.
+   for ( int i = 0; ( manager != NULL ) && ( i < manager->obj_count ); ++i ) {
+      if ( !manager->objects[i].elapsed_time_stats.is_enabled() ) {
+         continue;
+      }
       ostringstream msg2;
       msg2 << "Federate::shutdown():" << __LINE__
            << " Object[" << i << "]:'" << manager->objects[i].get_name() << "' "
            << manager->objects[i].elapsed_time_stats.to_string() << endl;
       message_publish( MSG_INFO, msg2.str().c_str() );
    }
-#endif // TRICKHLA_CYCLIC_READ_TIME_STATS
+
+   // Report the update latency statistics of the objects that measure them,
+   // for each object and merged for each object class.
+   if ( manager != NULL ) {
+      UpdateLatencyStats::add_peer_name( get_federate_name() );
+      for ( int i = 0; i < known_feds_count; ++i ) {
+         UpdateLatencyStats::add_peer_name( known_feds[i].name );
+      }
+
+      map< string, UpdateLatencyStats > class_latency;
+      for ( int i = 0; i < manager->obj_count; ++i ) {
+         if ( !manager->objects[i].update_latency.is_enabled() ) {
+            continue;
+         }
+         class_latency[manager->objects[i].get_FOM_name()].merge( manager->objects[i].update_latency );
+
+         ostringstream msg3;
+         msg3 << "Federate::shutdown():" << __LINE__
+              << " Object[" << i << "]:'" << manager->objects[i].get_name() << "'"
+              << " update latency:" << endl
+              << manager->objects[i].update_latency.to_string();
+         message_publish( MSG_INFO, msg3.str().c_str() );
+      }
+
+      map< string, UpdateLatencyStats >::const_iterator class_iter;
+      for ( class_iter = class_latency.begin(); class_iter != class_latency.end(); ++class_iter ) {
+         ostringstream msg4;
+         msg4 << "Federate::shutdown():" << __LINE__
+              << " Object class:'" << class_iter->first << "'"
+              << " update latency:" << endl
+              << class_iter->second.to_string();
+         message_publish( MSG_INFO, msg4.str().c_str() );
+      }
+   }
 
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
@@ -4179,6 +4272,7 @@ void Federate::remove_MOM_HLAfederate_instance_id(
 {
    remove_federate_instance_id( instance_hndl );
    remove_MOM_HLAfederation_instance_id( instance_hndl );
+   time_straggler_monitor.remove_federate( instance_hndl );
 
    string tMOMName  = "";
    string tFedName  = "";
@@ -4313,6 +4407,12 @@ bool Federate::is_federate_executing() const
    return this->execution_has_begun;
 }
 
+bool Federate::is_MOM_HLAfederate_instance_id(
+   ObjectInstanceHandle const &instance_hndl )
+{
+   return ( MOM_HLAfederate_instance_name_map.find( instance_hndl ) != MOM_HLAfederate_instance_name_map.end() );
+}
+
 bool Federate::is_MOM_HLAfederation_instance_id(
    ObjectInstanceHandle const &instance_hndl )
 {
@@ -4501,6 +4601,10 @@ void Federate::restore_federate_handles_from_MOM()
 
    fedMomAttributes.clear();
    requestedAttributes.clear();
+
+   // The MOM handles may have changed so the time straggler monitor needs to
+   // subscribe again.
+   time_straggler_monitor.reset();
 }
 
 void Federate::rebuild_federate_handles(
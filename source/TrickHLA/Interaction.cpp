@@ -29,6 +29,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{time/Int64Time.cpp}
 @trick_link_dependency{utils/MutexLock.cpp}
 @trick_link_dependency{utils/MutexProtection.cpp}
+@trick_link_dependency{utils/TrafficCounters.cpp}
 
 @revs_title
 @revs_begin
@@ -67,6 +68,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/time/Int64BaseTime.hh"
 #include "TrickHLA/utils/MutexProtection.hh"
 #include "TrickHLA/utils/StringUtilities.hh"
+#include "TrickHLA/utils/TrafficCounters.hh"
 #include "TrickHLA/utils/Utilities.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
@@ -103,6 +105,7 @@ Interaction::Interaction()
      param_count( 0 ),
      parameters( NULL ),
      handler( NULL ),
+     traffic(),
      mutex(),
      changed( false ),
      received_as_TSO( false ),
@@ -956,6 +959,7 @@ bool Interaction::send(
                                    param_values_map,
                                    the_user_supplied_tag );
          successfuly_sent = true;
+         count_sent( param_values_map );
       }
    } catch ( RTI1516_NAMESPACE::Exception const &e ) {
       string rti_err_msg;
@@ -1049,6 +1053,7 @@ bool Interaction::send(
                                       the_user_supplied_tag,
                                       time.get() );
             successfuly_sent = true;
+            count_sent( param_values_map );
 
          } else {
             if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_INTERACTION ) ) {
@@ -1064,6 +1069,7 @@ Interaction '%s' is time-regulating:%s, preferred-order:%s.\n",
                                       param_values_map,
                                       the_user_supplied_tag );
             successfuly_sent = true;
+            count_sent( param_values_map );
          }
       }
    } catch ( RTI1516_NAMESPACE::InvalidLogicalTime const &e ) {
@@ -1221,6 +1227,34 @@ bool Interaction::decode(
    return any_param_received;
 }
 
+/*!
+ * @job_class{scheduled}
+ */
+void Interaction::count_received(
+   ParameterHandleValueMap const &param_values )
+{
+   uint64_t bytes = 0;
+   ParameterHandleValueMap::const_iterator iter;
+   for ( iter = param_values.begin(); iter != param_values.end(); ++iter ) {
+      bytes += iter->second.size();
+   }
+   traffic.add_received( param_values.size(), bytes );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void Interaction::count_sent(
+   ParameterHandleValueMap const &param_values )
+{
+   uint64_t bytes = 0;
+   ParameterHandleValueMap::const_iterator iter;
+   for ( iter = param_values.begin(); iter != param_values.end(); ++iter ) {
+      bytes += iter->second.size();
+   }
+   traffic.add_sent( param_values.size(), bytes );
+}
+
 Parameter *Interaction::get_parameter(
    string const &inter_FOM_name )
 {
@@ -28,6 +28,7 @@ NASA, Johnson Space Center\n
 
 // System includes.
 #include <cstddef>
+#include <cstdint>
 
 // TrickHLA includes.
 #include "TrickHLA/Item.hh"
@@ -38,7 +39,8 @@ using namespace TrickHLA;
  * @job_class{initialization}
  */
 Item::Item() // RETURN: -- None.
-   : next( NULL )
+   : next( NULL ),
+     push_time( 0 )
 {
    return;
 }
@@ -19,6 +19,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{ItemQueue.cpp}
 @trick_link_dependency{utils/MutexLock.cpp}
 @trick_link_dependency{utils/MutexProtection.cpp}
+@trick_link_dependency{utils/QueueStats.cpp}
 
 @revs_title
 @revs_begin
@@ -32,6 +33,7 @@ NASA, Johnson Space Center\n
 
 // System includes.
 #include <cstddef>
+#include <cstdint>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -44,6 +46,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Item.hh"
 #include "TrickHLA/ItemQueue.hh"
 #include "TrickHLA/utils/MutexProtection.hh"
+#include "TrickHLA/utils/QueueStats.hh"
 
 using namespace std;
 using namespace TrickHLA;
@@ -55,7 +58,8 @@ ItemQueue::ItemQueue()
    : mutex(),
      count( 0 ),
      head( NULL ),
-     tail( NULL )
+     tail( NULL ),
+     stats( NULL )
 {
    return;
 }
@@ -140,6 +144,12 @@ void ItemQueue::pop()
 
       // Make sure we delete the Item we created when it was pushed on the queue.
       delete item;
+
+      if ( stats != NULL ) {
+         stats->record_depth( count,
+                              ( ( head != NULL ) ? head->push_time : 0 ),
+                              QueueStats::monotonic_time() );
+      }
    }
 }
 
@@ -164,6 +174,22 @@ void ItemQueue::push( // RETURN: -- None.
    }
    tail = item;
    ++count;
+
+   if ( stats != NULL ) {
+      item->push_time = QueueStats::monotonic_time();
+      stats->record_depth( count, head->push_time, item->push_time );
+   }
+}
+
+/*!
+ * @brief Set the statistics to track the depth and backlog of the queue.
+ * @param queue_stats The statistics, or NULL to not track them.
+ */
+void ItemQueue::set_stats(
+   QueueStats *queue_stats )
+{
+   MutexProtection auto_unlock_mutex( &mutex );
+   this->stats = queue_stats;
 }
 
 /*!
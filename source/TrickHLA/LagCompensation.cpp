@@ -17,6 +17,7 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{DebugHandler.cpp}
 @trick_link_dependency{LagCompensation.cpp}
+@trick_link_dependency{LagCompensationBatch.cpp}
 @trick_link_dependency{ObjectCallbackBase.cpp}
 
 @revs_title
@@ -26,6 +27,7 @@ NASA, Johnson Space Center\n
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, March 2019, --, Version 3 rewrite.}
 @rev_entry{Dan Dexter, NASA ER6, TrickHLA, October 2023, --, Added lag-comp bypass functions.}
 @rev_entry{Dan Dexter, NASA ER6, TrickHLA, September 2025, --, Extends ObjectCallbackBase.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Added batched lag compensation.}
 @revs_end
 
 */
@@ -38,6 +40,7 @@ NASA, Johnson Space Center\n
 // TrickHLA includes.
 #include "TrickHLA/DebugHandler.hh"
 #include "TrickHLA/LagCompensation.hh"
+#include "TrickHLA/LagCompensationBatch.hh"
 #include "TrickHLA/ObjectCallbackBase.hh"
 
 using namespace std;
@@ -47,7 +50,8 @@ using namespace TrickHLA;
  * @job_class{initialization}
  */
 LagCompensation::LagCompensation()
-   : TrickHLA::ObjectCallbackBase()
+   : TrickHLA::ObjectCallbackBase(),
+     batch( NULL )
 {
    return;
 }
@@ -57,7 +61,8 @@ LagCompensation::LagCompensation()
  */
 LagCompensation::LagCompensation(
    string name ) // cppcheck-suppress [passedByValue]
-   : TrickHLA::ObjectCallbackBase( name )
+   : TrickHLA::ObjectCallbackBase( name ),
+     batch( NULL )
 {
    return;
 }
@@ -93,3 +98,29 @@ void LagCompensation::receive_lag_compensation()
           << " the 'virtual void receive_lag_compensation()' function!" << endl;
    DebugHandler::terminate_with_message( errmsg.str() );
 }
+
+/*!
+ * @job_class{initialization}
+ */
+void LagCompensation::set_batch(
+   LagCompensationBatch *lag_comp_batch )
+{
+   if ( ( lag_comp_batch != NULL ) && !lag_comp_batch->is_supported( this ) ) {
+      ostringstream errmsg;
+      errmsg << "LagCompensation::set_batch():" << __LINE__
+             << " ERROR: The batched lag compensation stage does not support"
+             << " the lag compensation type of '" << get_callback_name() << "'."
+             << " Please check your input or modified-data files to make sure"
+             << " only supported lag compensation instances use the batch." << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   this->batch = lag_comp_batch;
+}
+
+/*!
+ * @brief Receive side lag compensation callback for a frame without new data.
+ */
+void LagCompensation::idle_receive_lag_compensation()
+{
+   return;
+}
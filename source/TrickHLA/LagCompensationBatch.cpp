@@ -0,0 +1,47 @@
+/*!
+@file TrickHLA/LagCompensationBatch.cpp
+@ingroup TrickHLA
+@brief This class is the abstract base class for a TrickHLA batched lag
+compensation stage.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{LagCompensationBatch.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial version.}
+@revs_end
+
+*/
+
+// TrickHLA includes.
+#include "TrickHLA/LagCompensationBatch.hh"
+
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+LagCompensationBatch::LagCompensationBatch()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+LagCompensationBatch::~LagCompensationBatch()
+{
+   return;
+}
@@ -22,6 +22,7 @@ NASA, Johnson Space Center\n
 @revs_title
 @revs_begin
 @rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, November 2023, --, Initial version.}
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Added adaptive step Dormand-Prince integration.}
 @revs_end
 
 */
@@ -31,6 +32,7 @@ NASA, Johnson Space Center\n
 #include <cstddef>
 #include <ostream>
 #include <sstream>
+#include <vector>
 
 // Trick includes.
 #include "trick/Integrator.hh"
@@ -47,11 +49,48 @@ NASA, Johnson Space Center\n
 using namespace std;
 using namespace TrickHLA;
 
+namespace
+{
+
+// Dormand-Prince 5(4) Butcher tableau. The seventh stage is evaluated at the
+// fifth order solution and is only used for the embedded error estimate. The
+// lag compensation derivatives do not depend explicitly on time; so, the
+// stage time nodes are not needed.
+double const DP_A[7][6] = {
+   { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+   { 1.0 / 5.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+   { 3.0 / 40.0, 9.0 / 40.0, 0.0, 0.0, 0.0, 0.0 },
+   { 44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0, 0.0, 0.0, 0.0 },
+   { 19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0, 0.0, 0.0 },
+   { 9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0, 0.0 },
+   { 35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0 }
+};
+
+// Difference between the fifth and fourth order solution weights.
+double const DP_E[7] = { 71.0 / 57600.0, 0.0, -71.0 / 16695.0, 71.0 / 1920.0,
+                         -17253.0 / 339200.0, 22.0 / 525.0, -1.0 / 40.0 };
+
+// Step size controller safety factor and growth limits.
+double const DP_SAFETY     = 0.9;
+double const DP_MIN_FACTOR = 0.2;
+double const DP_MAX_FACTOR = 5.0;
+
+} // namespace
+
 /*!
  * @job_class{initialization}
  */
 LagCompensationInteg::LagCompensationInteg()
-   : integrator( NULL )
+   : integrator( NULL ),
+     adaptive_step( false ),
+     integ_dt_min( 1.0e-9 ),
+     integ_dt_next( 0.0 ),
+     step_count( 0 ),
+     rejected_step_count( 0 ),
+     step_count_total( 0 ),
+     rejected_step_count_total( 0 ),
+     adapt_state(),
+     adapt_state_5()
 {
    return;
 }
@@ -70,6 +109,19 @@ LagCompensationInteg::~LagCompensationInteg()
 int LagCompensationInteg::integrate(
    double const t_begin,
    double const t_end )
+{
+   if ( this->adaptive_step ) {
+      return ( integrate_adaptive_step( t_begin, t_end ) );
+   }
+   return ( integrate_fixed_step( t_begin, t_end ) );
+}
+
+/*!
+ * @job_class{integration}
+ */
+int LagCompensationInteg::integrate_fixed_step(
+   double const t_begin,
+   double const t_end )
 {
    int    ipass;
    double compensate_dt = t_end - t_begin;
@@ -79,7 +131,7 @@ int LagCompensationInteg::integrate(
    // on and off from a setting in the input file.
    if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
       ostringstream msg;
-      msg << "LagCompensationInteg::integrate(): " << __LINE__
+      msg << "LagCompensationInteg::integrate_fixed_step(): " << __LINE__
           << " Compensate: t_begin, t_end, dt_go: "
           << t_begin << ", " << t_end << ", " << dt_go << endl;
       message_publish( MSG_NORMAL, msg.str().c_str() );
@@ -89,6 +141,7 @@ int LagCompensationInteg::integrate(
    // Set the current integration time for the integrator.
    this->integ_t          = t_begin;
    this->integrator->time = 0.0;
+   this->step_count       = 0;
 
    // Loop through integrating the state forward to the current scenario time.
    while ( ( dt_go >= 0.0 ) && ( fabs( dt_go ) > this->integ_tol ) ) {
@@ -97,7 +150,7 @@ int LagCompensationInteg::integrate(
       // on and off from a setting in the input file.
       if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
          ostringstream msg;
-         msg << "LagCompensationInteg::integrate(): " << __LINE__
+         msg << "LagCompensationInteg::integrate_fixed_step(): " << __LINE__
              << "Integ dt, tol, t, dt_go: "
              << this->integ_dt << ", " << this->integ_tol << ", "
              << integ_t << ", " << dt_go << endl;
@@ -129,6 +182,7 @@ int LagCompensationInteg::integrate(
 
          // Unload the integrated states.
          unload();
+         normalize_state();
 
       } while ( ipass );
 
@@ -137,6 +191,172 @@ int LagCompensationInteg::integrate(
 
       // Compute the remaining time in the compensation step.
       dt_go = compensate_dt - this->integrator->time;
+
+      ++( this->step_count );
+   }
+
+   this->step_count_total += this->step_count;
+
+   // Update the lag compensated time,
+   update_time();
+
+   // Compute the derivatives of the lag compensation state vector.
+   derivative_first();
+
+   return ( 0 );
+}
+
+/*!
+ * @job_class{integration}
+ */
+int LagCompensationInteg::integrate_adaptive_step(
+   double const t_begin,
+   double const t_end )
+{
+   double const compensate_dt = t_end - t_begin;
+   double       t_elapsed     = 0.0;
+   unsigned int num_state     = ( this->integrator->num_state > 0 ) ? this->integrator->num_state : 0;
+
+   // Use the inherited debug-handler to allow debug comments to be turned
+   // on and off from a setting in the input file.
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
+      ostringstream msg;
+      msg << "LagCompensationInteg::integrate_adaptive_step(): " << __LINE__
+          << " Compensate: t_begin, t_end, dt_go: "
+          << t_begin << ", " << t_end << ", " << compensate_dt << endl;
+      message_publish( MSG_NORMAL, msg.str().c_str() );
+   }
+
+   // Size the work arrays to the integrator state.
+   if ( this->adapt_state.size() != num_state ) {
+      this->adapt_state.resize( num_state );
+      this->adapt_state_5.resize( num_state );
+      for ( int k = 0; k < 7; ++k ) {
+         this->adapt_deriv[k].resize( num_state );
+      }
+   }
+
+   // Start with the step size the last compensation ended with, which for
+   // a steady data rate is a good guess for this compensation too.
+   double dt_step = ( this->integ_dt_next > 0.0 ) ? this->integ_dt_next : this->integ_dt;
+
+   // The state derivatives are always passed through the first
+   // derivative buffer of the integrator.
+   this->integrator->intermediate_step = 0;
+   this->integ_t                       = t_begin;
+   this->step_count                    = 0;
+   this->rejected_step_count           = 0;
+
+   // Load the initial state and its derivative.
+   derivative_first();
+   load();
+   for ( unsigned int i = 0; i < num_state; ++i ) {
+      this->adapt_state[i]    = this->integrator->state[i];
+      this->adapt_deriv[0][i] = this->integrator->deriv[0][i];
+   }
+
+   // Loop through integrating the state forward to the current scenario time.
+   while ( compensate_dt - t_elapsed > 0.0 ) {
+
+      double const dt_go = compensate_dt - t_elapsed;
+
+      // Stretch the last step to the end of the compensation interval
+      // instead of leaving a sliver of a step.
+      bool   last_step = false;
+      double h         = dt_step;
+      if ( h >= ( dt_go - this->integ_dt_min ) ) {
+         h         = dt_go;
+         last_step = true;
+      }
+
+      // Evaluate the stages. The last stage state is the fifth order solution.
+      for ( int k = 1; k < 7; ++k ) {
+         for ( unsigned int i = 0; i < num_state; ++i ) {
+            double sum = 0.0;
+            for ( int j = 0; j < k; ++j ) {
+               sum += DP_A[k][j] * this->adapt_deriv[j][i];
+            }
+            this->adapt_state_5[i] = this->adapt_state[i] + ( h * sum );
+         }
+         adaptive_derivative( this->adapt_state_5, this->adapt_deriv[k] );
+      }
+
+      // Scaled local error estimate using a mixed absolute and relative
+      // error tolerance.
+      double error = 0.0;
+      for ( unsigned int i = 0; i < num_state; ++i ) {
+         double err_i = 0.0;
+         for ( int k = 0; k < 7; ++k ) {
+            err_i += DP_E[k] * this->adapt_deriv[k][i];
+         }
+         double const scale = this->integ_tol
+                              * ( 1.0 + fmax( fabs( this->adapt_state[i] ), fabs( this->adapt_state_5[i] ) ) );
+         double const ratio = fabs( h * err_i ) / scale;
+         if ( !( ratio <= error ) ) {
+            error = ratio;
+         }
+      }
+
+      if ( ( error <= 1.0 ) || ( h <= this->integ_dt_min ) ) {
+
+         // Accept the step.
+         t_elapsed += h;
+         this->integ_t = t_begin + t_elapsed;
+         ++( this->step_count );
+
+         // Unload and normalize the accepted state and start the next step
+         // from it.
+         for ( unsigned int i = 0; i < num_state; ++i ) {
+            this->integrator->state[i] = this->adapt_state_5[i];
+         }
+         unload();
+         normalize_state();
+         derivative_first();
+         load();
+         for ( unsigned int i = 0; i < num_state; ++i ) {
+            this->adapt_state[i]    = this->integrator->state[i];
+            this->adapt_deriv[0][i] = this->integrator->deriv[0][i];
+         }
+
+         double factor = ( error > 0.0 ) ? ( DP_SAFETY * pow( error, -0.2 ) ) : DP_MAX_FACTOR;
+         factor        = fmin( DP_MAX_FACTOR, fmax( DP_MIN_FACTOR, factor ) );
+
+         // A shortened last step says little about the step size the
+         // dynamics allow, so do not let it shrink the next step.
+         if ( !last_step || ( ( h * factor ) > dt_step ) ) {
+            dt_step = h * factor;
+         }
+      } else {
+
+         // Reject the step and retry with a smaller step size.
+         ++( this->rejected_step_count );
+
+         double const factor = fmax( DP_MIN_FACTOR, DP_SAFETY * pow( error, -0.2 ) );
+         dt_step             = fmax( h * factor, this->integ_dt_min );
+      }
+
+      // Use the inherited debug-handler to allow debug comments to be turned
+      // on and off from a setting in the input file.
+      if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
+         ostringstream msg;
+         msg << "LagCompensationInteg::integrate_adaptive_step(): " << __LINE__
+             << " Integ h, error, t, next dt: "
+             << h << ", " << error << ", " << this->integ_t << ", " << dt_step << endl;
+         message_publish( MSG_NORMAL, msg.str().c_str() );
+      }
+   }
+
+   this->integ_dt_next = dt_step;
+   this->step_count_total += this->step_count;
+   this->rejected_step_count_total += this->rejected_step_count;
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_LAG_COMPENSATION ) ) {
+      ostringstream msg;
+      msg << "LagCompensationInteg::integrate_adaptive_step(): " << __LINE__
+          << " Steps, rejected steps, next dt: "
+          << this->step_count << ", " << this->rejected_step_count << ", "
+          << this->integ_dt_next << endl;
+      message_publish( MSG_NORMAL, msg.str().c_str() );
    }
 
    // Update the lag compensated time,
@@ -147,3 +367,29 @@ int LagCompensationInteg::integrate(
 
    return ( 0 );
 }
+
+/*!
+ * @job_class{integration}
+ */
+void LagCompensationInteg::adaptive_derivative(
+   vector< double > const &state,
+   vector< double >       &deriv )
+{
+   unsigned int const num_state = state.size();
+
+   // Unload the stage state without normalizing it, since normalizing an
+   // intermediate stage would degrade the order of the method.
+   for ( unsigned int i = 0; i < num_state; ++i ) {
+      this->integrator->state[i] = state[i];
+   }
+   unload();
+
+   // Compute and load the derivatives of the stage state.
+   derivative_first();
+   load();
+   for ( unsigned int i = 0; i < num_state; ++i ) {
+      deriv[i] = this->integrator->deriv[0][i];
+   }
+
+   return;
+}
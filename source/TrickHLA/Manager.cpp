@@ -24,15 +24,23 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{InteractionItem.cpp}
 @trick_link_dependency{Manager.cpp}
 @trick_link_dependency{Object.cpp}
+@trick_link_dependency{ObjectPool.cpp}
 @trick_link_dependency{Parameter.cpp}
 @trick_link_dependency{ParameterItem.cpp}
+@trick_link_dependency{TrafficRecorder.cpp}
+@trick_link_dependency{TrafficReplay.cpp}
 @trick_link_dependency{Types.cpp}
+@trick_link_dependency{encoding/EncoderFactory.cpp}
 @trick_link_dependency{time/Int64BaseTime.cpp}
 @trick_link_dependency{time/Int64Interval.cpp}
 @trick_link_dependency{time/Int64Time.cpp}
+@trick_link_dependency{utils/FrameProfiler.cpp}
 @trick_link_dependency{utils/MutexLock.cpp}
 @trick_link_dependency{utils/MutexProtection.cpp}
+@trick_link_dependency{utils/QueueStats.cpp}
 @trick_link_dependency{utils/SleepTimeout.cpp}
+@trick_link_dependency{utils/StartupProfiler.cpp}
+@trick_link_dependency{utils/TrafficCounters.cpp}
 
 @revs_title
 @revs_begin
@@ -45,13 +53,20 @@ NASA, Johnson Space Center\n
 */
 
 // System includes.
+#include <algorithm>
 #include <climits>
 #include <cstdint>
 #include <cstring>
+#include <iomanip>
 #include <map>
 #include <ostream>
+#include <set>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 // Trick includes.
 #include "trick/MemoryManager.hh"
@@ -69,16 +84,25 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/HLAStandardSupport.hh"
 #include "TrickHLA/Interaction.hh"
 #include "TrickHLA/InteractionItem.hh"
+#include "TrickHLA/LagCompensation.hh"
+#include "TrickHLA/LagCompensationBatch.hh"
 #include "TrickHLA/Manager.hh"
+#include "TrickHLA/ObjectPool.hh"
 #include "TrickHLA/Parameter.hh"
 #include "TrickHLA/ParameterItem.hh"
 #include "TrickHLA/Types.hh"
+#include "TrickHLA/encoding/EncoderFactory.hh"
 #include "TrickHLA/time/Int64BaseTime.hh"
 #include "TrickHLA/time/Int64Interval.hh"
 #include "TrickHLA/time/Int64Time.hh"
+#include "TrickHLA/utils/CountdownLatch.hh"
+#include "TrickHLA/utils/FrameProfiler.hh"
 #include "TrickHLA/utils/MutexProtection.hh"
+#include "TrickHLA/utils/QueueStats.hh"
 #include "TrickHLA/utils/SleepTimeout.hh"
+#include "TrickHLA/utils/StartupProfiler.hh"
 #include "TrickHLA/utils/StringUtilities.hh"
+#include "TrickHLA/utils/TrafficCounters.hh"
 #include "TrickHLA/utils/Utilities.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
@@ -104,26 +128,99 @@ using namespace RTI1516_NAMESPACE;
 using namespace std;
 using namespace TrickHLA;
 
+namespace
+{
+
+typedef pair< string, TrafficCounters const * > TrafficSource;
+
+// Order the traffic sources by decreasing total bytes.
+bool more_traffic(
+   TrafficSource const &a,
+   TrafficSource const &b )
+{
+   return ( a.second->get_total_bytes() > b.second->get_total_bytes() );
+}
+
+// Add an object to the object traffic sources and its attributes to the
+// attribute traffic sources, which are kept apart since the object counts
+// already include the bytes of its attributes.
+void add_object_traffic(
+   vector< TrafficSource > &object_sources,
+   vector< TrafficSource > &attribute_sources,
+   Object                  &obj )
+{
+   object_sources.push_back( TrafficSource( "Object '" + obj.get_name() + "'", &obj.traffic ) );
+
+   Attribute const *attrs = obj.get_attributes();
+   for ( int i = 0; i < obj.get_attribute_count(); ++i ) {
+      attribute_sources.push_back( TrafficSource( "Attribute '" + obj.get_name() + "." + attrs[i].get_FOM_name() + "'",
+                                                  &attrs[i].traffic ) );
+   }
+}
+
+// Add the top traffic sources of one kind to the traffic report.
+void report_top_traffic(
+   ostringstream           &msg,
+   string const            &kind,
+   vector< TrafficSource > &sources,
+   size_t const             max_count )
+{
+   if ( sources.empty() ) {
+      return;
+   }
+
+   size_t const count = ( sources.size() < max_count ) ? sources.size() : max_count;
+   partial_sort( sources.begin(), sources.begin() + count, sources.end(), more_traffic );
+
+   msg << " Top " << count << " of " << sources.size() << " " << kind
+       << " by encoded bytes:" << endl;
+   for ( size_t i = 0; i < count; ++i ) {
+      msg << setw( 4 ) << ( i + 1 ) << ". " << sources[i].first << " "
+          << sources[i].second->to_string() << endl;
+   }
+}
+
+} // namespace
+
 /*!
  * @job_class{initialization}
  */
 Manager::Manager()
    : obj_count( 0 ),
      objects( NULL ),
+     pool_count( 0 ),
+     object_pools( NULL ),
      inter_count( 0 ),
      interactions( NULL ),
+     traffic_report_count( 10 ),
+     traffic_recorder(),
+     traffic_replay(),
+     interactions_queue_stats(),
      interactions_queue(),
      check_interactions_count( 0 ),
      check_interactions( NULL ),
      rejoining_federate( false ),
      mgr_initialized( false ),
      obj_discovery_mutex(),
+     name_reservation_latch(),
+     required_objects_latch(),
+     obj_pipeline_start_time( 0 ),
+     obj_ready_times(),
      object_map(),
      obj_name_index_map(),
+     obj_class_name_index(),
+     unbound_remote_objs(),
+     obj_pool_class_map(),
+     obj_class_handle_cache(),
+     attr_handle_cache(),
+     inter_class_handle_cache(),
+     param_handle_cache(),
+     lag_comp_batches(),
      federate( NULL ),
      execution_control( NULL )
 {
-   return;
+   interactions_queue_stats.set_name( "Manager received interactions" );
+   interactions_queue.set_stats( &interactions_queue_stats );
 }
 
 /*!
@@ -134,6 +231,12 @@ Manager::~Manager()
 {
    object_map.clear();
    obj_name_index_map.clear();
+   obj_class_name_index.clear();
+   unbound_remote_objs.clear();
+   obj_pool_class_map.clear();
+   obj_ready_times.clear();
+   clear_RTI_handle_cache();
+   lag_comp_batches.clear();
    free_converted_interactions_checkpoint();
 
    // Make sure we destroy the mutex.
@@ -164,6 +267,8 @@ void Manager::setup(
  */
 void Manager::initialize()
 {
+   StartupProfilerScope profile_scope( "Manager::initialize", "phase" );
+
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 
    // Just return if the TrickHLA Manager is already initialized.
@@ -197,6 +302,10 @@ void Manager::initialize()
       return;
    }
 
+   // Start recording or replaying the received traffic if configured to.
+   traffic_recorder.initialize( this );
+   traffic_replay.initialize( this );
+
    // The manager is now initialized.
    this->mgr_initialized = true;
 
@@ -297,6 +406,9 @@ void Manager::initialize_HLA_cycle_time()
    for ( int n = 0; n < obj_count; ++n ) {
       objects[n].set_core_job_cycle_time( federate->get_HLA_cycle_time() );
    }
+   for ( int p = 0; p < pool_count; ++p ) {
+      object_pools[p].set_core_job_cycle_time( federate->get_HLA_cycle_time() );
+   }
 }
 
 /*! @brief Verify the user specified object and interaction arrays and counts. */
@@ -342,25 +454,51 @@ void Manager::verify_object_and_interaction_arrays()
       obj_count = 0;
    }
 
-   // Object instance names must be unique and can not be a duplicate.
-   for ( int n = 0; n < obj_count; ++n ) {
-      if ( !objects[n].get_name().empty() ) {
+   // Check the object pools array against the pool count.
+   if ( ( ( pool_count > 0 ) && ( object_pools == NULL ) )
+        || ( ( pool_count <= 0 ) && ( object_pools != NULL ) ) ) {
+      ostringstream errmsg;
+      errmsg << "Manager::verify_object_and_interaction_arrays():" << __LINE__
+             << " ERROR: Unexpected pool_count:" << pool_count << " for a "
+             << ( ( object_pools == NULL ) ? "NULL" : "non-NULL" )
+             << " 'object_pools' array. Please check your input or modified-data"
+             << " files to make sure the 'Manager::object_pools' array is"
+             << " correctly configured." << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
 
-         for ( int k = n + 1; k < obj_count; ++k ) {
-            if ( !objects[k].get_name().empty() ) {
+   // Reset the TrickHLA Object pool count if negative.
+   if ( pool_count < 0 ) {
+      pool_count = 0;
+   }
 
-               if ( objects[n].get_name() == objects[k].get_name() ) {
-                  ostringstream errmsg;
-                  errmsg << "Manager::verify_object_and_interaction_arrays():" << __LINE__
-                         << " ERROR: Object instance '" << objects[n].get_name()
-                         << "' at array index " << n << " has the same name as"
-                         << " object instance '" << objects[k].get_name()
-                         << "' at array index " << k << ". Please check your"
-                         << " input or modified-data files to make sure the"
-                         << " object instance names are unique with no duplicates." << endl;
-                  DebugHandler::terminate_with_message( errmsg.str() );
-                  return;
-               }
+   // Object instance names must be unique and can not be a duplicate. Use a
+   // hash map of the names to the array index to find duplicates in a single
+   // pass over the objects.
+   {
+      unordered_map< string, int > obj_name_indexes;
+      obj_name_indexes.reserve( obj_count );
+
+      for ( int k = 0; k < obj_count; ++k ) {
+         if ( !objects[k].get_name().empty() ) {
+
+            pair< unordered_map< string, int >::iterator, bool > const result =
+               obj_name_indexes.insert( make_pair( objects[k].get_name(), k ) );
+
+            if ( !result.second ) {
+               int const n = result.first->second;
+
+               ostringstream errmsg;
+               errmsg << "Manager::verify_object_and_interaction_arrays():" << __LINE__
+                      << " ERROR: Object instance '" << objects[n].get_name()
+                      << "' at array index " << n << " has the same name as"
+                      << " object instance '" << objects[k].get_name()
+                      << "' at array index " << k << ". Please check your"
+                      << " input or modified-data files to make sure the"
+                      << " object instance names are unique with no duplicates." << endl;
+               DebugHandler::terminate_with_message( errmsg.str() );
+               return;
             }
          }
       }
@@ -409,26 +547,30 @@ void Manager::verify_object_and_interaction_arrays()
    }
 
    // Interactions must be unique and can not be a duplicate for a given
-   // FOM-name. Only one interaction per FOM-name.
-   for ( int i = 0; i < inter_count; ++i ) {
-      if ( !interactions[i].get_FOM_name().empty() ) {
+   // FOM-name. Only one interaction per FOM-name. Use a hash map of the FOM
+   // names to the array index to find duplicates in a single pass.
+   unordered_map< string, int > inter_FOM_name_indexes;
+   inter_FOM_name_indexes.reserve( inter_count );
 
-         for ( int k = i + 1; k < inter_count; ++k ) {
-            if ( !interactions[k].get_FOM_name().empty() ) {
+   for ( int k = 0; k < inter_count; ++k ) {
+      if ( !interactions[k].get_FOM_name().empty() ) {
 
-               if ( interactions[i].get_FOM_name() == interactions[k].get_FOM_name() ) {
-                  ostringstream errmsg;
-                  errmsg << "Manager::verify_object_and_interaction_arrays():" << __LINE__
-                         << " ERROR: Interaction '" << interactions[i].get_FOM_name()
-                         << "' at array index " << i << " has the same FOM name"
-                         << " as interaction '" << interactions[k].get_FOM_name()
-                         << "' at array index " << k << ". Please check your"
-                         << " input or modified-data files to make sure the"
-                         << " interaction FOM names are unique with no duplicates." << endl;
-                  DebugHandler::terminate_with_message( errmsg.str() );
-                  return;
-               }
-            }
+         pair< unordered_map< string, int >::iterator, bool > const result =
+            inter_FOM_name_indexes.insert( make_pair( interactions[k].get_FOM_name(), k ) );
+
+         if ( !result.second ) {
+            int const i = result.first->second;
+
+            ostringstream errmsg;
+            errmsg << "Manager::verify_object_and_interaction_arrays():" << __LINE__
+                   << " ERROR: Interaction '" << interactions[i].get_FOM_name()
+                   << "' at array index " << i << " has the same FOM name"
+                   << " as interaction '" << interactions[k].get_FOM_name()
+                   << "' at array index " << k << ". Please check your"
+                   << " input or modified-data files to make sure the"
+                   << " interaction FOM names are unique with no duplicates." << endl;
+            DebugHandler::terminate_with_message( errmsg.str() );
+            return;
          }
       }
    }
@@ -441,39 +583,39 @@ void Manager::verify_object_and_interaction_arrays()
 
    // Make sure there is not already a user defined Interaction that uses
    // the same interaction FOM name as the execution control interaction.
+   unordered_set< string > exec_fom_names;
+   exec_fom_names.reserve( exec_fom_names_vector.size() );
+
    for ( size_t i = 0; i < exec_fom_names_vector.size(); ++i ) {
 
       // Make sure Execution Control interactins names are not duplicates.
-      for ( size_t n = i + 1; n < exec_fom_names_vector.size(); ++n ) {
-         if ( exec_fom_names_vector[n] == exec_fom_names_vector[i] ) {
-            ostringstream errmsg;
-            errmsg << "Manager::verify_object_and_interaction_arrays():" << __LINE__
-                   << " ERROR: Execution Control has duplicate Interactions for '"
-                   << exec_fom_names_vector[i]
-                   << "'. Please check your Execution Control implementation to"
-                   << " make sure only one interaction implementation exists per"
-                   << " HLA interaction class FOM name." << endl;
-            DebugHandler::terminate_with_message( errmsg.str() );
-            return;
-         }
+      if ( !exec_fom_names.insert( exec_fom_names_vector[i] ).second ) {
+         ostringstream errmsg;
+         errmsg << "Manager::verify_object_and_interaction_arrays():" << __LINE__
+                << " ERROR: Execution Control has duplicate Interactions for '"
+                << exec_fom_names_vector[i]
+                << "'. Please check your Execution Control implementation to"
+                << " make sure only one interaction implementation exists per"
+                << " HLA interaction class FOM name." << endl;
+         DebugHandler::terminate_with_message( errmsg.str() );
+         return;
       }
 
       // Check Execution Control interaction names against user defined interactions.
-      for ( int k = 0; k < inter_count; ++k ) {
-         if ( !interactions[k].get_FOM_name().empty()
-              && ( exec_fom_names_vector[i] == interactions[k].FOM_name ) ) {
-            ostringstream errmsg;
-            errmsg << "Manager::verify_object_and_interaction_arrays():" << __LINE__
-                   << " ERROR: Execution Control Interaction '"
-                   << exec_fom_names_vector[i]
-                   << "' has the same FOM name as user specified interaction '"
-                   << interactions[k].FOM_name << "' at array index " << k
-                   << ". Please check your input or modified-data files to"
-                   << " make sure the interaction FOM names are unique with"
-                   << " no duplicates." << endl;
-            DebugHandler::terminate_with_message( errmsg.str() );
-            return;
-         }
+      unordered_map< string, int >::const_iterator const inter_iter = inter_FOM_name_indexes.find( exec_fom_names_vector[i] );
+      if ( inter_iter != inter_FOM_name_indexes.end() ) {
+         int const k = inter_iter->second;
+         ostringstream errmsg;
+         errmsg << "Manager::verify_object_and_interaction_arrays():" << __LINE__
+                << " ERROR: Execution Control Interaction '"
+                << exec_fom_names_vector[i]
+                << "' has the same FOM name as user specified interaction '"
+                << interactions[k].FOM_name << "' at array index " << k
+                << ". Please check your input or modified-data files to"
+                << " make sure the interaction FOM names are unique with"
+                << " no duplicates." << endl;
+         DebugHandler::terminate_with_message( errmsg.str() );
+         return;
       }
    }
 }
@@ -960,9 +1102,12 @@ void Manager::object_instance_name_reservation_succeeded(
    if ( !execution_control->object_instance_name_reservation_succeeded( obj_instance_name ) ) {
 
       Object *trickhla_obj = get_trickhla_object( obj_instance_name );
-      if ( trickhla_obj != NULL ) {
+      if ( ( trickhla_obj != NULL ) && !trickhla_obj->is_name_registered() ) {
          trickhla_obj->set_name_registered();
 
+         // Signal the waiting thread once the last pending name is reserved.
+         name_reservation_latch.count_down();
+
          if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
             message_publish( MSG_NORMAL, "Manager::object_instance_name_reservation_succeeded():%d \
 RESERVED Object Instance Name '%s'\n",
@@ -1043,6 +1188,10 @@ which keeps the instance attribute's object from becoming a Federation orphan. *
 void Manager::add_object_to_map(
    Object *object )
 {
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
    // Add the registered ExecutionConfiguration object instance to the map
    // only if it is not already in it.
    if ( ( object->is_instance_handle_valid() )
@@ -1056,11 +1205,18 @@ void Manager::add_object_to_map(
  */
 void Manager::setup_all_ref_attributes()
 {
+   StartupProfilerScope profile_scope( "Manager::setup_all_ref_attributes", "phase" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       message_publish( MSG_NORMAL, "Manager::setup_all_ref_attributes():%d\n",
                        __LINE__ );
    }
 
+   // Time how long it takes to resolve the Trick names and create the
+   // encoders, with the resolution cache counts reset.
+   int64_t const start_time = SleepTimeout::time();
+   EncoderFactory::clear_resolution_cache();
+
    // Create the map of object instance names to object array indexes.
    obj_name_index_map.clear();
    for ( size_t index = 0; index < (size_t)obj_count; ++index ) {
@@ -1084,11 +1240,38 @@ void Manager::setup_all_ref_attributes()
    }
    setup_object_ref_attributes( obj_count, objects );
 
+   // Validate the object pool templates. The pooled objects themselves are
+   // set up as the slots are allocated.
+   for ( int p = 0; p < pool_count; ++p ) {
+      object_pools[p].initialize( this, p );
+   }
+
+   // Collect the unique batched lag compensation stages used by the objects
+   // so that we can compensate each batch once per send and receive.
+   lag_comp_batches.clear();
+   for ( int n = 0; n < obj_count; ++n ) {
+      if ( ( objects[n].lag_comp != NULL ) && objects[n].lag_comp->is_batched() ) {
+         LagCompensationBatch *batch = objects[n].lag_comp->get_batch();
+         if ( find( lag_comp_batches.begin(), lag_comp_batches.end(), batch ) == lag_comp_batches.end() ) {
+            lag_comp_batches.push_back( batch );
+         }
+      }
+   }
+
    if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      message_publish( MSG_NORMAL, "Manager::setup_all_ref_attributes():%d Lag compensation batches: %d\n",
+                       __LINE__, (int)lag_comp_batches.size() );
       message_publish( MSG_NORMAL, "Manager::setup_all_ref_attributes():%d Interactions\n",
                        __LINE__ );
    }
    setup_interaction_ref_attributes();
+
+   if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      message_publish( MSG_NORMAL, "Manager::setup_all_ref_attributes():%d Resolved the Trick names in %.3f seconds, resolution cache hits:%u misses:%u\n",
+                       __LINE__, (double)( SleepTimeout::time() - start_time ) / 1000000.0,
+                       EncoderFactory::get_resolution_cache_hits(),
+                       EncoderFactory::get_resolution_cache_misses() );
+   }
 }
 
 /*!
@@ -1212,11 +1395,17 @@ void Manager::setup_interaction_ref_attributes()
  */
 void Manager::setup_all_RTI_handles()
 {
+   StartupProfilerScope profile_scope( "Manager::setup_all_RTI_handles", "rti" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       message_publish( MSG_NORMAL, "Manager::setup_all_RTI_handles():%d\n",
                        __LINE__ );
    }
 
+   // Start from an empty handle cache so that the handles are resolved
+   // against the federation execution we are currently joined to.
+   clear_RTI_handle_cache();
+
    // Set up the object RTI handles for the ExecutionControl mechanisms.
    execution_control->setup_object_RTI_handles();
 
@@ -1228,6 +1417,273 @@ void Manager::setup_all_RTI_handles()
 
    // Simulation Interactions.
    setup_interaction_RTI_handles( inter_count, interactions );
+
+   // Set up the object RTI handles for the object pools.
+   setup_object_pool_RTI_handles();
+
+   // Now that the object class handles are known, index the objects so that
+   // discovered object instances can be bound to them quickly.
+   build_object_discovery_index();
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      message_publish( MSG_NORMAL, "Manager::setup_all_RTI_handles():%d Resolved handles for %d object classes and %d interaction classes.\n",
+                       __LINE__, (int)obj_class_handle_cache.size(),
+                       (int)inter_class_handle_cache.size() );
+   }
+}
+
+/*!
+ * @details The template attribute handles are copied into each pooled
+ * object as its slot is allocated.
+ * @job_class{initialization}
+ */
+void Manager::setup_object_pool_RTI_handles()
+{
+   obj_pool_class_map.clear();
+
+   if ( pool_count <= 0 ) {
+      return;
+   }
+
+   RTIambassador *rti_amb = get_RTI_ambassador();
+   if ( rti_amb == NULL ) {
+      ostringstream errmsg;
+      errmsg << "Manager::setup_object_pool_RTI_handles():" << __LINE__
+             << " ERROR: Unexpected NULL RTIambassador!" << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   string obj_FOM_name  = "";
+   string attr_FOM_name = "";
+
+   try {
+      for ( int p = 0; p < pool_count; ++p ) {
+         obj_FOM_name  = object_pools[p].get_FOM_name();
+         attr_FOM_name = "";
+
+         ObjectClassHandle const class_handle = get_cached_object_class_handle( rti_amb, obj_FOM_name );
+         object_pools[p].set_class_handle( class_handle );
+
+         int const  attr_count = object_pools[p].get_attribute_count();
+         Attribute *attrs      = object_pools[p].get_attributes();
+         for ( int i = 0; i < attr_count; ++i ) {
+            attr_FOM_name = attrs[i].get_FOM_name();
+            attrs[i].set_attribute_handle(
+               get_cached_attribute_handle( rti_amb, obj_FOM_name,
+                                            class_handle, attr_FOM_name ) );
+         }
+
+         if ( obj_pool_class_map.find( class_handle ) != obj_pool_class_map.end() ) {
+            ostringstream errmsg;
+            errmsg << "Manager::setup_object_pool_RTI_handles():" << __LINE__
+                   << " ERROR: More than one object pool for the Object FOM Name '"
+                   << obj_FOM_name << "'. Please check your input or modified-data"
+                   << " files to make sure there is only one pool per object class." << endl;
+            DebugHandler::terminate_with_message( errmsg.str() );
+         }
+         obj_pool_class_map[class_handle] = &object_pools[p];
+      }
+   } catch ( NameNotFound const &e ) {
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+      ostringstream errmsg;
+      errmsg << "Manager::setup_object_pool_RTI_handles():" << __LINE__
+             << " ERROR: For object pool Object FOM Name '" << obj_FOM_name << "'";
+      if ( !attr_FOM_name.empty() ) {
+         errmsg << ", Attribute FOM Name '" << attr_FOM_name << "'";
+      }
+      errmsg << " Not Found. Please check your input or modified-data files to"
+             << " make sure the FOM Name is correctly specified." << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   } catch ( RTI1516_NAMESPACE::Exception const &e ) {
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "Manager::setup_object_pool_RTI_handles():" << __LINE__
+             << " ERROR: Exception for '" << rti_err_msg << "'" << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+   // Now that the handles are known the initial slots can be allocated.
+   for ( int p = 0; p < pool_count; ++p ) {
+      object_pools[p].allocate_initial_slots();
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void Manager::clear_RTI_handle_cache()
+{
+   obj_class_handle_cache.clear();
+   attr_handle_cache.clear();
+   inter_class_handle_cache.clear();
+   param_handle_cache.clear();
+}
+
+/*!
+ * @details A late joining federate can discover thousands of object instances
+ * in a burst, so each discovered instance is bound to its object through an
+ * index instead of scanning all the objects.
+ * @job_class{initialization}
+ */
+void Manager::build_object_discovery_index()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
+   obj_class_name_index.clear();
+   unbound_remote_objs.clear();
+
+   for ( int n = 0; n < obj_count; ++n ) {
+      if ( !objects[n].get_name().empty() ) {
+         wstring ws_obj_name;
+         StringUtilities::to_wstring( ws_obj_name, objects[n].get_name() );
+         obj_class_name_index[make_pair( objects[n].get_class_handle(), ws_obj_name )] = &objects[n];
+      }
+
+      if ( !objects[n].is_instance_handle_valid() ) {
+         add_unbound_remote_object( n );
+      }
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      message_publish( MSG_NORMAL, "Manager::build_object_discovery_index():%d Indexed %d named objects and %d classes of nameless remote objects.\n",
+                       __LINE__, (int)obj_class_name_index.size(),
+                       (int)unbound_remote_objs.size() );
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void Manager::add_unbound_remote_object(
+   int const index )
+{
+   // Only a remote object that does not require a specific instance name can
+   // be bound to any discovered instance of its class.
+   if ( ( !objects[index].is_create_HLA_instance() )
+        && ( !objects[index].is_name_required() || objects[index].get_name().empty() ) ) {
+      unbound_remote_objs[objects[index].get_class_handle()].insert( index );
+   }
+}
+
+/*!
+ * @details Objects of the same FOM class share the same class handle; so,
+ * the RTI is only asked for it once per class.
+ * @job_class{initialization}
+ */
+ObjectClassHandle Manager::get_cached_object_class_handle(
+   RTIambassador *rti_amb,
+   string const  &class_FOM_name )
+{
+   TrickHLAObjClassHandleNameMap::const_iterator iter = obj_class_handle_cache.find( class_FOM_name );
+   if ( iter != obj_class_handle_cache.end() ) {
+      return iter->second;
+   }
+
+   wstring ws_FOM_name;
+   StringUtilities::to_wstring( ws_FOM_name, class_FOM_name );
+
+   ObjectClassHandle const class_handle = rti_amb->getObjectClassHandle( ws_FOM_name );
+
+   obj_class_handle_cache[class_FOM_name] = class_handle;
+
+   return class_handle;
+}
+
+/*!
+ * @details Attributes of objects with the same FOM class share the same
+ * attribute handles; so, the RTI is only asked for them once per class.
+ * @job_class{initialization}
+ */
+AttributeHandle Manager::get_cached_attribute_handle(
+   RTIambassador           *rti_amb,
+   string const            &class_FOM_name,
+   ObjectClassHandle const &class_handle,
+   string const            &attr_FOM_name )
+{
+   TrickHLAAttributeHandleNameMap &attr_handles = attr_handle_cache[class_FOM_name];
+
+   TrickHLAAttributeHandleNameMap::const_iterator iter = attr_handles.find( attr_FOM_name );
+   if ( iter != attr_handles.end() ) {
+      return iter->second;
+   }
+
+   wstring ws_FOM_name;
+   StringUtilities::to_wstring( ws_FOM_name, attr_FOM_name );
+
+   AttributeHandle const attr_handle = rti_amb->getAttributeHandle( class_handle, ws_FOM_name );
+
+   attr_handles[attr_FOM_name] = attr_handle;
+
+   return attr_handle;
+}
+
+/*!
+ * @details Interactions of the same FOM class share the same class handle;
+ * so, the RTI is only asked for it once per class.
+ * @job_class{initialization}
+ */
+InteractionClassHandle Manager::get_cached_interaction_class_handle(
+   RTIambassador *rti_amb,
+   string const  &class_FOM_name )
+{
+   TrickHLAInterClassHandleNameMap::const_iterator iter = inter_class_handle_cache.find( class_FOM_name );
+   if ( iter != inter_class_handle_cache.end() ) {
+      return iter->second;
+   }
+
+   wstring ws_FOM_name;
+   StringUtilities::to_wstring( ws_FOM_name, class_FOM_name );
+
+   InteractionClassHandle const class_handle = rti_amb->getInteractionClassHandle( ws_FOM_name );
+
+   inter_class_handle_cache[class_FOM_name] = class_handle;
+
+   return class_handle;
+}
+
+/*!
+ * @details Parameters of interactions with the same FOM class share the
+ * same parameter handles; so, the RTI is only asked for them once per class.
+ * @job_class{initialization}
+ */
+ParameterHandle Manager::get_cached_parameter_handle(
+   RTIambassador                *rti_amb,
+   string const                 &class_FOM_name,
+   InteractionClassHandle const &class_handle,
+   string const                 &param_FOM_name )
+{
+   TrickHLAParameterHandleNameMap &param_handles = param_handle_cache[class_FOM_name];
+
+   TrickHLAParameterHandleNameMap::const_iterator iter = param_handles.find( param_FOM_name );
+   if ( iter != param_handles.end() ) {
+      return iter->second;
+   }
+
+   wstring ws_FOM_name;
+   StringUtilities::to_wstring( ws_FOM_name, param_FOM_name );
+
+   ParameterHandle const param_handle = rti_amb->getParameterHandle( class_handle, ws_FOM_name );
+
+   param_handles[param_FOM_name] = param_handle;
+
+   return param_handle;
 }
 
 /*!
@@ -1275,9 +1731,9 @@ void Manager::setup_object_RTI_handles(
 
    // Initialize the Object and Attribute RTI handles.
    try {
-      wstring ws_FOM_name = L"";
-
-      // Resolve all the handles/ID's for the objects and attributes.
+      // Resolve all the handles/ID's for the objects and attributes. The
+      // handles are cached per FOM class so that the RTI is only asked once
+      // for each class and attribute no matter how many instances there are.
       for ( int n = 0; n < data_obj_count; ++n ) {
          ostringstream msg;
 
@@ -1290,13 +1746,11 @@ void Manager::setup_object_RTI_handles(
                 << " FOM-Name:'" << data_objects[n].get_FOM_name() << "'" << endl;
          }
 
-         // Create the wide-string object FOM name.
          FOM_name_type = 1; // Object
          obj_FOM_name  = data_objects[n].get_FOM_name();
-         StringUtilities::to_wstring( ws_FOM_name, obj_FOM_name );
 
          // Get the class handle for the given object FOM name.
-         data_objects[n].set_class_handle( rti_amb->getObjectClassHandle( ws_FOM_name ) );
+         data_objects[n].set_class_handle( get_cached_object_class_handle( rti_amb, obj_FOM_name ) );
 
          if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
             string handle_str;
@@ -1319,14 +1773,14 @@ void Manager::setup_object_RTI_handles(
                    << attrs[i].get_FOM_name() << "'" << endl;
             }
 
-            // Create the wide-string Attribute FOM name.
             FOM_name_type = 2; // Attribute
             attr_FOM_name = attrs[i].get_FOM_name();
-            StringUtilities::to_wstring( ws_FOM_name, attr_FOM_name );
 
-            // Get the Attribute-Handle from the RTI.
+            // Get the Attribute-Handle.
             attrs[i].set_attribute_handle(
-               rti_amb->getAttributeHandle( data_objects[n].get_class_handle(), ws_FOM_name ) );
+               get_cached_attribute_handle( rti_amb, obj_FOM_name,
+                                            data_objects[n].get_class_handle(),
+                                            attr_FOM_name ) );
 
             if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
                string id_str;
@@ -1473,16 +1927,14 @@ void Manager::setup_interaction_RTI_handles(
 
    // Initialize the Interaction and Parameter RTI handles.
    try {
-      wstring ws_FOM_name = L"";
-
-      // Process all the Interactions.
+      // Process all the Interactions. The handles are cached per FOM class
+      // so that the RTI is only asked once for each class and parameter.
       for ( int n = 0; n < interactions_counter; ++n ) {
          ostringstream msg;
 
          // The Interaction FOM name.
          FOM_name_type  = 1; // Interaction
          inter_FOM_name = in_interactions[n].get_FOM_name();
-         StringUtilities::to_wstring( ws_FOM_name, inter_FOM_name );
 
          if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
             msg << "Manager::setup_interaction_RTI_handles()" << __LINE__ << endl
@@ -1492,7 +1944,7 @@ void Manager::setup_interaction_RTI_handles(
          }
 
          // Get the Interaction class handle.
-         in_interactions[n].set_class_handle( rti_amb->getInteractionClassHandle( ws_FOM_name ) );
+         in_interactions[n].set_class_handle( get_cached_interaction_class_handle( rti_amb, inter_FOM_name ) );
 
          if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
             string handle_str;
@@ -1512,7 +1964,6 @@ void Manager::setup_interaction_RTI_handles(
             // The Parameter FOM name.
             FOM_name_type  = 2; // Parameter
             param_FOM_name = params[i].get_FOM_name();
-            StringUtilities::to_wstring( ws_FOM_name, param_FOM_name );
 
             if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
                msg << "\tGetting RTI Parameter-Handle for '"
@@ -1521,9 +1972,9 @@ void Manager::setup_interaction_RTI_handles(
 
             // Get the Parameter Handle.
             params[i].set_parameter_handle(
-               rti_amb->getParameterHandle(
-                  in_interactions[n].get_class_handle(),
-                  ws_FOM_name ) );
+               get_cached_parameter_handle( rti_amb, inter_FOM_name,
+                                            in_interactions[n].get_class_handle(),
+                                            param_FOM_name ) );
 
             if ( DebugHandler::show( DEBUG_LEVEL_9_TRACE, DEBUG_SOURCE_MANAGER ) ) {
                string handle_str;
@@ -1629,14 +2080,17 @@ void Manager::publish()
       return;
    }
 
-   // Publish attributes for all the Trick-HLA-Objects we know about.
-   for ( int n = 0; n < obj_count; ++n ) {
-      objects[n].publish_object_attributes();
-   }
+   // Publish the attributes for all the Trick-HLA-Objects we know about,
+   // once per object class.
+   declare_object_class_attributes( true );
 
-   // Publish the interactions.
+   // Publish the interactions, once per interaction class.
+   set< InteractionClassHandle > inter_classes;
    for ( int n = 0; n < inter_count; ++n ) {
-      interactions[n].publish_interaction();
+      if ( interactions[n].is_publish()
+           && inter_classes.insert( interactions[n].get_class_handle() ).second ) {
+         interactions[n].publish_interaction();
+      }
    }
 
    // Publish Execution Control objects and interactions.
@@ -1675,6 +2129,11 @@ void Manager::unpublish()
       }
    }
 
+   // Unpublish the object pool classes.
+   for ( i = 0; i < pool_count; ++i ) {
+      object_pools[i].unpublish_all_object_attributes();
+   }
+
    // Unpublish all the interactions.
    for ( i = 0; i < inter_count; ++i ) {
       // Only unpublish an interaction that we publish.
@@ -1707,14 +2166,17 @@ void Manager::subscribe()
       return;
    }
 
-   // Subscribe to attributes for all the Trick-HLA-Objects we know about.
-   for ( int n = 0; n < obj_count; ++n ) {
-      objects[n].subscribe_to_object_attributes();
-   }
+   // Subscribe to the attributes for all the Trick-HLA-Objects we know
+   // about, once per object class.
+   declare_object_class_attributes( false );
 
-   // Subscribe to the interactions.
+   // Subscribe to the interactions, once per interaction class.
+   set< InteractionClassHandle > inter_classes;
    for ( int n = 0; n < inter_count; ++n ) {
-      interactions[n].subscribe_to_interaction();
+      if ( interactions[n].is_subscribe()
+           && inter_classes.insert( interactions[n].get_class_handle() ).second ) {
+         interactions[n].subscribe_to_interaction();
+      }
    }
 
    // Subscribe to anything needed for the execution control mechanisms.
@@ -1722,17 +2184,115 @@ void Manager::subscribe()
 }
 
 /*!
+ * @details The RTI holds one declaration of interest per object class, so
+ * instead of each object declaring its own attributes, which re-declares the
+ * class for every instance, the attributes are merged per class first.
  * @job_class{initialization}
  */
-void Manager::unsubscribe()
+void Manager::declare_object_class_attributes(
+   bool const publish )
 {
-   int  i, k;
-   bool do_unsubscribe;
+   char const *const method_name = ( publish ? "publish" : "subscribe" );
 
-   if ( !is_RTI_ready( "unsubscribe" ) ) {
-      return;
+   // Merge the published or subscribed attributes per object class.
+   map< ObjectClassHandle, AttributeHandleSet > class_attrs;
+   map< ObjectClassHandle, string >             class_names;
+   for ( int n = 0; n < obj_count; ++n ) {
+      int const  attr_count = objects[n].get_attribute_count();
+      Attribute *attrs      = objects[n].get_attributes();
+      for ( int i = 0; i < attr_count; ++i ) {
+         if ( publish ? attrs[i].is_publish() : attrs[i].is_subscribe() ) {
+            class_attrs[objects[n].get_class_handle()].insert( attrs[i].get_attribute_handle() );
+            class_names[objects[n].get_class_handle()] = objects[n].get_FOM_name();
+         }
+      }
    }
-
+   for ( int p = 0; p < pool_count; ++p ) {
+      int const  attr_count = object_pools[p].get_attribute_count();
+      Attribute *attrs      = object_pools[p].get_attributes();
+      for ( int i = 0; i < attr_count; ++i ) {
+         if ( publish ? attrs[i].is_publish() : attrs[i].is_subscribe() ) {
+            class_attrs[object_pools[p].get_class_handle()].insert( attrs[i].get_attribute_handle() );
+            class_names[object_pools[p].get_class_handle()] = object_pools[p].get_FOM_name();
+         }
+      }
+   }
+
+   if ( class_attrs.empty() ) {
+      return;
+   }
+
+   RTIambassador *rti_amb = get_RTI_ambassador();
+   if ( rti_amb == NULL ) {
+      message_publish( MSG_WARNING, "Manager::declare_object_class_attributes():%d Unexpected NULL RTIambassador for %s.\n",
+                       __LINE__, method_name );
+      return;
+   }
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   string class_name = "";
+   try {
+      map< ObjectClassHandle, AttributeHandleSet >::const_iterator iter;
+      for ( iter = class_attrs.begin(); iter != class_attrs.end(); ++iter ) {
+         class_name = class_names[iter->first];
+
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+            message_publish( MSG_NORMAL, "Manager::declare_object_class_attributes():%d %s %d attributes of object class '%s'.\n",
+                             __LINE__, method_name, (int)iter->second.size(),
+                             class_name.c_str() );
+         }
+
+         if ( publish ) {
+            rti_amb->publishObjectClassAttributes( iter->first, iter->second );
+         } else {
+            rti_amb->subscribeObjectClassAttributes( iter->first, iter->second, true );
+         }
+      }
+   } catch ( NotConnected const &e ) {
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+      ostringstream errmsg;
+      errmsg << "Manager::declare_object_class_attributes():" << __LINE__
+             << " EXCEPTION: NotConnected for the " << method_name
+             << " of object class '" << class_name << "'" << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      if ( federate != NULL ) {
+         federate->set_connection_lost();
+      }
+   } catch ( RTI1516_NAMESPACE::Exception const &e ) {
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "Manager::declare_object_class_attributes():" << __LINE__
+             << " Exception for the " << method_name << " of object class '"
+             << class_name << "' with error '" << rti_err_msg << "'" << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void Manager::unsubscribe()
+{
+   int  i, k;
+   bool do_unsubscribe;
+
+   if ( !is_RTI_ready( "unsubscribe" ) ) {
+      return;
+   }
+
    // Unsubscribe from all attributes for all the objects.
    for ( i = 0; i < obj_count; ++i ) {
       // Only unsubscribe from an object class if we had subscribed to at
@@ -1754,6 +2314,11 @@ void Manager::unsubscribe()
       }
    }
 
+   // Unsubscribe from the object pool classes.
+   for ( i = 0; i < pool_count; ++i ) {
+      object_pools[i].unsubscribe_all_object_attributes();
+   }
+
    // Unsubscribe from all the interactions.
    for ( i = 0; i < inter_count; ++i ) {
       // Only unsubscribe from interactions that are subscribed to.
@@ -1792,51 +2357,216 @@ void Manager::publish_and_subscribe()
 }
 
 /*!
+ * @details All the object instance names that need to be reserved are
+ * reserved with a single reserveMultipleObjectInstanceName request. Per the
+ * HLA rules the names in the request must be unique and the request succeeds
+ * or fails as a whole, which is fine since any failed reservation of a
+ * locally owned object instance name is fatal anyway.
  * @job_class{initialization}
  */
 void Manager::reserve_object_names_with_RTI()
 {
+   StartupProfilerScope profile_scope( "Manager::reserve_object_names_with_RTI", "rti" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       message_publish( MSG_NORMAL, "Manager::reserve_object_names_with_RTI():%d\n",
                        __LINE__ );
    }
 
-   // For the locally owned objects, reserve the object instance name with
-   // the RTI.
+   // Gather the names of the locally created object instances that still
+   // need to be reserved. If we already have an instance handle then the
+   // instance already exists and we do not reserve the name.
+   set< wstring > obj_names;
    for ( int n = 0; n < obj_count; ++n ) {
-      objects[n].reserve_object_name_with_RTI();
+      if ( objects[n].is_name_required()
+           && objects[n].is_create_HLA_instance()
+           && !objects[n].is_instance_handle_valid()
+           && !objects[n].is_name_registered() ) {
+
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+            message_publish( MSG_NORMAL, "Manager::reserve_object_names_with_RTI():%d \
+Requesting reservation of Object instance name '%s'.\n",
+                             __LINE__, objects[n].get_name().c_str() );
+         }
+
+         wstring ws_obj_name;
+         StringUtilities::to_wstring( ws_obj_name, objects[n].get_name() );
+         obj_names.insert( ws_obj_name );
+      }
+   }
+
+   // Set the pending count before making the request so that no
+   // reservation callback is missed.
+   name_reservation_latch.reset( obj_names.size() );
+
+   if ( obj_names.empty() ) {
+      return;
+   }
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   RTIambassador *rti_amb = get_RTI_ambassador();
+   if ( rti_amb == NULL ) {
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+      ostringstream errmsg;
+      errmsg << "Manager::reserve_object_names_with_RTI():" << __LINE__
+             << " ERROR: Unexpected NULL RTIambassador!" << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      message_publish( MSG_NORMAL, "Manager::reserve_object_names_with_RTI():%d \
+Requesting reservation of %d Object instance names.\n",
+                       __LINE__, (int)obj_names.size() );
+   }
+
+   // Reserving an object instance name with the RTI allows the object to be
+   // recognized by name when discovered by other federates in the federation
+   // execution. Note: We are notified in a callback if the name reservation
+   // was successful or failed.
+   try {
+      rti_amb->reserveMultipleObjectInstanceName( obj_names );
+   } catch ( IllegalName const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "Manager::reserve_object_names_with_RTI():" << __LINE__
+             << " IllegalName: " << rti_err_msg << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   } catch ( NameSetWasEmpty const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "Manager::reserve_object_names_with_RTI():" << __LINE__
+             << " NameSetWasEmpty: " << rti_err_msg << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   } catch ( FederateNotExecutionMember const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "Manager::reserve_object_names_with_RTI():" << __LINE__
+             << " FederateNotExecutionMember: " << rti_err_msg << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   } catch ( SaveInProgress const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "Manager::reserve_object_names_with_RTI():" << __LINE__
+             << " SaveInProgress: " << rti_err_msg << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   } catch ( RestoreInProgress const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "Manager::reserve_object_names_with_RTI():" << __LINE__
+             << " RestoreInProgress: " << rti_err_msg << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   } catch ( NotConnected const &e ) {
+      if ( federate != NULL ) {
+         federate->set_connection_lost();
+      }
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "Manager::reserve_object_names_with_RTI():" << __LINE__
+             << " NotConnected: " << rti_err_msg << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   } catch ( RTIinternalError const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "Manager::reserve_object_names_with_RTI():" << __LINE__
+             << " RTIinternalError: " << rti_err_msg << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   } catch ( RTI1516_NAMESPACE::Exception const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "Manager::reserve_object_names_with_RTI():" << __LINE__
+             << " Exception: " << rti_err_msg << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
    }
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 }
 
 /*!
  * @details Calling this function will block until all the object instances
- * names for the locally owned objects have been reserved.
+ * names for the locally owned objects have been reserved. The reservation
+ * callbacks count down the pending reservations and wake this thread once
+ * the last name is reserved.
  * @job_class{initialization}
  */
 void Manager::wait_for_reservation_of_object_names()
 {
+   StartupProfilerScope profile_scope( "Manager::wait_for_reservation_of_object_names", "wait" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       message_publish( MSG_NORMAL, "Manager::wait_for_reservation_of_object_names():%d\n",
                        __LINE__ );
    }
 
-   // Simulation object names.
-   if ( obj_count > 0 ) {
-      // Wait for each RTI object instance name to be registered with the RTI,
-      // but for only the names we requested registration for.
-      for ( int n = 0; n < obj_count; ++n ) {
-         objects[n].wait_for_object_name_reservation();
-      }
-
-      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-         message_publish( MSG_NORMAL, "Manager::wait_for_reservation_of_object_names():%d All Object instance names reserved.\n",
-                          __LINE__ );
-      }
-   } else {
+   if ( name_reservation_latch.get_count() == 0 ) {
       if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
          message_publish( MSG_NORMAL, "Manager::wait_for_reservation_of_object_names():%d No Object instance names to reserve.\n",
                           __LINE__ );
       }
+      return;
+   }
+
+   SleepTimeout print_timer( federate->wait_status_time );
+   SleepTimeout sleep_timer;
+
+   while ( !name_reservation_latch.wait( THLA_DEFAULT_SLEEP_WAIT_IN_MICROS ) ) {
+
+      // Check for shutdown.
+      federate->check_for_shutdown_with_termination();
+
+      // To be more efficient, we get the time once and share it.
+      int64_t wallclock_time = sleep_timer.time();
+
+      if ( sleep_timer.timeout( wallclock_time ) ) {
+         sleep_timer.reset();
+         if ( !federate->is_execution_member() ) {
+            ostringstream errmsg;
+            errmsg << "Manager::wait_for_reservation_of_object_names():" << __LINE__
+                   << " ERROR: Unexpectedly the Federate is no longer an execution member."
+                   << " This means we are either not connected to the"
+                   << " RTI or we are no longer joined to the federation"
+                   << " execution because someone forced our resignation at"
+                   << " the Central RTI Component (CRC) level!" << endl;
+            DebugHandler::terminate_with_message( errmsg.str() );
+         }
+      }
+
+      if ( print_timer.timeout( wallclock_time ) ) {
+         print_timer.reset();
+
+         ostringstream summary;
+         summary << "Manager::wait_for_reservation_of_object_names():" << __LINE__
+                 << " Waiting on reservation of " << name_reservation_latch.get_count()
+                 << " Object Instance Names:" << endl;
+         for ( int n = 0; n < obj_count; ++n ) {
+            if ( objects[n].is_name_required()
+                 && objects[n].is_create_HLA_instance()
+                 && !objects[n].is_instance_handle_valid()
+                 && !objects[n].is_name_registered() ) {
+               summary << "    '" << objects[n].get_name() << "'" << endl;
+            }
+         }
+         message_publish( MSG_NORMAL, summary.str().c_str() );
+      }
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      message_publish( MSG_NORMAL, "Manager::wait_for_reservation_of_object_names():%d All Object instance names reserved.\n",
+                       __LINE__ );
    }
 }
 
@@ -1845,28 +2575,104 @@ void Manager::wait_for_reservation_of_object_names()
  */
 void Manager::register_objects_with_RTI()
 {
+   StartupProfilerScope profile_scope( "Manager::register_objects_with_RTI", "rti" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       message_publish( MSG_NORMAL, "Manager::register_objects_with_RTI():%d\n",
                        __LINE__ );
    }
 
+   // Start timing the object registration and discovery pipeline.
+   obj_pipeline_start_time = SleepTimeout::time();
+
    // Have the ExecutionControl register objects it needs with the RTI.
    execution_control->register_objects_with_RTI();
 
    // For the locally owned objects register it with the RTI to get its
-   // RTI object instance ID.
+   // RTI object instance ID. The registrations are issued back to back and
+   // the remote objects are discovered through the FedAmb callbacks in the
+   // meantime.
    for ( int n = 0; n < obj_count; ++n ) {
       objects[n].register_object_with_RTI();
 
+      // Concurrency critical code section for discovered objects being set
+      // in FedAmb callback.
+      MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
       // Add the registered object instance to the map and only if it is
       // not already in it.
       if ( ( objects[n].is_instance_handle_valid() )
            && ( object_map.find( objects[n].get_instance_handle() ) == object_map.end() ) ) {
          object_map[objects[n].get_instance_handle()] = &objects[n];
+         set_object_ready( &objects[n] );
       }
    }
 }
 
+/*!
+ * @job_class{initialization}
+ */
+void Manager::set_object_ready(
+   Object const *obj )
+{
+   // Only the first time the instance handle becomes valid counts.
+   if ( obj_ready_times.find( obj ) != obj_ready_times.end() ) {
+      return;
+   }
+   obj_ready_times[obj] = SleepTimeout::time();
+
+   // Wake the waiting thread once the last pending required object is ready.
+   if ( obj->is_required() ) {
+      required_objects_latch.count_down();
+   }
+}
+
+/*!
+ * @details Only the slowest required objects are printed to keep the list
+ * short and to the point.
+ * @job_class{initialization}
+ */
+void Manager::print_object_straggler_times(
+   char const *caller )
+{
+   // Maximum number of stragglers to print.
+   unsigned int const max_stragglers = 10;
+
+   vector< pair< int64_t, Object const * > > ready_times;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks
+      // the mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
+      map< Object const *, int64_t >::const_iterator iter;
+      for ( iter = obj_ready_times.begin(); iter != obj_ready_times.end(); ++iter ) {
+         if ( iter->first->is_required() ) {
+            ready_times.push_back( make_pair( iter->second, iter->first ) );
+         }
+      }
+   }
+
+   if ( ready_times.empty() ) {
+      return;
+   }
+
+   // Slowest objects first.
+   sort( ready_times.rbegin(), ready_times.rend() );
+
+   ostringstream summary;
+   summary << caller << ":" << __LINE__
+           << " Slowest required objects, time since the start of object registration:";
+   for ( size_t i = 0; ( i < ready_times.size() ) && ( i < max_stragglers ); ++i ) {
+      int64_t const elapsed = ready_times[i].first - obj_pipeline_start_time;
+      summary << "\n  Object instance '" << ready_times[i].second->get_name()
+              << "' for class '" << ready_times[i].second->get_FOM_name()
+              << "' " << ( ( elapsed > 0 ) ? ( (double)elapsed / 1000000.0 ) : 0.0 )
+              << " seconds";
+   }
+   summary << endl;
+   message_publish( MSG_NORMAL, summary.str().c_str() );
+}
+
 /*!
  * @job_class{initialization}
  */
@@ -1900,6 +2706,8 @@ void Manager::setup_preferred_order_with_RTI()
  */
 void Manager::wait_for_registration_of_required_objects()
 {
+   StartupProfilerScope profile_scope( "Manager::wait_for_registration_of_required_objects", "wait" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       message_publish( MSG_NORMAL, "Manager::wait_for_registration_of_required_objects():%d\n",
                        __LINE__ );
@@ -1931,8 +2739,13 @@ void Manager::wait_for_registration_of_required_objects()
       }
    }
 
-   SleepTimeout print_timer( federate->wait_status_time );
-   SleepTimeout sleep_timer;
+   SleepTimeout  print_timer( federate->wait_status_time );
+   SleepTimeout  sleep_timer;
+   int64_t const wait_start_time = SleepTimeout::time();
+
+   // Only count the objects again when the callbacks signal that all the
+   // required objects are ready or when we periodically double check.
+   bool rescan = true;
 
    do {
 
@@ -1940,7 +2753,9 @@ void Manager::wait_for_registration_of_required_objects()
       federate->check_for_shutdown_with_termination();
 
       // Data objects.
-      if ( current_required_obj_cnt < total_required_obj_cnt ) {
+      if ( rescan && ( current_required_obj_cnt < total_required_obj_cnt ) ) {
+         rescan = false;
+
          int required_obj_cnt   = 0;
          int registered_obj_cnt = 0;
 
@@ -1972,6 +2787,10 @@ void Manager::wait_for_registration_of_required_objects()
                   }
                }
             }
+
+            // The registration and discovery callbacks count down the
+            // required objects that are still pending.
+            required_objects_latch.reset( total_required_obj_cnt - required_obj_cnt );
          }
 
          // If we have a new registration count then update the object
@@ -2006,7 +2825,9 @@ void Manager::wait_for_registration_of_required_objects()
                  << "  Total-Objects:" << total_obj_cnt;
 
          if ( print_only_unregistered_obj ) {
-            summary << "\nSHOWING ONLY UNREGISTERED OBJECTS:";
+            summary << "\nSHOWING ONLY UNREGISTERED OBJECTS AFTER "
+                    << ( (double)( SleepTimeout::time() - wait_start_time ) / 1000000.0 )
+                    << " SECONDS:";
          }
 
          // Concurrency critical code section for discovered objects being set
@@ -2070,14 +2891,12 @@ void Manager::wait_for_registration_of_required_objects()
       // Determine if we have any unregistered objects.
       any_unregistered_required_obj = ( current_required_obj_cnt < total_required_obj_cnt );
 
-      // Wait a little while to allow the objects to be registered.
+      // Wait for the registration and discovery callbacks to signal that
+      // all the required objects are ready.
       if ( any_unregistered_required_obj ) {
-         sleep_timer.sleep();
-
-         // Check again to see if we have any unregistered objects.
-         any_unregistered_required_obj = ( current_required_obj_cnt < total_required_obj_cnt ); // cppcheck-suppress [knownConditionTrueFalse,redundantAssignment]
-
-         if ( any_unregistered_required_obj ) { // cppcheck-suppress [knownConditionTrueFalse,unmatchedSuppression]
+         if ( required_objects_latch.wait( THLA_DEFAULT_SLEEP_WAIT_IN_MICROS ) ) {
+            rescan = true;
+         } else {
 
             // To be more efficient, we get the time once and share it.
             int64_t wallclock_time = sleep_timer.time();
@@ -2097,6 +2916,10 @@ void Manager::wait_for_registration_of_required_objects()
                   DebugHandler::terminate_with_message( errmsg.str() );
                   return;
                }
+
+               // Periodically double check the count in case an instance
+               // handle was set without a callback.
+               rescan = true;
             }
 
             // Determine if we should print a summary of unregistered objects.
@@ -2108,11 +2931,19 @@ void Manager::wait_for_registration_of_required_objects()
                // configuration and they are in deadlock here. Print only
                // unregistered objects to keep the list short and to the point.
                print_only_unregistered_obj = true;
+               rescan                      = true;
             }
          }
       }
    } while ( any_unregistered_required_obj );
 
+   // Show the slowest objects if we are debugging or if the wait was long
+   // enough that the user saw the status messages.
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER )
+        || ( ( SleepTimeout::time() - wait_start_time ) >= ( federate->wait_status_time * 1000000 ) ) ) {
+      print_object_straggler_times( "Manager::wait_for_registration_of_required_objects()" );
+   }
+
    // Concurrency critical code section for discovered objects being set
    // in FedAmb callback.
    {
@@ -2134,6 +2965,7 @@ void Manager::wait_for_registration_of_required_objects()
          if ( ( objects[n].is_instance_handle_valid() )
               && ( object_map.find( objects[n].get_instance_handle() ) == object_map.end() ) ) {
             object_map[objects[n].get_instance_handle()] = &objects[n];
+            set_object_ready( &objects[n] );
          }
       }
    }
@@ -2330,6 +3162,8 @@ void Manager::provide_attribute_update(
  */
 void Manager::send_cyclic_and_requested_data()
 {
+   FrameProfilerScope profile_scope( federate->frame_profiler, FRAME_STAGE_SEND_CYCLIC_DATA );
+
    // Current time values.
    int64_t const sim_time_in_base_time = Int64BaseTime::to_base_time( exec_get_sim_time() );
    int64_t const granted_base_time     = federate->get_granted_time().get_base_time();
@@ -2376,6 +3210,11 @@ void Manager::send_cyclic_and_requested_data()
    // Send any ExecutionControl data requested.
    execution_control->send_requested_data( update_time );
 
+   // Send the data for the live pooled objects using the HLA cycle time.
+   for ( int p = 0; p < pool_count; ++p ) {
+      object_pools[p].send_cyclic_and_requested_data( update_time );
+   }
+
    // Send data to remote RTI federates for each of the objects.
    for ( int obj_index = 0; obj_index < this->obj_count; ++obj_index ) {
 
@@ -2401,6 +3240,17 @@ void Manager::send_cyclic_and_requested_data()
          objects[obj_index].send_cyclic_and_requested_data( update_time );
       }
    }
+
+   // Compensate all the batched send side lag compensation objects in one
+   // pass and then send the objects that were waiting on their batch.
+   if ( !lag_comp_batches.empty() ) {
+      for ( size_t i = 0; i < lag_comp_batches.size(); ++i ) {
+         lag_comp_batches[i]->send_lag_compensation();
+      }
+      for ( int obj_index = 0; obj_index < this->obj_count; ++obj_index ) {
+         objects[obj_index].send_batched_cyclic_and_requested_data();
+      }
+   }
 }
 
 /*!
@@ -2415,6 +3265,8 @@ void Manager::send_cyclic_and_requested_data()
  */
 void Manager::receive_cyclic_data()
 {
+   FrameProfilerScope profile_scope( federate->frame_profiler, FRAME_STAGE_RECEIVE_CYCLIC_DATA );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       message_publish( MSG_NORMAL, "Manager::receive_cyclic_data():%d\n", __LINE__ );
    }
@@ -2432,6 +3284,22 @@ void Manager::receive_cyclic_data()
          objects[n].receive_cyclic_data();
       }
    }
+
+   // Receive data for the live pooled objects.
+   for ( int p = 0; p < pool_count; ++p ) {
+      object_pools[p].receive_cyclic_data();
+   }
+
+   // Compensate all the batched receive side lag compensation objects in
+   // one pass now that all the objects have received their data.
+   if ( !lag_comp_batches.empty() ) {
+      for ( size_t i = 0; i < lag_comp_batches.size(); ++i ) {
+         lag_comp_batches[i]->receive_lag_compensation();
+      }
+      for ( int n = 0; n < obj_count; ++n ) {
+         objects[n].end_batched_receive();
+      }
+   }
 }
 
 /*!
@@ -2439,6 +3307,8 @@ void Manager::receive_cyclic_data()
  */
 void Manager::process_interactions()
 {
+   FrameProfilerScope profile_scope( federate->frame_profiler, FRAME_STAGE_PROCESS_INTERACTIONS );
+
    // Process any ExecutionControl mode transitions.
    execution_control->process_mode_interaction();
 
@@ -2516,6 +3386,8 @@ void Manager::receive_interaction(
          if ( interactions[i].is_subscribe()
               && ( interactions[i].get_class_handle() == theInteraction ) ) {
 
+            interactions[i].count_received( theParameterValues );
+
             InteractionItem *item;
             if ( received_as_TSO ) {
                item = new InteractionItem( i,
@@ -2633,24 +3505,25 @@ bool Manager::discover_object_instance(
       trickhla_obj = get_unregistered_remote_object( theObjectClass );
    }
 
-   // Determine if the discovered instance was for a data object.
-   if ( trickhla_obj != NULL ) {
-      // Set the Instance ID for the discovered object.
-      trickhla_obj->set_instance_handle_and_name( theObject, theObjectInstanceName );
-
-      // Put this discovered instance in the map of object instance handles.
-      if ( object_map.find( trickhla_obj->get_instance_handle() ) == object_map.end() ) {
-         object_map[theObject] = trickhla_obj;
+   // Otherwise bind the instance to a pooled object if there is a pool for
+   // the object class.
+   if ( trickhla_obj == NULL ) {
+      ObjectPool *pool = get_object_pool( theObjectClass );
+      if ( pool != NULL ) {
+         trickhla_obj = pool->bind_discovered_instance( theObject, theObjectInstanceName );
+
+         // The pool had no free slot, so the instance is bound from the
+         // main thread once the pool has grown.
+         if ( trickhla_obj == NULL ) {
+            return true;
+         }
       }
+   }
 
+   // Determine if the discovered instance was for a data object.
+   if ( trickhla_obj != NULL ) {
+      bind_discovered_object( trickhla_obj, theObject, theObjectInstanceName );
       return_value = true;
-
-      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
-         string id_str;
-         StringUtilities::to_string( id_str, theObject );
-         message_publish( MSG_NORMAL, "Manager::discover_object_instance():%d Data-Object '%s' Instance-ID:%s\n",
-                          __LINE__, trickhla_obj->get_name().c_str(), id_str.c_str() );
-      }
    } else if ( ( federate != NULL ) && federate->is_MOM_HLAfederate_class( theObjectClass ) ) {
 
       federate->add_federate_instance_id( theObject );
@@ -2686,30 +3559,78 @@ bool Manager::discover_object_instance(
 /*!
  * @job_class{scheduled}
  */
-Object *Manager::get_unregistered_object(
-   ObjectClassHandle const &theObjectClass,
-   wstring const           &theObjectInstanceName )
+void Manager::bind_discovered_object(
+   Object                     *obj,
+   ObjectInstanceHandle const &instance_hndl,
+   wstring const              &instance_name )
 {
-   wstring ws_obj_name;
+   // Set the Instance ID for the discovered object.
+   obj->set_instance_handle_and_name( instance_hndl, instance_name );
 
-   // Search the simulation data objects first.
-   for ( int n = 0; n < obj_count; ++n ) {
+   // Put this discovered instance in the map of object instance handles.
+   if ( object_map.find( obj->get_instance_handle() ) == object_map.end() ) {
+      object_map[instance_hndl] = obj;
+   }
 
-      // Find the object that is not registered (i.e. the instance ID == 0),
-      // has the same class handle as the one specified, and has the same name
-      // as the object instance name that is specified.
-      if ( ( objects[n].get_class_handle() == theObjectClass )
-           && ( !objects[n].is_instance_handle_valid() ) ) {
+   // Record the discovery and wake any thread waiting on it.
+   set_object_ready( obj );
 
-         StringUtilities::to_wstring( ws_obj_name, objects[n].get_name() );
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      string id_str;
+      StringUtilities::to_string( id_str, instance_hndl );
+      message_publish( MSG_NORMAL, "Manager::bind_discovered_object():%d Data-Object '%s' Instance-ID:%s\n",
+                       __LINE__, obj->get_name().c_str(), id_str.c_str() );
+   }
+}
 
-         // Determine if the name matches the object instance name.
-         if ( ws_obj_name == theObjectInstanceName ) {
-            return ( &objects[n] );
-         }
+/*!
+ * @details The pool is grown without the object discovery mutex locked,
+ * which is then held while the pending discoveries are bound so that a
+ * removal of the instance from the federation is not missed.
+ * @job_class{environment}
+ */
+void Manager::bind_pending_pool_discoveries(
+   ObjectPool &pool )
+{
+   pool.grow_free_slots();
+
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
+      ObjectInstanceHandle instance_hndl;
+      wstring              instance_name;
+
+      Object *obj = pool.bind_pending_discovery( instance_hndl, instance_name );
+      while ( obj != NULL ) {
+         bind_discovered_object( obj, instance_hndl, instance_name );
+         obj = pool.bind_pending_discovery( instance_hndl, instance_name );
       }
    }
 
+   pool.process_added_instances();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+Object *Manager::get_unregistered_object(
+   ObjectClassHandle const &theObjectClass,
+   wstring const           &theObjectInstanceName )
+{
+   // Search the simulation data objects first. Look the object up by its
+   // class handle and instance name in the discovery index instead of
+   // comparing against every object.
+   ObjectClassInstanceNameMap::const_iterator iter =
+      obj_class_name_index.find( make_pair( theObjectClass, theObjectInstanceName ) );
+
+   // Make sure the object is not registered (i.e. the instance ID == 0).
+   if ( ( iter != obj_class_name_index.end() )
+        && ( !iter->second->is_instance_handle_valid() ) ) {
+      return ( iter->second );
+   }
+
    // Check for a match with the ExecutionConfiguration object associated with
    // ExecutionControl. Returns NULL if match not found.
    return ( execution_control->get_unregistered_object( theObjectClass, theObjectInstanceName ) );
@@ -2721,19 +3642,24 @@ Object *Manager::get_unregistered_object(
 Object *Manager::get_unregistered_remote_object(
    ObjectClassHandle const &theObjectClass )
 {
-   // Search the simulation data objects first.
-   for ( int n = 0; n < obj_count; ++n ) {
-
-      // Return the first TrickHLA object that we did not create an HLA
-      // instance for, has the same class handle as the one specified, is not
-      // registered (i.e. the instance ID == 0), and does not have an Object
-      // Instance Name associated with it, and a name is not required or the
-      // user did not specify one.
-      if ( ( !objects[n].is_create_HLA_instance() )
-           && ( objects[n].get_class_handle() == theObjectClass )
-           && ( !objects[n].is_instance_handle_valid() )
-           && ( !objects[n].is_name_required() || objects[n].get_name().empty() ) ) {
-         return ( &objects[n] );
+   // Search the simulation data objects first. Return the first TrickHLA
+   // object from the free list for the class, which only holds the objects
+   // that we did not create an HLA instance for and that do not require an
+   // Object Instance Name.
+   ObjectClassIndexSetMap::iterator class_iter = unbound_remote_objs.find( theObjectClass );
+   if ( class_iter != unbound_remote_objs.end() ) {
+      set< int > &free_list = class_iter->second;
+
+      while ( !free_list.empty() ) {
+         int const n = *( free_list.begin() );
+
+         // Objects are removed from the free list lazily, so skip any object
+         // that has been registered (i.e. the instance ID != 0) since it was
+         // added to the free list.
+         if ( !objects[n].is_instance_handle_valid() ) {
+            return ( &objects[n] );
+         }
+         free_list.erase( free_list.begin() );
       }
    }
 
@@ -2747,6 +3673,8 @@ Object *Manager::get_unregistered_remote_object(
  */
 void Manager::process_ownership()
 {
+   FrameProfilerScope profile_scope( federate->frame_profiler, FRAME_STAGE_PROCESS_OWNERSHIP );
+
    // Push ownership to the other federates if the push ownership
    // flag has been enabled.
    push_ownership();
@@ -2762,6 +3690,25 @@ void Manager::process_ownership()
    grant_pull_request();
 }
 
+/*!
+ * @details The queues are recorded from the RTI callbacks only when they
+ * change, so this job keeps the rates and ages current for idle queues and
+ * publishes any backlog warnings from the main thread.
+ * @job_class{logging}
+ */
+void Manager::refresh_queue_stats()
+{
+   interactions_queue_stats.refresh();
+
+   for ( int n = 0; n < obj_count; ++n ) {
+      objects[n].refresh_queue_stats();
+   }
+
+   for ( int p = 0; p < pool_count; ++p ) {
+      object_pools[p].refresh_queue_stats();
+   }
+}
+
 void Manager::mark_object_as_deleted_from_federation(
    ObjectInstanceHandle const &instance_id )
 {
@@ -2772,6 +3719,21 @@ void Manager::mark_object_as_deleted_from_federation(
    if ( !execution_control->mark_object_as_deleted_from_federation( instance_id ) ) {
 
       Object *obj = get_trickhla_object( instance_id );
+      if ( ( obj == NULL ) && ( pool_count > 0 ) ) {
+         // The instance may be a pool discovery waiting for a free slot. With
+         // the discovery mutex locked it is either still pending or already
+         // bound to a pooled object.
+         MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
+         obj = get_trickhla_object( instance_id );
+         if ( obj == NULL ) {
+            for ( int p = 0; p < pool_count; ++p ) {
+               if ( object_pools[p].remove_pending_discovery( instance_id ) ) {
+                  break;
+               }
+            }
+         }
+      }
       if ( obj != NULL ) {
          if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
             string id_str;
@@ -2781,8 +3743,65 @@ void Manager::mark_object_as_deleted_from_federation(
                              ( instance_id.isValid() ? "Yes" : "No" ) );
          }
          obj->remove_object_instance();
+
+         // The object can be registered or discovered again, so forget
+         // when it was ready.
+         MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+         obj_ready_times.erase( obj );
+
+         // The slot of a pooled object is recycled for another instance, so
+         // drop the handle of the deleted instance from the map.
+         ObjectPool *pool = get_object_pool( obj->get_class_handle() );
+         if ( ( pool != NULL ) && pool->is_pooled_object( obj ) ) {
+            object_map.erase( instance_id );
+         }
+
+         // Return a nameless remote object to the free list of its class so
+         // that it can be bound to another discovered instance.
+         if ( ( obj >= objects ) && ( obj < ( objects + obj_count ) ) ) {
+            add_unbound_remote_object( (int)( obj - objects ) );
+         }
+      }
+   }
+}
+
+/*!
+ * @details The bytes are the encoded attribute and parameter values, without
+ * the RTI message overhead.
+ * @job_class{shutdown}
+ */
+void Manager::report_traffic()
+{
+   if ( traffic_report_count <= 0 ) {
+      return;
+   }
+
+   vector< TrafficSource > object_sources;
+   vector< TrafficSource > attribute_sources;
+   vector< TrafficSource > interaction_sources;
+
+   for ( int i = 0; i < obj_count; ++i ) {
+      add_object_traffic( object_sources, attribute_sources, objects[i] );
+   }
+   for ( int p = 0; p < pool_count; ++p ) {
+      for ( unsigned int k = 0; k < object_pools[p].get_live_count(); ++k ) {
+         Object *obj = object_pools[p].get_live_object( k );
+         if ( obj != NULL ) {
+            add_object_traffic( object_sources, attribute_sources, *obj );
+         }
       }
    }
+   for ( int i = 0; i < inter_count; ++i ) {
+      interaction_sources.push_back( TrafficSource( "Interaction '" + interactions[i].get_FOM_name() + "'",
+                                                    &interactions[i].traffic ) );
+   }
+
+   ostringstream msg;
+   msg << "Manager::report_traffic():" << __LINE__ << endl;
+   report_top_traffic( msg, "objects", object_sources, (size_t)traffic_report_count );
+   report_top_traffic( msg, "attributes", attribute_sources, (size_t)traffic_report_count );
+   report_top_traffic( msg, "interactions", interaction_sources, (size_t)traffic_report_count );
+   message_publish( MSG_INFO, msg.str().c_str() );
 }
 
 /*!
@@ -2790,6 +3809,8 @@ void Manager::mark_object_as_deleted_from_federation(
  */
 void Manager::process_deleted_objects()
 {
+   FrameProfilerScope profile_scope( federate->frame_profiler, FRAME_STAGE_PROCESS_DELETED_OBJECTS );
+
    // Process ExecutionControl deletions.
    execution_control->process_deleted_objects();
 
@@ -2799,6 +3820,37 @@ void Manager::process_deleted_objects()
          objects[n].process_deleted_object();
       }
    }
+
+   // Process the deleted pooled objects and recycle their slots, then grow
+   // the pools from this main thread job and bind the pending discoveries.
+   for ( int p = 0; p < pool_count; ++p ) {
+      object_pools[p].process_deleted_objects();
+      bind_pending_pool_discoveries( object_pools[p] );
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+ObjectPool *Manager::get_object_pool(
+   ObjectClassHandle const &class_handle )
+{
+   map< ObjectClassHandle, ObjectPool * >::const_iterator iter = obj_pool_class_map.find( class_handle );
+   return ( ( iter != obj_pool_class_map.end() ) ? iter->second : NULL );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+ObjectPool *Manager::get_object_pool(
+   string const &class_FOM_name )
+{
+   for ( int p = 0; p < pool_count; ++p ) {
+      if ( object_pools[p].get_FOM_name() == class_FOM_name ) {
+         return ( &object_pools[p] );
+      }
+   }
+   return NULL;
 }
 
 /*!
@@ -3033,6 +4085,19 @@ bool Manager::is_RTI_ready(
  */
 void Manager::convert_data_before_checkpoint()
 {
+   // The pooled objects are not saved in the checkpoint.
+   for ( int p = 0; p < pool_count; ++p ) {
+      if ( ( object_pools[p].get_live_count() > 0 ) || ( object_pools[p].get_pending_count() > 0 ) ) {
+         ostringstream errmsg;
+         errmsg << "Manager::convert_data_before_checkpoint():" << __LINE__
+                << " ERROR: Object pool '" << object_pools[p].get_FOM_name()
+                << "' has " << object_pools[p].get_live_count() << " live and "
+                << object_pools[p].get_pending_count() << " pending instances,"
+                << " but pooled objects do not support checkpoint and restore." << endl;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+   }
+
    // Call the ExecutionControl method.
    execution_control->convert_data_before_checkpoint();
 
@@ -3229,11 +4294,14 @@ void Manager::print_converted_interactions_checkpoint()
 
 /*!
  * @details Calling this function will block until object instances have been
- * discovered.
+ * discovered. The wait is woken by the discovery callbacks once enough of
+ * the required objects have been discovered.
  * @job_class{initialization}
  */
 void Manager::wait_for_discovery_of_objects()
 {
+   StartupProfilerScope profile_scope( "Manager::wait_for_discovery_of_objects", "wait" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
       message_publish( MSG_NORMAL, "Manager::wait_for_discovery_of_object_instance():%d\n",
                        __LINE__ );
@@ -3246,16 +4314,29 @@ void Manager::wait_for_discovery_of_objects()
       int  required_count                   = 0;
       int  discovery_count                  = 0;
       bool create_HLA_instance_object_found = false;
-      for ( int n = 0; n < obj_count; ++n ) {
-         if ( objects[n].is_required() ) {
-            ++required_count;
-         }
-         if ( objects[n].is_instance_handle_valid() ) {
-            ++discovery_count;
-            if ( objects[n].is_create_HLA_instance() ) {
-               create_HLA_instance_object_found = true;
+      {
+         // When auto_unlock_mutex goes out of scope it automatically unlocks
+         // the mutex even if there is an exception.
+         MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
+         for ( int n = 0; n < obj_count; ++n ) {
+            if ( objects[n].is_required() ) {
+               ++required_count;
+            }
+            if ( objects[n].is_instance_handle_valid() ) {
+               ++discovery_count;
+               if ( objects[n].is_create_HLA_instance() ) {
+                  create_HLA_instance_object_found = true;
+               }
             }
          }
+
+         // The discovery callbacks count down the required objects we are
+         // still waiting on, which does not include the one for a rejoining
+         // federate until it is found.
+         int const pending_count = ( create_HLA_instance_object_found ? required_count : ( required_count - 1 ) )
+                                   - discovery_count;
+         required_objects_latch.reset( ( pending_count > 0 ) ? pending_count : 0 );
       }
 
       // If all of the required objects were discovered, exit immediately.
@@ -3275,9 +4356,10 @@ void Manager::wait_for_discovery_of_objects()
                              __LINE__ );
          }
 
-         int64_t      wallclock_time; // cppcheck-suppress [variableScope,unmatchedSuppression]
-         SleepTimeout print_timer( federate->wait_status_time );
-         SleepTimeout sleep_timer;
+         int64_t       wallclock_time; // cppcheck-suppress [variableScope,unmatchedSuppression]
+         SleepTimeout  print_timer( federate->wait_status_time );
+         SleepTimeout  sleep_timer;
+         int64_t const wait_start_time = SleepTimeout::time();
 
          // Block until some or all objects arrive.
          do {
@@ -3285,44 +4367,78 @@ void Manager::wait_for_discovery_of_objects()
             // Check for shutdown.
             federate->check_for_shutdown_with_termination();
 
-            // Sleep for a little while to allow the RTI to trigger the object
-            // discovery callbacks.
-            sleep_timer.sleep();
+            // Wait for the discovery callbacks to signal that the objects we
+            // are waiting on have been discovered.
+            bool rescan = required_objects_latch.wait( THLA_DEFAULT_SLEEP_WAIT_IN_MICROS );
 
-            // To be more efficient, we get the time once and share it.
-            wallclock_time = sleep_timer.time();
+            if ( !rescan ) {
+               // To be more efficient, we get the time once and share it.
+               wallclock_time = sleep_timer.time();
 
-            if ( sleep_timer.timeout( wallclock_time ) ) {
-               sleep_timer.reset();
-               if ( !federate->is_execution_member() ) {
-                  ostringstream errmsg;
-                  errmsg << "Manager::wait_for_discovery_of_object_instance():" << __LINE__
-                         << " ERROR: Unexpectedly the Federate is no longer an execution member."
-                         << " This means we are either not connected to the"
-                         << " RTI or we are no longer joined to the federation"
-                         << " execution because someone forced our resignation at"
-                         << " the Central RTI Component (CRC) level!" << endl;
-                  DebugHandler::terminate_with_message( errmsg.str() );
-                  return;
+               if ( sleep_timer.timeout( wallclock_time ) ) {
+                  sleep_timer.reset();
+                  if ( !federate->is_execution_member() ) {
+                     ostringstream errmsg;
+                     errmsg << "Manager::wait_for_discovery_of_object_instance():" << __LINE__
+                            << " ERROR: Unexpectedly the Federate is no longer an execution member."
+                            << " This means we are either not connected to the"
+                            << " RTI or we are no longer joined to the federation"
+                            << " execution because someone forced our resignation at"
+                            << " the Central RTI Component (CRC) level!" << endl;
+                     DebugHandler::terminate_with_message( errmsg.str() );
+                     return;
+                  }
+
+                  // Periodically double check the count in case an instance
+                  // handle was set without a callback.
+                  rescan = true;
                }
-            }
 
-            if ( print_timer.timeout( wallclock_time ) ) {
-               print_timer.reset();
-               message_publish( MSG_NORMAL, "Manager::wait_for_discovery_of_object_instance():%d Waiting...\n",
-                                __LINE__ );
+               if ( print_timer.timeout( wallclock_time ) ) {
+                  print_timer.reset();
+
+                  // Show the objects we are still waiting on.
+                  ostringstream summary;
+                  summary << "Manager::wait_for_discovery_of_object_instance():" << __LINE__
+                          << " Waiting " << ( (double)( wallclock_time - wait_start_time ) / 1000000.0 )
+                          << " seconds for the discovery of:";
+                  {
+                     // When auto_unlock_mutex goes out of scope it automatically
+                     // unlocks the mutex even if there is an exception.
+                     MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
+                     for ( int n = 0; n < obj_count; ++n ) {
+                        if ( objects[n].is_required() && !objects[n].is_instance_handle_valid() ) {
+                           summary << "\n  Object instance '" << objects[n].get_name()
+                                   << "' for class '" << objects[n].get_FOM_name() << "'";
+                        }
+                     }
+                  }
+                  summary << endl;
+                  message_publish( MSG_NORMAL, summary.str().c_str() );
+               }
             }
 
-            // Check if any objects were discovered while we were sleeping.
-            discovery_count                  = 0;
-            create_HLA_instance_object_found = false;
-            for ( int n = 0; n < obj_count; ++n ) {
-               if ( objects[n].is_required() && objects[n].is_instance_handle_valid() ) {
-                  ++discovery_count;
-                  if ( objects[n].is_create_HLA_instance() ) {
-                     create_HLA_instance_object_found = true;
+            if ( rescan ) {
+               // When auto_unlock_mutex goes out of scope it automatically
+               // unlocks the mutex even if there is an exception.
+               MutexProtection auto_unlock_mutex( &obj_discovery_mutex );
+
+               // Check which objects were discovered while we were waiting.
+               discovery_count                  = 0;
+               create_HLA_instance_object_found = false;
+               for ( int n = 0; n < obj_count; ++n ) {
+                  if ( objects[n].is_required() && objects[n].is_instance_handle_valid() ) {
+                     ++discovery_count;
+                     if ( objects[n].is_create_HLA_instance() ) {
+                        create_HLA_instance_object_found = true;
+                     }
                   }
                }
+
+               int const pending_count = ( create_HLA_instance_object_found ? required_count : ( required_count - 1 ) )
+                                         - discovery_count;
+               required_objects_latch.reset( ( pending_count > 0 ) ? pending_count : 0 );
             }
 
          } while ( ( !create_HLA_instance_object_found && // still missing some objects other than
@@ -3330,6 +4446,13 @@ void Manager::wait_for_discovery_of_objects()
                    ||                                    // the one for the rejoining federate, or
                    ( create_HLA_instance_object_found && // missing some other object(s) but
                      ( discovery_count < required_count ) ) ); // found the rejoining federate
+
+         // Show the slowest objects if we are debugging or if the wait was
+         // long enough that the user saw the status messages.
+         if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER )
+              || ( ( SleepTimeout::time() - wait_start_time ) >= ( federate->wait_status_time * 1000000 ) ) ) {
+            print_object_straggler_times( "Manager::wait_for_discovery_of_object_instance()" );
+         }
       }
    } else {
       if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
@@ -29,9 +29,13 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{time/Int64BaseTime.cpp}
 @trick_link_dependency{time/Int64Interval.cpp}
 @trick_link_dependency{time/Int64Time.cpp}
+@trick_link_dependency{utils/FrameProfiler.cpp}
 @trick_link_dependency{utils/MutexLock.cpp}
 @trick_link_dependency{utils/MutexProtection.cpp}
+@trick_link_dependency{utils/QueueStats.cpp}
 @trick_link_dependency{utils/SleepTimeout.cpp}
+@trick_link_dependency{utils/TrafficCounters.cpp}
+@trick_link_dependency{utils/UpdateLatencyStats.cpp}
 
 @revs_title
 @revs_begin
@@ -68,6 +72,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Federate.hh"
 #include "TrickHLA/HLAStandardSupport.hh"
 #include "TrickHLA/LagCompensation.hh"
+#include "TrickHLA/LagCompensationBatch.hh"
 #include "TrickHLA/Manager.hh"
 #include "TrickHLA/Object.hh"
 #include "TrickHLA/ObjectDeletedHandler.hh"
@@ -77,9 +82,13 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/time/Int64BaseTime.hh"
 #include "TrickHLA/time/Int64Interval.hh"
 #include "TrickHLA/time/Int64Time.hh"
+#include "TrickHLA/utils/FrameProfiler.hh"
 #include "TrickHLA/utils/MutexProtection.hh"
+#include "TrickHLA/utils/QueueStats.hh"
 #include "TrickHLA/utils/SleepTimeout.hh"
 #include "TrickHLA/utils/StringUtilities.hh"
+#include "TrickHLA/utils/TrafficCounters.hh"
+#include "TrickHLA/utils/UpdateLatencyStats.hh"
 #include "TrickHLA/utils/Utilities.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
@@ -154,6 +163,9 @@ Object::Object()
      attr_update_requested( false ),
      removed_instance( false ),
      first_blocking_cyclic_read( true ),
+     batched_send_pending( false ),
+     batched_send_update_time(),
+     batched_receive_pending( false ),
      any_attribute_FOM_specified_order( false ),
      any_attribute_timestamp_order( false ),
      pull_requested( false ),
@@ -165,15 +177,20 @@ Object::Object()
      thla_attribute_map(),
      class_handle(),
      instance_handle(),
-     elapsed_time_stats()
+     traffic(),
+     reflected_queue_stats(),
+     elapsed_time_stats(),
+     update_latency()
 {
-#ifdef TRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS
-   this->send_count    = 0;
-   this->receive_count = 0;
+#ifdef TRICKHLA_CYCLIC_READ_TIME_STATS
+   // Measure the cyclic read times for all objects by default.
+   elapsed_time_stats.enabled = true;
 #endif
 
    // Make sure we allocate the map.
    this->attribute_values_map = new AttributeHandleValueMap();
+
+   reflected_attributes_queue.set_stats( &reflected_queue_stats );
 }
 
 /*!
@@ -240,6 +257,9 @@ void Object::initialize(
    }
    this->manager = trickhla_mgr;
 
+   // Latch the update latency measurement setting for the run.
+   update_latency.initialize();
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_OBJECT ) ) {
       ostringstream msg;
       msg << "Object::initialize():" << __LINE__
@@ -558,6 +578,8 @@ void Object::initialize(
       deleted->initialize_callback( this );
    }
 
+   set_queue_stats_names();
+
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 }
 
@@ -755,6 +777,20 @@ void Object::process_deleted_object()
    }
 }
 
+void Object::reset_removed_object_instance()
+{
+   this->process_object_deleted_from_RTI = false;
+   this->object_deleted_from_RTI         = false;
+   this->removed_instance                = false;
+   this->name_registered                 = false;
+   this->attr_update_requested           = false;
+
+   // Drop any data reflected for the previous object instance.
+   reflected_attributes_queue.clear();
+   update_latency.clear_pending();
+   mark_unchanged();
+}
+
 /*!
  * @details Turns off the local flag for all attributes in this object. This
  * is needed so when an object pushed the ownership of its attributes and
@@ -2119,9 +2155,7 @@ Object '%s', Timestamp Order (TSO) Attribute update, HLA Logical Time:%f seconds
                                             *attribute_values_map,
                                             TrickHLA::EMPTY_USER_SUPPLIED_TAG );
          }
-#ifdef TRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS
-         ++send_count;
-#endif
+         count_sent_attribute_values();
       }
    } catch ( InvalidLogicalTime const &e ) {
       string id_str;
@@ -2290,6 +2324,46 @@ void Object::send_cyclic_and_requested_data(
       return;
    }
 
+   // For batched send side lag compensation we add this object to the batch
+   // and defer the send until the Manager has compensated the whole batch.
+   if ( ( lag_comp != NULL )
+        && ( lag_comp_type == LAG_COMPENSATION_SEND_SIDE )
+        && lag_comp->is_batched() ) {
+
+      // Hold the send mutex until the object is sent so the batched
+      // compensation runs under the same lock as the per-object path.
+      send_mutex.lock();
+
+      lag_comp->get_batch()->add_send_lag_compensation( lag_comp );
+
+      this->batched_send_update_time = update_time;
+      this->batched_send_pending     = true;
+      return;
+   }
+
+   pack_and_send_cyclic_and_requested_data( update_time );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void Object::send_batched_cyclic_and_requested_data()
+{
+   if ( batched_send_pending ) {
+      this->batched_send_pending = false;
+      pack_and_send_cyclic_and_requested_data( batched_send_update_time );
+
+      // Release the send mutex locked when the object was added to the batch.
+      send_mutex.unlock();
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void Object::pack_and_send_cyclic_and_requested_data(
+   Int64Time const &update_time )
+{
    // Macro to save the FPU Control Word register value.
    TRICKHLA_SAVE_FPU_CONTROL_WORD;
 
@@ -2301,7 +2375,11 @@ void Object::send_cyclic_and_requested_data(
    if ( lag_comp != NULL ) {
       switch ( lag_comp_type ) {
          case LAG_COMPENSATION_SEND_SIDE: {
-            lag_comp->send_lag_compensation();
+            // A batched lag compensation instance was already compensated
+            // by the Manager along with the rest of its batch.
+            if ( !lag_comp->is_batched() ) {
+               lag_comp->send_lag_compensation();
+            }
             break;
          }
          case LAG_COMPENSATION_RECEIVE_SIDE: {
@@ -2320,19 +2398,23 @@ void Object::send_cyclic_and_requested_data(
       }
    }
 
-   // If we have a data packing object then pack the data now.
-   if ( packing != NULL ) {
-      packing->pack();
-   }
+   Federate *federate = get_federate();
+
+   {
+      FrameProfilerScope encode_scope( federate->frame_profiler, FRAME_STAGE_ENCODE );
 
-   // Create the map of "cyclic" and requested attribute values we will be updating.
-   create_attribute_set( CONFIG_CYCLIC, true );
+      // If we have a data packing object then pack the data now.
+      if ( packing != NULL ) {
+         packing->pack();
+      }
+
+      // Create the map of "cyclic" and requested attribute values we will be updating.
+      create_attribute_set( CONFIG_CYCLIC, true );
+   }
 
    // Make sure we don't send an empty attribute map to the other federates.
    if ( !attribute_values_map->empty() ) {
 
-      Federate *federate = get_federate();
-
       // The message will only be sent as TSO if our Federate is in the HLA Time
       // Regulating state and we have at least one attribute with a preferred
       // timestamp order. Assumes the FOM specified order is TSO.
@@ -2346,6 +2428,8 @@ void Object::send_cyclic_and_requested_data(
          // IEEE-1516.1-2010 sections 4.12, 4.20)
          if ( federate->should_publish_data() ) {
 
+            FrameProfilerScope send_scope( federate->frame_profiler, FRAME_STAGE_RTI_SEND );
+
             RTIambassador *rti_amb = get_RTI_ambassador();
 
             if ( send_with_timestamp ) {
@@ -2359,7 +2443,7 @@ Object '%s', Timestamp Order (TSO) Attribute update, HLA Logical Time:%f seconds
                // Send as Timestamp Order
                rti_amb->updateAttributeValues( this->instance_handle,
                                                *attribute_values_map,
-                                               TrickHLA::EMPTY_USER_SUPPLIED_TAG,
+                                               get_update_user_supplied_tag(),
                                                update_time.get() );
             } else {
                if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
@@ -2370,11 +2454,9 @@ Object '%s', Timestamp Order (TSO) Attribute update, HLA Logical Time:%f seconds
                // Send as Receive Order (i.e. with no timestamp).
                rti_amb->updateAttributeValues( this->instance_handle,
                                                *attribute_values_map,
-                                               TrickHLA::EMPTY_USER_SUPPLIED_TAG );
+                                               get_update_user_supplied_tag() );
             }
-#ifdef TRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS
-            ++send_count;
-#endif
+            count_sent_attribute_values();
          }
       } catch ( InvalidLogicalTime const &e ) {
          string id_str;
@@ -2629,7 +2711,7 @@ Object '%s', Timestamp Order (TSO) Attribute update, HLA Logical Time:%f seconds
                // Send as Timestamp Order
                rti_amb->updateAttributeValues( this->instance_handle,
                                                *attribute_values_map,
-                                               TrickHLA::EMPTY_USER_SUPPLIED_TAG,
+                                               get_update_user_supplied_tag(),
                                                update_time.get() );
             } else {
                if ( DebugHandler::show( DEBUG_LEVEL_7_TRACE, DEBUG_SOURCE_OBJECT ) ) {
@@ -2641,11 +2723,9 @@ Object '%s', Receive Order (RO) Attribute update.\n",
                // Send as Receive Order (i.e. with no timestamp).
                rti_amb->updateAttributeValues( this->instance_handle,
                                                *attribute_values_map,
-                                               TrickHLA::EMPTY_USER_SUPPLIED_TAG );
+                                               get_update_user_supplied_tag() );
             }
-#ifdef TRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS
-            ++send_count;
-#endif
+            count_sent_attribute_values();
          }
       } catch ( InvalidLogicalTime const &e ) {
          string id_str;
@@ -2891,9 +2971,7 @@ Object '%s', Receive Order (RO) Attribute update.\n",
                                             *attribute_values_map,
                                             TrickHLA::EMPTY_USER_SUPPLIED_TAG );
 
-#ifdef TRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS
-            ++send_count;
-#endif
+            count_sent_attribute_values();
          }
       } catch ( InvalidLogicalTime const &e ) {
          string id_str;
@@ -3034,6 +3112,19 @@ exception for '%s' with error message '%s'.\n",
    TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
 }
 
+/*!
+ * @job_class{scheduled}
+ */
+void Object::refresh_queue_stats()
+{
+   reflected_queue_stats.refresh();
+
+   if ( ownership != NULL ) {
+      ownership->pull_stats.refresh();
+      ownership->push_stats.refresh();
+   }
+}
+
 /*!
  * @details If the object is owned remotely, this function copies its internal
  * data into simulation object and marks the object as "unchanged". This data
@@ -3110,11 +3201,12 @@ void Object::receive_cyclic_data()
    }
 
    // Process the data now that it has been received (i.e. changed).
-   if ( is_changed() ) {
+   bool const data_received = is_changed();
+   if ( data_received ) {
 
-#ifdef TRICKHLA_CYCLIC_READ_TIME_STATS
-      elapsed_time_stats.measure();
-#endif
+      if ( elapsed_time_stats.is_enabled() ) {
+         elapsed_time_stats.measure();
+      }
 
       do {
 #if THLA_OBJ_DEBUG_RECEIVE
@@ -3131,7 +3223,19 @@ void Object::receive_cyclic_data()
          if ( lag_comp != NULL ) {
             switch ( lag_comp_type ) {
                case LAG_COMPENSATION_RECEIVE_SIDE: {
-                  lag_comp->receive_lag_compensation();
+                  if ( lag_comp->is_batched() && !any_queued_reflected_attributes() ) {
+                     // The Manager compensates the whole batch once all
+                     // the objects have received their data. The data stays
+                     // marked as changed until end_batched_receive() so the
+                     // batch still sees which attributes were received.
+                     lag_comp->get_batch()->add_receive_lag_compensation( lag_comp );
+                     this->batched_receive_pending = true;
+                  } else {
+                     // Earlier updates queued for the object in this frame
+                     // are compensated one at a time, which gives the same
+                     // result as the batch for the closed-form compensation.
+                     lag_comp->receive_lag_compensation();
+                  }
                   break;
                }
                case LAG_COMPENSATION_SEND_SIDE: {
@@ -3150,6 +3254,11 @@ void Object::receive_cyclic_data()
             }
          }
 
+         // The last update is marked as unchanged once its batch is done.
+         if ( batched_receive_pending ) {
+            break;
+         }
+
          // Mark this data as unchanged now that we have processed it from the buffer.
          mark_unchanged();
 
@@ -3169,6 +3278,27 @@ void Object::receive_cyclic_data()
                        __LINE__, get_name().c_str(), get_federate()->get_granted_time().get_time_in_seconds() );
    }
 #endif
+
+   // Let the receive side lag compensation keep updating the state in the
+   // frames without new data, such as to play it back from a history.
+   if ( !data_received
+        && ( lag_comp != NULL )
+        && ( lag_comp_type == LAG_COMPENSATION_RECEIVE_SIDE ) ) {
+      lag_comp->idle_receive_lag_compensation();
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void Object::end_batched_receive()
+{
+   if ( batched_receive_pending ) {
+      this->batched_receive_pending = false;
+
+      // Mark this data as unchanged now that the batch has processed it.
+      mark_unchanged();
+   }
 }
 
 /*!
@@ -3373,9 +3503,7 @@ void Object::send_init_data()
          rti_amb->updateAttributeValues( this->instance_handle,
                                          *attribute_values_map,
                                          TrickHLA::EMPTY_USER_SUPPLIED_TAG );
-#ifdef TRICKHLA_CHECK_SEND_AND_RECEIVE_COUNTS
-         ++send_count;
-#endif
+         count_sent_attribute_values();
       }
    } catch ( InvalidLogicalTime const &e ) {
       string id_str;
@@ -3699,13 +3827,61 @@ void Object::create_attribute_set(
  * @job_class{scheduled}
  */
 void Object::enqueue_data(
-   AttributeHandleValueMap const &theAttributes )
+   AttributeHandleValueMap const &theAttributes,
+   VariableLengthData const      &user_supplied_tag )
 {
    // When auto_unlock_mutex goes out of scope it automatically unlocks the
    // mutex even if there is an exception.
    MutexProtection auto_unlock_mutex( &receive_mutex );
 
    reflected_attributes_queue.push( theAttributes );
+
+   // Count the object and its attributes at the same point so they agree.
+   uint64_t                                bytes = 0;
+   AttributeHandleValueMap::const_iterator iter;
+   for ( iter = theAttributes.begin(); iter != theAttributes.end(); ++iter ) {
+      bytes += iter->second.size();
+
+      Attribute *attr = get_attribute( iter->first );
+      if ( attr != NULL ) {
+         attr->traffic.add_received( 1, iter->second.size() );
+      }
+   }
+   traffic.add_received( theAttributes.size(), bytes );
+
+   if ( update_latency.is_enabled() ) {
+      update_latency.reflected( user_supplied_tag.data(), user_supplied_tag.size() );
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void Object::count_sent_attribute_values()
+{
+   uint64_t                                bytes = 0;
+   AttributeHandleValueMap::const_iterator iter;
+   for ( iter = attribute_values_map->begin(); iter != attribute_values_map->end(); ++iter ) {
+      bytes += iter->second.size();
+
+      Attribute *attr = get_attribute( iter->first );
+      if ( attr != NULL ) {
+         attr->traffic.add_sent( 1, iter->second.size() );
+      }
+   }
+   traffic.add_sent( attribute_values_map->size(), bytes );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+VariableLengthData const Object::get_update_user_supplied_tag()
+{
+   if ( !update_latency.is_enabled() ) {
+      return TrickHLA::EMPTY_USER_SUPPLIED_TAG;
+   }
+   return VariableLengthData( update_latency.build_send_tag( get_federate()->get_federate_name() ),
+                              THLA_UPDATE_LATENCY_TAG_SIZE );
 }
 
 /*!
@@ -4044,6 +4220,7 @@ owned or is not configured to be published.\n",
             // Erase the Attribute Map for the given pull-time from the pull
             // requests now that we have processed it.
             ownership->pull_requests.erase( pull_time );
+            ownership->pull_stats.record_depth( ownership->pull_requests.size() );
 
             // Point to the start of the iterator since we just erased an entry.
             pull_ownership_iter = ownership->pull_requests.begin();
@@ -4867,6 +5044,7 @@ owned or is not configured to be published.\n",
             // Erase the Attribute Map for the given push-time from the push
             // requests now that we have processed it.
             ownership->push_requests.erase( push_time );
+            ownership->push_stats.record_depth( ownership->push_requests.size() );
 
             // Point to the start of the iterator since we just deleted an item.
             push_ownership_iter = ownership->push_requests.begin();
@@ -5238,6 +5416,16 @@ void Object::set_name(
 {
    // Make a copy.
    this->name = string( new_name );
+
+   set_queue_stats_names();
+}
+
+void Object::set_queue_stats_names()
+{
+   reflected_queue_stats.set_name( name + " reflected attributes" );
+   if ( ownership != NULL ) {
+      ownership->set_stats_names();
+   }
 }
 
 void Object::build_attribute_map()
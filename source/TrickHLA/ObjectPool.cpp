@@ -0,0 +1,836 @@
+/*!
+@file TrickHLA/ObjectPool.cpp
+@ingroup TrickHLA
+@brief This class is a growable pool of TrickHLA Objects for the instances of
+a FOM object class that come and go at runtime.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{ObjectPool.cpp}
+@trick_link_dependency{Attribute.cpp}
+@trick_link_dependency{Manager.cpp}
+@trick_link_dependency{Object.cpp}
+@trick_link_dependency{time/Int64Time.cpp}
+@trick_link_dependency{utils/MutexLock.cpp}
+@trick_link_dependency{utils/MutexProtection.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System includes.
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Trick includes.
+#include "trick/attributes.h"
+#include "trick/memorymanager_c_intf.h"
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+#include "trick/reference.h"
+
+// TrickHLA includes.
+#include "TrickHLA/Attribute.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Federate.hh"
+#include "TrickHLA/HLAStandardSupport.hh"
+#include "TrickHLA/Manager.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/ObjectPool.hh"
+#include "TrickHLA/Types.hh"
+#include "TrickHLA/time/Int64Time.hh"
+#include "TrickHLA/utils/MutexLock.hh"
+#include "TrickHLA/utils/MutexProtection.hh"
+#include "TrickHLA/utils/StringUtilities.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wdeprecated"
+#endif
+
+// HLA include files.
+#include "RTI/Exception.h"
+#include "RTI/Handle.h"
+#include "RTI/RTIambassador.h"
+
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic pop
+#endif
+
+using namespace RTI1516_NAMESPACE;
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+ObjectPool::ObjectPool()
+   : FOM_name(),
+     data_type(),
+     attr_count( 0 ),
+     attributes( NULL ),
+     initial_capacity( 1 ),
+     min_free_slots( 1 ),
+     manager( NULL ),
+     pool_index( 0 ),
+     core_job_cycle_time( 0.0 ),
+     class_handle(),
+     slots(),
+     slot_data(),
+     free_slots(),
+     live_slots(),
+     added_slots(),
+     live_objects(),
+     slot_index_map(),
+     pending_discoveries(),
+     attr_types(),
+     attr_offsets(),
+     pool_mutex()
+{
+   return;
+}
+
+/*!
+ * @details The pooled objects and their simulation data are Trick allocated
+ * and are freed by the Trick memory manager.
+ * @job_class{shutdown}
+ */
+ObjectPool::~ObjectPool()
+{
+   slots.clear();
+   slot_data.clear();
+   free_slots.clear();
+   live_slots.clear();
+   added_slots.clear();
+   live_objects.clear();
+   slot_index_map.clear();
+   pending_discoveries.clear();
+   attr_types.clear();
+   attr_offsets.clear();
+
+   // Make sure we destroy the mutex.
+   pool_mutex.destroy();
+}
+
+/*!
+ * @details The pooled objects are set up by the pool, so they never have
+ * packing, lag compensation, ownership transfer, conditional or deleted
+ * handlers, and they are not saved in a checkpoint.
+ * @job_class{initialization}
+ */
+void ObjectPool::initialize(
+   Manager  *trickhla_mgr,
+   int const index )
+{
+   if ( trickhla_mgr == NULL ) {
+      ostringstream errmsg;
+      errmsg << "ObjectPool::initialize():" << __LINE__
+             << " ERROR: Unexpected NULL TrickHLA-Manager!" << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   this->manager    = trickhla_mgr;
+   this->pool_index = index;
+
+   // Make sure we have a valid object FOM name.
+   if ( FOM_name.empty() ) {
+      ostringstream errmsg;
+      errmsg << "ObjectPool::initialize():" << __LINE__
+             << " ERROR: THLA.manager.object_pools[" << index << "] is missing"
+             << " the Object FOM Name. Please check your input or modified-data"
+             << " files to make sure the 'FOM_name' is correctly specified." << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // Make sure we know what simulation data to allocate for an instance.
+   if ( data_type.empty() ) {
+      ostringstream errmsg;
+      errmsg << "ObjectPool::initialize():" << __LINE__
+             << " ERROR: For object pool '" << FOM_name << "', the 'data_type'"
+             << " is not specified. Please check your input or modified-data"
+             << " files to make sure the Trick type name of the simulation"
+             << " data for an instance is correctly specified." << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   if ( ( attr_count <= 0 ) || ( attributes == NULL ) ) {
+      ostringstream errmsg;
+      errmsg << "ObjectPool::initialize():" << __LINE__
+             << " ERROR: For object pool '" << FOM_name << "', the 'attr_count' is "
+             << attr_count << " and the 'attributes' are "
+             << ( ( attributes == NULL ) ? "not " : "" ) << "specified. Please"
+             << " check your input or modified-data files to make sure the"
+             << " template attributes are correctly specified." << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   for ( int i = 0; i < attr_count; ++i ) {
+      // The Trick name of a template attribute is relative to the simulation
+      // data of an instance, which a fixed record can not be.
+      if ( attributes[i].rti_encoding == ENCODING_FIXED_RECORD ) {
+         ostringstream errmsg;
+         errmsg << "ObjectPool::initialize():" << __LINE__
+                << " ERROR: For object pool '" << FOM_name << "', the template"
+                << " attribute '" << attributes[i].get_FOM_name() << "' uses the"
+                << " ENCODING_FIXED_RECORD encoding, which is not supported for"
+                << " pooled objects." << endl;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+      if ( attributes[i].get_trick_name().empty() ) {
+         ostringstream errmsg;
+         errmsg << "ObjectPool::initialize():" << __LINE__
+                << " ERROR: For object pool '" << FOM_name << "', the template"
+                << " attribute at array index " << i << " is missing the Trick"
+                << " name relative to the '" << data_type << "' data type." << endl;
+         DebugHandler::terminate_with_message( errmsg.str() );
+      }
+   }
+
+   if ( initial_capacity < 1 ) {
+      this->initial_capacity = 1;
+   }
+   if ( min_free_slots < 1 ) {
+      this->min_free_slots = 1;
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      message_publish( MSG_NORMAL, "ObjectPool::initialize():%d Pool '%s' of '%s' data with %d attributes.\n",
+                       __LINE__, FOM_name.c_str(), data_type.c_str(), attr_count );
+   }
+}
+
+/*!
+ * @details At least one slot is always allocated since the class publication
+ * and subscription are declared through the first slot.
+ * @job_class{initialization}
+ */
+void ObjectPool::allocate_initial_slots()
+{
+   while ( slots.size() < (size_t)initial_capacity ) {
+      allocate_slot();
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void ObjectPool::set_core_job_cycle_time(
+   double const cycle_time )
+{
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+
+   this->core_job_cycle_time = cycle_time;
+   for ( size_t n = 0; n < slots.size(); ++n ) {
+      slots[n]->set_core_job_cycle_time( cycle_time );
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void ObjectPool::publish_object_attributes()
+{
+   if ( !slots.empty() ) {
+      slots[0]->publish_object_attributes();
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void ObjectPool::unpublish_all_object_attributes()
+{
+   if ( !slots.empty() && slots[0]->any_attribute_published() ) {
+      slots[0]->unpublish_all_object_attributes();
+   }
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void ObjectPool::subscribe_to_object_attributes()
+{
+   if ( !slots.empty() ) {
+      slots[0]->subscribe_to_object_attributes();
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void ObjectPool::unsubscribe_all_object_attributes()
+{
+   if ( !slots.empty() && slots[0]->any_attribute_subscribed() ) {
+      slots[0]->unsubscribe_all_object_attributes();
+   }
+}
+
+/*!
+ * @details Called from the discover object instance callback, with the
+ * Manager object discovery mutex locked. The pool is never grown from the
+ * callback thread.
+ * @job_class{scheduled}
+ */
+Object *ObjectPool::bind_discovered_instance(
+   ObjectInstanceHandle const &instance_hndl,
+   wstring const              &instance_name )
+{
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+
+   // Keep the order of the discoveries if some are already pending.
+   if ( free_slots.empty() || !pending_discoveries.empty() ) {
+      pending_discoveries.push_back( make_pair( instance_hndl, instance_name ) );
+
+      if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+         message_publish( MSG_NORMAL, "ObjectPool::bind_discovered_instance():%d Pool '%s' has no free slot, pending:%d slots:%d\n",
+                          __LINE__, FOM_name.c_str(), (int)pending_discoveries.size(),
+                          (int)slots.size() );
+      }
+      return NULL;
+   }
+
+   size_t const n = acquire_slot( false );
+   added_slots.push_back( n );
+
+   return slots[n];
+}
+
+/*!
+ * @job_class{environment}
+ */
+Object *ObjectPool::bind_pending_discovery(
+   ObjectInstanceHandle &instance_hndl,
+   wstring              &instance_name )
+{
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+
+   if ( pending_discoveries.empty() || free_slots.empty() ) {
+      return NULL;
+   }
+
+   instance_hndl = pending_discoveries.front().first;
+   instance_name = pending_discoveries.front().second;
+   pending_discoveries.pop_front();
+
+   size_t const n = acquire_slot( false );
+   added_slots.push_back( n );
+
+   return slots[n];
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+bool ObjectPool::remove_pending_discovery(
+   ObjectInstanceHandle const &instance_hndl )
+{
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+
+   deque< pair< ObjectInstanceHandle, wstring > >::iterator iter;
+   for ( iter = pending_discoveries.begin(); iter != pending_discoveries.end(); ++iter ) {
+      if ( iter->first == instance_hndl ) {
+         pending_discoveries.erase( iter );
+         return true;
+      }
+   }
+   return false;
+}
+
+/*!
+ * @job_class{environment}
+ */
+void ObjectPool::grow_free_slots()
+{
+   size_t needed;
+   size_t available;
+   {
+      MutexProtection auto_unlock_mutex( &pool_mutex );
+
+      needed    = pending_discoveries.size() + (size_t)min_free_slots;
+      available = free_slots.size();
+   }
+
+   // The slots are allocated without the mutex locked so that the discovery
+   // callbacks are not held up by the allocation.
+   for ( ; available < needed; ++available ) {
+      allocate_slot();
+   }
+}
+
+/*!
+ * @job_class{environment}
+ */
+void ObjectPool::process_added_instances()
+{
+   vector< size_t > added;
+   {
+      MutexProtection auto_unlock_mutex( &pool_mutex );
+      added.swap( added_slots );
+   }
+
+   for ( size_t k = 0; k < added.size(); ++k ) {
+      instance_added( slots[added[k]], slot_data[added[k]] );
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+Object *ObjectPool::create_local_instance()
+{
+   Object *obj  = NULL;
+   void   *data = NULL;
+   while ( obj == NULL ) {
+      {
+         MutexProtection auto_unlock_mutex( &pool_mutex );
+
+         if ( !free_slots.empty() ) {
+            size_t const n = acquire_slot( true );
+            obj            = slots[n];
+            data           = slot_data[n];
+         }
+      }
+
+      // This is a main thread job, so grow the pool if a discovery took the
+      // last free slot.
+      if ( obj == NULL ) {
+         allocate_slot();
+      }
+   }
+
+   instance_added( obj, data );
+
+   // Register the instance, which uses the object instance name the RTI
+   // assigns since the name is not required for a pooled object.
+   obj->register_object_with_RTI();
+
+   if ( obj->is_instance_handle_valid() ) {
+      manager->add_object_to_map( obj );
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      message_publish( MSG_NORMAL, "ObjectPool::create_local_instance():%d Pool '%s' registered '%s', live:%d slots:%d\n",
+                       __LINE__, FOM_name.c_str(), obj->get_name().c_str(),
+                       (int)get_live_count(), (int)get_slot_count() );
+   }
+
+   return obj;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void ObjectPool::delete_local_instance(
+   Object *obj )
+{
+   if ( !is_pooled_object( obj ) || !obj->is_create_HLA_instance()
+        || !obj->is_instance_handle_valid() ) {
+      return;
+   }
+
+   Federate      *federate = manager->get_federate();
+   RTIambassador *rti_amb  = manager->get_RTI_ambassador();
+   if ( ( federate == NULL ) || ( rti_amb == NULL ) ) {
+      message_publish( MSG_WARNING, "ObjectPool::delete_local_instance():%d Unexpected NULL Federate or RTIambassador.\n",
+                       __LINE__ );
+      return;
+   }
+
+   ObjectInstanceHandle const instance_handle = obj->get_instance_handle();
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   try {
+      // Delete the object instance at a specific time if we are
+      // time-regulating.
+      if ( federate->in_time_regulating_state() ) {
+         Int64Time update_time( federate->get_granted_time() + federate->get_lookahead() );
+         rti_amb->deleteObjectInstance( instance_handle,
+                                        TrickHLA::EMPTY_USER_SUPPLIED_TAG,
+                                        update_time.get() );
+      } else {
+         rti_amb->deleteObjectInstance( instance_handle,
+                                        TrickHLA::EMPTY_USER_SUPPLIED_TAG );
+      }
+   } catch ( RTI1516_NAMESPACE::Exception const &e ) {
+      // Macro to restore the saved FPU Control Word register value.
+      TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+      TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      ostringstream errmsg;
+      errmsg << "ObjectPool::delete_local_instance():" << __LINE__
+             << " Object '" << obj->get_name() << "'"
+             << " Exception: " << rti_err_msg << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+   // The owner of the instance does not get a remove callback, so mark the
+   // instance as deleted here so that process_deleted_objects() recycles it.
+   manager->mark_object_as_deleted_from_federation( instance_handle );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void ObjectPool::send_cyclic_and_requested_data(
+   Int64Time const &update_time )
+{
+   copy_live_objects();
+
+   for ( size_t k = 0; k < live_objects.size(); ++k ) {
+      if ( live_objects[k]->is_instance_handle_valid() ) {
+         live_objects[k]->send_cyclic_and_requested_data( update_time );
+      }
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void ObjectPool::receive_cyclic_data()
+{
+   copy_live_objects();
+
+   for ( size_t k = 0; k < live_objects.size(); ++k ) {
+      if ( live_objects[k]->is_instance_handle_valid() ) {
+         live_objects[k]->receive_cyclic_data();
+      }
+   }
+}
+
+/*!
+ * @job_class{logging}
+ */
+void ObjectPool::refresh_queue_stats()
+{
+   copy_live_objects();
+
+   for ( size_t k = 0; k < live_objects.size(); ++k ) {
+      live_objects[k]->refresh_queue_stats();
+   }
+}
+
+/*!
+ * @details The discovery callbacks only bind free slots, and the live slots
+ * are only recycled by process_deleted_objects() on the main thread, so the
+ * copied objects stay bound while the main thread jobs work on them without
+ * holding the pool mutex across the RTI calls.
+ * @job_class{scheduled}
+ */
+void ObjectPool::copy_live_objects()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+
+   live_objects.clear();
+   for ( size_t k = 0; k < live_slots.size(); ++k ) {
+      live_objects.push_back( slots[live_slots[k]] );
+   }
+}
+
+/*!
+ * @job_class{logging}
+ */
+void ObjectPool::process_deleted_objects()
+{
+   // Pass on the instances discovered since the last frame first, so that an
+   // instance is always added before it is deleted.
+   process_added_instances();
+
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+
+   // Iterate backwards since a recycled slot is swapped with the last live slot.
+   for ( size_t k = live_slots.size(); k > 0; --k ) {
+      size_t const n   = live_slots[k - 1];
+      Object      *obj = slots[n];
+
+      if ( obj->process_object_deleted_from_RTI ) {
+         obj->process_deleted_object();
+
+         instance_deleted( obj, slot_data[n] );
+
+         // Remove the slot from the live slots and return it to the pool.
+         live_slots[k - 1] = live_slots.back();
+         live_slots.pop_back();
+         free_slots.push_back( n );
+
+         if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+            message_publish( MSG_NORMAL, "ObjectPool::process_deleted_objects():%d Pool '%s' recycled slot %d, live:%d slots:%d\n",
+                             __LINE__, FOM_name.c_str(), (int)n,
+                             (int)live_slots.size(), (int)slots.size() );
+         }
+      }
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+bool ObjectPool::is_pooled_object(
+   Object const *obj )
+{
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+   return ( slot_index_map.find( obj ) != slot_index_map.end() );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+unsigned int ObjectPool::get_live_count()
+{
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+   return live_slots.size();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+unsigned int ObjectPool::get_slot_count()
+{
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+   return slots.size();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+unsigned int ObjectPool::get_pending_count()
+{
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+   return pending_discoveries.size();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+Object *ObjectPool::get_live_object(
+   unsigned int const index )
+{
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+   return ( ( index < live_slots.size() ) ? slots[live_slots[index]] : NULL );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void *ObjectPool::get_instance_data(
+   Object const *obj )
+{
+   MutexProtection auto_unlock_mutex( &pool_mutex );
+
+   map< Object const *, size_t >::const_iterator iter = slot_index_map.find( obj );
+   return ( ( iter != slot_index_map.end() ) ? slot_data[iter->second] : NULL );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void ObjectPool::instance_added(
+   Object *obj,
+   void   *data )
+{
+   return;
+}
+
+/*!
+ * @job_class{logging}
+ */
+void ObjectPool::instance_deleted(
+   Object *obj,
+   void   *data )
+{
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+size_t ObjectPool::acquire_slot(
+   bool const local )
+{
+   size_t const n = free_slots.back();
+   free_slots.pop_back();
+
+   Object *obj = slots[n];
+
+   // Clear the state left over from any previous instance bound to the slot.
+   obj->reset_removed_object_instance();
+   obj->set_create_HLA_instance( local );
+
+   // Locally created instances own the attributes they publish.
+   Attribute *attrs = obj->get_attributes();
+   for ( int i = 0; i < attr_count; ++i ) {
+      if ( local && attrs[i].is_publish() ) {
+         attrs[i].mark_locally_owned();
+      } else {
+         attrs[i].unmark_locally_owned();
+      }
+   }
+
+   live_slots.push_back( n );
+
+   return n;
+}
+
+/*!
+ * @details A template attribute whose Trick name goes through a pointer does
+ * not have a fixed offset from the start of the simulation data, and is
+ * resolved for each instance instead.
+ * @job_class{initialization}
+ */
+void ObjectPool::resolve_class_metadata(
+   void         *data,
+   string const &var_name )
+{
+   attr_types.assign( attr_count, NULL );
+   attr_offsets.assign( attr_count, 0 );
+
+   for ( int i = 0; i < attr_count; ++i ) {
+      string const attr_trick_name = var_name + "." + attributes[i].trick_name;
+
+      REF2 *ref2 = ref_attributes( attr_trick_name.c_str() );
+      if ( ref2 == NULL ) {
+         ostringstream errmsg;
+         errmsg << "ObjectPool::resolve_class_metadata():" << __LINE__
+                << " ERROR: For object pool '" << FOM_name << "', could not"
+                << " retrieve the Trick ref-attributes for the template"
+                << " attribute '" << attributes[i].get_FOM_name() << "' with"
+                << " Trick name '" << attributes[i].trick_name << "' relative"
+                << " to the '" << data_type << "' data type." << endl;
+         DebugHandler::terminate_with_message( errmsg.str() );
+         return;
+      }
+
+      if ( ref2->pointer_present == 0 ) {
+         attr_types[i]   = ref2->attr;
+         attr_offsets[i] = static_cast< char * >( ref2->address ) - static_cast< char * >( data );
+      }
+      free( ref2 );
+   }
+}
+
+/*!
+ * @details Only the main thread adds slots, so the slot count can be read
+ * without the mutex, which is only locked to add the new slot once it is
+ * set up.
+ * @job_class{environment}
+ */
+void ObjectPool::allocate_slot()
+{
+   size_t const n = slots.size();
+
+   // Allocate the simulation data of the slot as a named Trick variable so
+   // that the attribute Trick names can be resolved against it.
+   ostringstream var_name;
+   var_name << "trickhla_object_pool_" << pool_index << "_slot_" << n;
+
+   string const declaration = data_type + " " + var_name.str();
+   void        *data        = TMM_declare_var_s( declaration.c_str() );
+   if ( data == NULL ) {
+      ostringstream errmsg;
+      errmsg << "ObjectPool::allocate_slot():" << __LINE__
+             << " ERROR: For object pool '" << FOM_name << "', failed to"
+             << " allocate the simulation data '" << declaration << "'." << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // The Trick type information is the same for every instance, so it is
+   // only resolved against the data of the first slot.
+   if ( attr_types.empty() ) {
+      resolve_class_metadata( data, var_name.str() );
+   }
+
+   Object *obj = static_cast< Object * >( TMM_declare_var_1d( "TrickHLA::Object", 1 ) );
+
+   obj->FOM_name             = FOM_name;
+   obj->name_required        = false;
+   obj->create_HLA_instance  = false;
+   obj->required             = false;
+   obj->blocking_cyclic_read = false;
+   obj->attr_count           = attr_count;
+   obj->attributes           = static_cast< Attribute * >( TMM_declare_var_1d( "TrickHLA::Attribute", attr_count ) );
+
+   for ( int i = 0; i < attr_count; ++i ) {
+      Attribute &attr = obj->attributes[i];
+
+      ostringstream config_name;
+      config_name << "THLA.manager.object_pools[" << pool_index
+                  << "].attributes[" << i << "]";
+
+      if ( attr_types[i] != NULL ) {
+         // Share the class level FOM name and type information, with only
+         // the Trick name and address of the attribute data being specific
+         // to this instance.
+         attr.initialize_instance( &attributes[i],
+                                   FOM_name,
+                                   config_name.str(),
+                                   var_name.str() + "." + attributes[i].trick_name,
+                                   static_cast< char * >( data ) + attr_offsets[i],
+                                   attr_types[i] );
+      } else {
+         // The Trick name goes through a pointer, so the address has to be
+         // resolved against the simulation data of this slot.
+         attr.FOM_name        = attributes[i].FOM_name;
+         attr.trick_name      = var_name.str() + "." + attributes[i].trick_name;
+         attr.rti_encoding    = attributes[i].rti_encoding;
+         attr.config          = attributes[i].config;
+         attr.preferred_order = attributes[i].preferred_order;
+         attr.publish         = attributes[i].publish;
+         attr.subscribe       = attributes[i].subscribe;
+         attr.cycle_time      = attributes[i].cycle_time;
+         attr.initialize( FOM_name, config_name.str() );
+         attr.set_attribute_handle( attributes[i].get_attribute_handle() );
+      }
+   }
+
+   obj->initialize( manager );
+
+   obj->set_class_handle( class_handle );
+   obj->build_attribute_map();
+
+   if ( core_job_cycle_time > 0.0 ) {
+      obj->set_core_job_cycle_time( core_job_cycle_time );
+   }
+
+   {
+      MutexProtection auto_unlock_mutex( &pool_mutex );
+
+      slots.push_back( obj );
+      slot_data.push_back( data );
+      slot_index_map[obj] = n;
+      free_slots.push_back( n );
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      message_publish( MSG_NORMAL, "ObjectPool::allocate_slot():%d Pool '%s' allocated slot %d '%s'.\n",
+                       __LINE__, FOM_name.c_str(), (int)n, var_name.str().c_str() );
+   }
+}
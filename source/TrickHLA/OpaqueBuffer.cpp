@@ -60,6 +60,7 @@ OpaqueBuffer::OpaqueBuffer()
      push_pos( 0 ),
      pull_pos( 0 ),
      capacity( 0 ),
+     data_size( 0 ),
      buffer( NULL )
 {
    // Default to a buffer capacity of 1 for now just to make sure we have
@@ -79,10 +80,11 @@ OpaqueBuffer::~OpaqueBuffer() // RETURN: -- None.
          message_publish( MSG_WARNING, "OpaqueBuffer::~OpaqueBuffer():%d WARNING failed to delete Trick Memory for 'buffer'\n",
                           __LINE__ );
       }
-      buffer   = NULL;
-      capacity = 0;
-      push_pos = 0;
-      pull_pos = 0;
+      buffer    = NULL;
+      capacity  = 0;
+      data_size = 0;
+      push_pos  = 0;
+      pull_pos  = 0;
    }
 }
 
@@ -150,6 +152,22 @@ void OpaqueBuffer::ensure_buffer_capacity(
    }
 }
 
+void OpaqueBuffer::reset_pull_position()
+{
+   this->pull_pos = 0;
+
+   // The raw data decoder resizes the Trick allocation of the buffer to the
+   // size of the received data, which can be smaller than the capacity we
+   // set up. Bound the pulls by the allocated size and keep the capacity in
+   // sync with it so a push never runs past the end of the buffer either.
+   if ( buffer != NULL ) {
+      this->data_size = (size_t)get_size( buffer );
+      this->capacity  = data_size;
+   } else {
+      this->data_size = 0;
+   }
+}
+
 void OpaqueBuffer::push_to_buffer(
    void const        *src,
    size_t const       size,
@@ -226,13 +244,14 @@ void OpaqueBuffer::pull_from_buffer(
       }
    }
 
-   // Determine if we are overflowing the capacity of the buffer.
-   if ( ( pull_pos + size ) > capacity ) {
+   // Determine if we are pulling past the end of the received data.
+   if ( ( pull_pos + size ) > data_size ) {
       ostringstream errmsg;
       errmsg << "OpaqueBuffer::pull_from_buffer():" << __LINE__
              << " ERROR: Trying to pull " << size << " bytes from the buffer at"
-             << " position " << pull_pos << ", which exceeds the end of the buffer"
-             << " by " << ( ( pull_pos + size ) - capacity ) << " bytes!" << endl;
+             << " position " << pull_pos << ", which exceeds the end of the"
+             << " received data by " << ( ( pull_pos + size ) - data_size )
+             << " bytes!" << endl;
       DebugHandler::terminate_with_message( errmsg.str() );
    }
 
@@ -255,6 +274,88 @@ void OpaqueBuffer::pull_from_buffer(
    pull_pos += size;
 }
 
+void OpaqueBuffer::push_float64_le_to_buffer(
+   double const *src,
+   size_t const  count )
+{
+   size_t const size = count * sizeof( double );
+
+   // Determine if we need to add pad bytes to achieve the desired
+   // byte alignment.
+   if ( alignment > 1 ) {
+      size_t pad_size = push_pos % alignment;
+      if ( pad_size > 0 ) {
+         push_pad_to_buffer( pad_size );
+      }
+   }
+
+   // Determine if we are overflowing the capacity of the buffer.
+   if ( ( push_pos + size ) > capacity ) {
+      ostringstream errmsg;
+      errmsg << "OpaqueBuffer::push_float64_le_to_buffer():" << __LINE__
+             << " WARNING: Trying to push " << size << " bytes into the buffer at"
+             << " position " << push_pos << ", which exceeds the buffer capacity"
+             << " by " << ( ( push_pos + size ) - capacity ) << " bytes! Resizing the"
+             << " buffer to accommodate the data." << endl;
+      message_publish( MSG_WARNING, errmsg.str().c_str() );
+      ensure_buffer_capacity( push_pos + size );
+   }
+
+   if ( Utilities::get_endianness() == TRICK_LITTLE_ENDIAN ) {
+      // Same byte order as the wire format; so, copy all the values at once.
+      memcpy( &buffer[push_pos], src, size ); // flawfinder: ignore
+   } else {
+      for ( size_t i = 0; i < count; ++i ) {
+         double const value = Utilities::byteswap_double( src[i] );
+         memcpy( &buffer[push_pos + ( i * sizeof( double ) )], &value, sizeof( double ) ); // flawfinder: ignore
+      }
+   }
+
+   // Update buffer position where we push new data to next.
+   push_pos += size;
+}
+
+void OpaqueBuffer::pull_float64_le_from_buffer(
+   double      *dest,
+   size_t const count )
+{
+   size_t const size = count * sizeof( double );
+
+   // Determine if we need to remove pad bytes which were added to achieve the
+   // desired byte alignment.
+   if ( alignment > 1 ) {
+      size_t pad_size = pull_pos % alignment;
+      if ( pad_size > 0 ) {
+         pull_pad_from_buffer( pad_size );
+      }
+   }
+
+   // Determine if we are pulling past the end of the received data.
+   if ( ( pull_pos + size ) > data_size ) {
+      ostringstream errmsg;
+      errmsg << "OpaqueBuffer::pull_float64_le_from_buffer():" << __LINE__
+             << " ERROR: Trying to pull " << size << " bytes from the buffer at"
+             << " position " << pull_pos << ", which exceeds the end of the"
+             << " received data by " << ( ( pull_pos + size ) - data_size )
+             << " bytes!" << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   if ( Utilities::get_endianness() == TRICK_LITTLE_ENDIAN ) {
+      // Same byte order as the wire format; so, copy all the values at once.
+      memcpy( dest, &buffer[pull_pos], size ); // flawfinder: ignore
+   } else {
+      for ( size_t i = 0; i < count; ++i ) {
+         double value;
+         memcpy( &value, &buffer[pull_pos + ( i * sizeof( double ) )], sizeof( double ) ); // flawfinder: ignore
+         dest[i] = Utilities::byteswap_double( value );
+      }
+   }
+
+   // Update the buffer position where we pull data from.
+   pull_pos += size;
+}
+
 void OpaqueBuffer::push_pad_to_buffer(
    size_t const pad_size )
 {
@@ -288,13 +389,13 @@ void OpaqueBuffer::pull_pad_from_buffer(
       return;
    }
 
-   // Determine if we are overflowing the capacity of the buffer.
-   if ( ( pull_pos + pad_size ) > capacity ) {
+   // Determine if we are pulling past the end of the received data.
+   if ( ( pull_pos + pad_size ) > data_size ) {
       ostringstream errmsg;
       errmsg << "OpaqueBuffer::pull_pad_from_buffer():" << __LINE__
              << " ERROR: Trying to pull " << pad_size << " pad bytes from the"
              << " buffer at position " << pull_pos << ", which exceeds the end of"
-             << " the buffer by " << ( ( pull_pos + pad_size ) - capacity )
+             << " the received data by " << ( ( pull_pos + pad_size ) - data_size )
              << " bytes!" << endl;
       DebugHandler::terminate_with_message( errmsg.str() );
    }
@@ -28,6 +28,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{time/Int64Time.cpp}
 @trick_link_dependency{utils/MutexLock.cpp}
 @trick_link_dependency{utils/MutexProtection.cpp}
+@trick_link_dependency{utils/QueueStats.cpp}
 
 @revs_title
 @revs_begin
@@ -63,6 +64,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/time/Int64Interval.hh"
 #include "TrickHLA/time/Int64Time.hh"
 #include "TrickHLA/utils/MutexProtection.hh"
+#include "TrickHLA/utils/QueueStats.hh"
 
 using namespace std;
 using namespace TrickHLA;
@@ -71,7 +73,9 @@ using namespace TrickHLA;
  * @job_class{initialization}
  */
 OwnershipHandler::OwnershipHandler()
-   : object( NULL ),
+   : pull_stats(),
+     push_stats(),
+     object( NULL ),
      pull_requests(),
      push_requests(),
      pull_items_cnt( 0 ),
@@ -204,6 +208,7 @@ void OwnershipHandler::restore_data_after_checkpoint()
          if ( ownership_iter == pull_requests.end() ) {
             attr_map            = new THLAAttributeMap();
             pull_requests[time] = attr_map;
+            pull_stats.record_depth( pull_requests.size() );
          } else {
             attr_map = ownership_iter->second;
          }
@@ -233,6 +238,7 @@ void OwnershipHandler::restore_data_after_checkpoint()
          if ( ownership_iter == push_requests.end() ) {
             attr_map            = new THLAAttributeMap();
             push_requests[time] = attr_map;
+            push_stats.record_depth( push_requests.size() );
          } else {
             attr_map = ownership_iter->second;
          }
@@ -284,6 +290,18 @@ void OwnershipHandler::initialize_callback(
    Object *obj )
 {
    this->object = obj;
+   set_stats_names();
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void OwnershipHandler::set_stats_names()
+{
+   if ( this->object != NULL ) {
+      pull_stats.set_name( object->get_name() + " pull ownership requests" );
+      push_stats.set_name( object->get_name() + " push ownership requests" );
+   }
 }
 
 string OwnershipHandler::get_object_name() const
@@ -373,6 +391,7 @@ void OwnershipHandler::pull_ownership(
    if ( attr_map_iter == pull_requests.end() ) {
       attr_map            = new THLAAttributeMap();
       pull_requests[time] = attr_map;
+      pull_stats.record_depth( pull_requests.size() );
    } else {
       attr_map = attr_map_iter->second;
    }
@@ -431,6 +450,7 @@ void OwnershipHandler::pull_ownership(
    if ( attr_map_iter == pull_requests.end() ) {
       attr_map            = new THLAAttributeMap();
       pull_requests[time] = attr_map;
+      pull_stats.record_depth( pull_requests.size() );
    } else {
       attr_map = attr_map_iter->second;
    }
@@ -476,6 +496,7 @@ void OwnershipHandler::push_ownership(
    if ( attr_map_iter == push_requests.end() ) {
       attr_map            = new THLAAttributeMap();
       push_requests[time] = attr_map;
+      push_stats.record_depth( push_requests.size() );
    } else {
       attr_map = attr_map_iter->second;
    }
@@ -534,6 +555,7 @@ void OwnershipHandler::push_ownership(
    if ( attr_map_iter == push_requests.end() ) {
       attr_map            = new THLAAttributeMap();
       push_requests[time] = attr_map;
+      push_stats.record_depth( push_requests.size() );
    } else {
       attr_map = attr_map_iter->second;
    }
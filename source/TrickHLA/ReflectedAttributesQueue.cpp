@@ -18,6 +18,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{ReflectedAttributesQueue.cpp}
 @trick_link_dependency{utils/MutexLock.cpp}
 @trick_link_dependency{utils/MutexProtection.cpp}
+@trick_link_dependency{utils/QueueStats.cpp}
 
 @revs_title
 @revs_begin
@@ -27,10 +28,14 @@ NASA, Johnson Space Center\n
 
 */
 
+// System includes.
+#include <cstdint>
+
 // TrickHLA includes.
 #include "TrickHLA/ReflectedAttributesQueue.hh"
 #include "TrickHLA/HLAStandardSupport.hh"
 #include "TrickHLA/utils/MutexProtection.hh"
+#include "TrickHLA/utils/QueueStats.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
 // to silence the warnings coming from the IEEE 1516 declared functions.
@@ -56,7 +61,9 @@ using namespace TrickHLA;
  */
 ReflectedAttributesQueue::ReflectedAttributesQueue()
    : queue_mutex(),
-     attribute_map_queue()
+     attribute_map_queue(),
+     stats( NULL ),
+     push_times()
 {
    return;
 }
@@ -93,6 +100,12 @@ void ReflectedAttributesQueue::push(
    MutexProtection auto_unlock_mutex( &queue_mutex );
 
    attribute_map_queue.push( theAttributes );
+
+   if ( stats != NULL ) {
+      int64_t const now = QueueStats::monotonic_time();
+      push_times.push( now );
+      stats->record_depth( attribute_map_queue.size(), push_times.front(), now );
+   }
 }
 
 void ReflectedAttributesQueue::pop()
@@ -102,6 +115,15 @@ void ReflectedAttributesQueue::pop()
    MutexProtection auto_unlock_mutex( &queue_mutex );
 
    attribute_map_queue.pop();
+
+   if ( stats != NULL ) {
+      if ( !push_times.empty() ) {
+         push_times.pop();
+      }
+      stats->record_depth( attribute_map_queue.size(),
+                           ( push_times.empty() ? 0 : push_times.front() ),
+                           QueueStats::monotonic_time() );
+   }
 }
 
 AttributeHandleValueMap &ReflectedAttributesQueue::front()
@@ -122,4 +144,20 @@ void ReflectedAttributesQueue::clear()
    while ( !attribute_map_queue.empty() ) {
       attribute_map_queue.pop();
    }
+   while ( !push_times.empty() ) {
+      push_times.pop();
+   }
+   if ( stats != NULL ) {
+      stats->record_depth( 0 );
+   }
+}
+
+void ReflectedAttributesQueue::set_stats(
+   QueueStats *queue_stats )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &queue_mutex );
+
+   this->stats = queue_stats;
 }
@@ -25,6 +25,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{utils/MutexLock.cpp}
 @trick_link_dependency{utils/MutexProtection.cpp}
 @trick_link_dependency{utils/SleepTimeout.cpp}
+@trick_link_dependency{utils/StartupProfiler.cpp}
 @trick_link_dependency{utils/Utilities.cpp}
 
 @revs_title
@@ -54,6 +55,7 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/time/Int64Time.hh"
 #include "TrickHLA/utils/MutexProtection.hh"
+#include "TrickHLA/utils/StartupProfiler.hh"
 #include "TrickHLA/utils/StringUtilities.hh"
 
 // C++11 deprecated dynamic exception specifications for a function so we need
@@ -535,6 +537,8 @@ bool SyncPointManagerBase::mark_sync_point_announced(
 bool SyncPointManagerBase::wait_for_sync_point_announced(
    wstring const &label )
 {
+   StartupProfilerScope profile_scope( "SyncPointManagerBase::wait_for_sync_point_announced", "wait" );
+
    int index;
    {
       // Scope this mutex lock because locking over the blocking wait call
@@ -566,6 +570,8 @@ bool SyncPointManagerBase::wait_for_sync_point_announced(
 bool SyncPointManagerBase::wait_for_all_sync_points_announced(
    string const &list_name )
 {
+   StartupProfilerScope profile_scope( "SyncPointManagerBase::wait_for_all_sync_points_announced", "wait" );
+
    // NOTE: Locking the mutex while waiting can cause deadlock for callbacks.
 
    int const index = get_list_index_for_list_name( list_name );
@@ -666,6 +672,8 @@ bool SyncPointManagerBase::mark_sync_point_synchronized(
 bool SyncPointManagerBase::wait_for_sync_point_synchronized(
    wstring const &label )
 {
+   StartupProfilerScope profile_scope( "SyncPointManagerBase::wait_for_sync_point_synchronized", "wait" );
+
    int index;
    {
       // Scope this mutex lock because locking over the blocking wait call
@@ -706,6 +714,8 @@ bool SyncPointManagerBase::wait_for_all_sync_points_synchronized(
 bool SyncPointManagerBase::achieve_sync_point_and_wait_for_synchronization(
    std::wstring const &label )
 {
+   StartupProfilerScope profile_scope( "SyncPointManagerBase::achieve_sync_point_and_wait_for_synchronization", "wait" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
       string label_str;
       StringUtilities::to_string( label_str, label );
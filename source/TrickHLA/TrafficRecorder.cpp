@@ -0,0 +1,597 @@
+/*!
+@file TrickHLA/TrafficRecorder.cpp
+@ingroup TrickHLA
+@brief This class records the federation traffic received by a federate to a
+memory-mapped binary log that TrickHLA::TrafficReplay feeds back through the
+receive side of a federate.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{Attribute.cpp}
+@trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{Manager.cpp}
+@trick_link_dependency{Object.cpp}
+@trick_link_dependency{TrafficRecorder.cpp}
+@trick_link_dependency{time/Int64Time.cpp}
+@trick_link_dependency{utils/MutexLock.cpp}
+@trick_link_dependency{utils/MutexProtection.cpp}
+@trick_link_dependency{utils/QueueStats.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System includes.
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <map>
+#include <sstream>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+// Trick includes.
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+
+// TrickHLA includes.
+#include "TrickHLA/Attribute.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/HLAStandardSupport.hh"
+#include "TrickHLA/Manager.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/TrafficRecorder.hh"
+#include "TrickHLA/time/Int64Time.hh"
+#include "TrickHLA/utils/MutexProtection.hh"
+#include "TrickHLA/utils/QueueStats.hh"
+#include "TrickHLA/utils/StringUtilities.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wdeprecated"
+#endif
+
+// HLA include files.
+#include "RTI/Exception.h"
+#include "RTI/Handle.h"
+#include "RTI/RTIambassador.h"
+#include "RTI/Typedefs.h"
+#include "RTI/VariableLengthData.h"
+
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic pop
+#endif
+
+using namespace RTI1516_NAMESPACE;
+using namespace std;
+using namespace TrickHLA;
+
+// Size in bytes the memory-mapped traffic log file grows by.
+#define THLA_TRAFFIC_LOG_GROW_SIZE ( 64 * 1024 * 1024 )
+
+/*!
+ * @job_class{initialization}
+ */
+TrafficRecorder::TrafficRecorder()
+   : file_name(),
+     record_count( 0 ),
+     byte_count( 0 ),
+     manager( NULL ),
+     log_fd( -1 ),
+     log_data( NULL ),
+     log_capacity( 0 ),
+     log_size( 0 ),
+     start_time( 0 ),
+     next_id( 1 ),
+     grow_failed( false ),
+     object_ids(),
+     attribute_ids(),
+     interaction_ids(),
+     parameter_ids(),
+     mutex()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+TrafficRecorder::~TrafficRecorder()
+{
+   shutdown();
+   mutex.destroy();
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void TrafficRecorder::initialize(
+   Manager *mgr )
+{
+   this->manager = mgr;
+
+   if ( file_name.empty() || ( log_fd >= 0 ) ) {
+      return;
+   }
+
+   this->log_fd = open( file_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 ); // NOLINT
+   if ( log_fd < 0 ) {
+      ostringstream errmsg;
+      errmsg << "TrafficRecorder::initialize():" << __LINE__
+             << " ERROR: Could not create the traffic log file '" << file_name
+             << "': " << strerror( errno ) << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+
+   if ( !grow( THLA_TRAFFIC_LOG_GROW_SIZE ) ) {
+      ostringstream errmsg;
+      errmsg << "TrafficRecorder::initialize():" << __LINE__
+             << " ERROR: Could not memory-map the traffic log file '"
+             << file_name << "': " << strerror( errno ) << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+
+   // File header: magic, format version and a reserved word.
+   uint32_t const version  = THLA_TRAFFIC_LOG_VERSION;
+   uint32_t const reserved = 0;
+   memcpy( log_data, THLA_TRAFFIC_LOG_MAGIC, 8 );
+   memcpy( log_data + 8, &version, sizeof( version ) );
+   memcpy( log_data + 12, &reserved, sizeof( reserved ) );
+   this->log_size   = THLA_TRAFFIC_LOG_HEADER_SIZE;
+   this->byte_count = log_size;
+   this->start_time = QueueStats::monotonic_time();
+
+   if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      message_publish( MSG_NORMAL, "TrafficRecorder::initialize():%d Recording the received traffic to '%s'.\n",
+                       __LINE__, file_name.c_str() );
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void TrafficRecorder::shutdown()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   if ( log_fd < 0 ) {
+      return;
+   }
+
+   if ( log_data != NULL ) {
+      munmap( log_data, log_capacity );
+      this->log_data = NULL;
+   }
+   if ( ftruncate( log_fd, (off_t)log_size ) != 0 ) {
+      message_publish( MSG_WARNING, "TrafficRecorder::shutdown():%d WARNING: \
+Could not truncate the traffic log file '%s' to %llu bytes: %s\n",
+                       __LINE__, file_name.c_str(), (unsigned long long)log_size,
+                       strerror( errno ) );
+   }
+   close( log_fd );
+   this->log_fd       = -1;
+   this->log_capacity = 0;
+
+   ostringstream msg;
+   msg << "TrafficRecorder::shutdown():" << __LINE__
+       << " Recorded " << record_count << " records, " << byte_count
+       << " bytes, to '" << file_name << "'." << endl;
+   message_publish( MSG_INFO, msg.str().c_str() );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void TrafficRecorder::record_discover(
+   ObjectInstanceHandle const &instance_hndl )
+{
+   Object *obj = ( manager != NULL ) ? manager->get_trickhla_object( instance_hndl ) : NULL;
+   if ( obj == NULL ) {
+      return;
+   }
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   if ( log_data == NULL ) {
+      return;
+   }
+
+   uint32_t const obj_id = get_object_id( obj );
+   if ( begin_record( TRAFFIC_RECORD_DISCOVER, 0, 0, sizeof( uint32_t ) ) ) {
+      append_uint32( obj_id );
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void TrafficRecorder::record_reflect(
+   Object                        *obj,
+   AttributeHandleValueMap const &attribute_values,
+   VariableLengthData const      &tag,
+   LogicalTime const             *time )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   if ( log_data == NULL ) {
+      return;
+   }
+
+   uint32_t const obj_id = get_object_id( obj );
+
+   // Resolve the attribute IDs first, since the define records they may
+   // write cannot be nested inside this record.
+   vector< uint32_t > attr_ids( attribute_values.size(), 0 );
+   std::size_t        payload_size = ( 3 * sizeof( uint32_t ) ) + tag.size();
+   std::size_t        n            = 0;
+
+   AttributeHandleValueMap::const_iterator iter;
+   for ( iter = attribute_values.begin(); iter != attribute_values.end(); ++iter, ++n ) {
+      attr_ids[n] = get_attribute_id( obj, obj_id, iter->first );
+      if ( attr_ids[n] != 0 ) {
+         payload_size += ( 2 * sizeof( uint32_t ) ) + iter->second.size();
+      }
+   }
+
+   uint16_t flags        = 0;
+   int64_t  logical_time = 0;
+   if ( time != NULL ) {
+      Int64Time i64time( *time );
+      flags        = THLA_TRAFFIC_RECORD_FLAG_TIME;
+      logical_time = i64time.get_base_time();
+   }
+
+   if ( !begin_record( TRAFFIC_RECORD_REFLECT, flags, logical_time, payload_size ) ) {
+      return;
+   }
+   append_uint32( obj_id );
+   append_uint32( (uint32_t)tag.size() );
+   append( tag.data(), tag.size() );
+
+   uint32_t count = 0;
+   for ( n = 0; n < attribute_values.size(); ++n ) {
+      if ( attr_ids[n] != 0 ) {
+         ++count;
+      }
+   }
+   append_uint32( count );
+
+   for ( iter = attribute_values.begin(), n = 0; iter != attribute_values.end(); ++iter, ++n ) {
+      if ( attr_ids[n] != 0 ) {
+         append_uint32( attr_ids[n] );
+         append_uint32( (uint32_t)iter->second.size() );
+         append( iter->second.data(), iter->second.size() );
+      }
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void TrafficRecorder::record_interaction(
+   InteractionClassHandle const  &class_hndl,
+   ParameterHandleValueMap const &parameter_values,
+   VariableLengthData const      &tag,
+   LogicalTime const             *time,
+   bool const                     received_as_TSO )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   if ( log_data == NULL ) {
+      return;
+   }
+
+   uint32_t const inter_id = get_interaction_id( class_hndl );
+   if ( inter_id == 0 ) {
+      return;
+   }
+
+   // Resolve the parameter IDs first, since the define records they may
+   // write cannot be nested inside this record.
+   vector< uint32_t > param_ids( parameter_values.size(), 0 );
+   std::size_t        payload_size = ( 3 * sizeof( uint32_t ) ) + tag.size();
+   std::size_t        n            = 0;
+
+   ParameterHandleValueMap::const_iterator iter;
+   for ( iter = parameter_values.begin(); iter != parameter_values.end(); ++iter, ++n ) {
+      param_ids[n] = get_parameter_id( class_hndl, inter_id, iter->first );
+      if ( param_ids[n] != 0 ) {
+         payload_size += ( 2 * sizeof( uint32_t ) ) + iter->second.size();
+      }
+   }
+
+   uint16_t flags        = received_as_TSO ? THLA_TRAFFIC_RECORD_FLAG_TSO : 0;
+   int64_t  logical_time = 0;
+   if ( time != NULL ) {
+      Int64Time i64time( *time );
+      flags |= THLA_TRAFFIC_RECORD_FLAG_TIME;
+      logical_time = i64time.get_base_time();
+   }
+
+   if ( !begin_record( TRAFFIC_RECORD_INTERACTION, flags, logical_time, payload_size ) ) {
+      return;
+   }
+   append_uint32( inter_id );
+   append_uint32( (uint32_t)tag.size() );
+   append( tag.data(), tag.size() );
+
+   uint32_t count = 0;
+   for ( n = 0; n < parameter_values.size(); ++n ) {
+      if ( param_ids[n] != 0 ) {
+         ++count;
+      }
+   }
+   append_uint32( count );
+
+   for ( iter = parameter_values.begin(), n = 0; iter != parameter_values.end(); ++iter, ++n ) {
+      if ( param_ids[n] != 0 ) {
+         append_uint32( param_ids[n] );
+         append_uint32( (uint32_t)iter->second.size() );
+         append( iter->second.data(), iter->second.size() );
+      }
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void TrafficRecorder::record_remove(
+   ObjectInstanceHandle const &instance_hndl )
+{
+   Object *obj = ( manager != NULL ) ? manager->get_trickhla_object( instance_hndl ) : NULL;
+   if ( obj == NULL ) {
+      return;
+   }
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   if ( log_data == NULL ) {
+      return;
+   }
+
+   uint32_t const obj_id = get_object_id( obj );
+   if ( begin_record( TRAFFIC_RECORD_REMOVE, 0, 0, sizeof( uint32_t ) ) ) {
+      append_uint32( obj_id );
+   }
+
+   // The RTI can reuse the instance handle, so a later instance with the
+   // same handle gets its own ID and define record.
+   object_ids.erase( instance_hndl );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void TrafficRecorder::record_time_advance_grant(
+   LogicalTime const &time )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   Int64Time i64time( time );
+   begin_record( TRAFFIC_RECORD_TIME_ADVANCE_GRANT, THLA_TRAFFIC_RECORD_FLAG_TIME,
+                 i64time.get_base_time(), 0 );
+}
+
+/*!
+ * @details The IDs are keyed by the object instance handle instead of the
+ * object, since an ObjectPool slot is bound to a new object instance, with
+ * a new name and handle, each time it is reused.
+ */
+uint32_t TrafficRecorder::get_object_id(
+   Object const *obj )
+{
+   ObjectInstanceHandle const instance_hndl = obj->get_instance_handle();
+
+   map< ObjectInstanceHandle, uint32_t >::const_iterator iter = object_ids.find( instance_hndl );
+   if ( iter != object_ids.end() ) {
+      return iter->second;
+   }
+
+   uint32_t const id         = next_id++;
+   object_ids[instance_hndl] = id;
+   write_define( TRAFFIC_RECORD_DEFINE_OBJECT, id, 0, obj->get_name() );
+   return id;
+}
+
+uint32_t TrafficRecorder::get_attribute_id(
+   Object                *obj,
+   uint32_t const         obj_id,
+   AttributeHandle const &attr_hndl )
+{
+   pair< uint32_t, AttributeHandle > const key( obj_id, attr_hndl );
+
+   map< pair< uint32_t, AttributeHandle >, uint32_t >::const_iterator iter = attribute_ids.find( key );
+   if ( iter != attribute_ids.end() ) {
+      return iter->second;
+   }
+
+   Attribute const *attr = obj->get_attribute( attr_hndl );
+   if ( attr == NULL ) {
+      return 0;
+   }
+
+   uint32_t const id  = next_id++;
+   attribute_ids[key] = id;
+   write_define( TRAFFIC_RECORD_DEFINE_ATTRIBUTE, id, obj_id, attr->get_FOM_name() );
+   return id;
+}
+
+uint32_t TrafficRecorder::get_interaction_id(
+   InteractionClassHandle const &class_hndl )
+{
+   map< InteractionClassHandle, uint32_t >::const_iterator iter = interaction_ids.find( class_hndl );
+   if ( iter != interaction_ids.end() ) {
+      return iter->second;
+   }
+
+   RTIambassador *rti_amb = ( manager != NULL ) ? manager->get_RTI_ambassador() : NULL;
+   if ( rti_amb == NULL ) {
+      return 0;
+   }
+
+   string name;
+   try {
+      StringUtilities::to_string( name, rti_amb->getInteractionClassName( class_hndl ) );
+   } catch ( RTI1516_NAMESPACE::Exception const &e ) {
+      return 0;
+   }
+
+   uint32_t const id           = next_id++;
+   interaction_ids[class_hndl] = id;
+   write_define( TRAFFIC_RECORD_DEFINE_INTERACTION, id, 0, name );
+   return id;
+}
+
+uint32_t TrafficRecorder::get_parameter_id(
+   InteractionClassHandle const &class_hndl,
+   uint32_t const                inter_id,
+   ParameterHandle const        &param_hndl )
+{
+   pair< uint32_t, ParameterHandle > const key( inter_id, param_hndl );
+
+   map< pair< uint32_t, ParameterHandle >, uint32_t >::const_iterator iter = parameter_ids.find( key );
+   if ( iter != parameter_ids.end() ) {
+      return iter->second;
+   }
+
+   RTIambassador *rti_amb = ( manager != NULL ) ? manager->get_RTI_ambassador() : NULL;
+   if ( rti_amb == NULL ) {
+      return 0;
+   }
+
+   string name;
+   try {
+      StringUtilities::to_string( name, rti_amb->getParameterName( class_hndl, param_hndl ) );
+   } catch ( RTI1516_NAMESPACE::Exception const &e ) {
+      return 0;
+   }
+
+   uint32_t const id  = next_id++;
+   parameter_ids[key] = id;
+   write_define( TRAFFIC_RECORD_DEFINE_PARAMETER, id, inter_id, name );
+   return id;
+}
+
+void TrafficRecorder::write_define(
+   TrafficRecordEnum const type,
+   uint32_t const          id,
+   uint32_t const          owner_id,
+   string const           &name )
+{
+   if ( begin_record( type, 0, 0, ( 3 * sizeof( uint32_t ) ) + name.size() ) ) {
+      append_uint32( id );
+      append_uint32( owner_id );
+      append_uint32( (uint32_t)name.size() );
+      append( name.data(), name.size() );
+   }
+}
+
+bool TrafficRecorder::begin_record(
+   TrafficRecordEnum const type,
+   uint16_t const          flags,
+   int64_t const           logical_time,
+   std::size_t const       payload_size )
+{
+   if ( log_data == NULL ) {
+      return false;
+   }
+
+   std::size_t const record_size = THLA_TRAFFIC_RECORD_HEADER_SIZE + payload_size;
+   if ( ( ( log_size + record_size ) > log_capacity )
+        && !grow( log_size + record_size + THLA_TRAFFIC_LOG_GROW_SIZE ) ) {
+      return false;
+   }
+
+   uint32_t const size      = (uint32_t)record_size;
+   uint16_t const rec_type  = (uint16_t)type;
+   int64_t const  mono_time = QueueStats::monotonic_time() - start_time;
+
+   append( &size, sizeof( size ) );
+   append( &rec_type, sizeof( rec_type ) );
+   append( &flags, sizeof( flags ) );
+   append( &mono_time, sizeof( mono_time ) );
+   append( &logical_time, sizeof( logical_time ) );
+
+   ++record_count;
+   this->byte_count += record_size;
+   return true;
+}
+
+void TrafficRecorder::append(
+   void const       *data,
+   std::size_t const size )
+{
+   if ( size > 0 ) {
+      memcpy( log_data + log_size, data, size );
+      this->log_size += size;
+   }
+}
+
+bool TrafficRecorder::grow(
+   std::size_t const min_size )
+{
+   if ( grow_failed ) {
+      return false;
+   }
+
+   // Remap the whole file, since growing the mapping in place is not portable.
+   if ( log_data != NULL ) {
+      munmap( log_data, log_capacity );
+      this->log_data = NULL;
+   }
+
+   std::size_t const capacity = ( min_size > ( 2 * log_capacity ) ) ? min_size : ( 2 * log_capacity );
+
+   void *data = MAP_FAILED;
+   if ( ftruncate( log_fd, (off_t)capacity ) == 0 ) {
+      data = mmap( NULL, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, log_fd, 0 );
+   }
+
+   if ( data == MAP_FAILED ) {
+      this->grow_failed = true;
+      message_publish( MSG_WARNING, "TrafficRecorder::grow():%d WARNING: \
+Could not grow the traffic log file '%s' to %llu bytes, the recording stopped: %s\n",
+                       __LINE__, file_name.c_str(), (unsigned long long)capacity,
+                       strerror( errno ) );
+      return false;
+   }
+
+   this->log_data     = static_cast< unsigned char * >( data );
+   this->log_capacity = capacity;
+   return true;
+}
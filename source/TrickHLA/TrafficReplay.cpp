@@ -0,0 +1,508 @@
+/*!
+@file TrickHLA/TrafficReplay.cpp
+@ingroup TrickHLA
+@brief This class replays a traffic log recorded by TrickHLA::TrafficRecorder
+through the receive side of a federate.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{Attribute.cpp}
+@trick_link_dependency{DebugHandler.cpp}
+@trick_link_dependency{Manager.cpp}
+@trick_link_dependency{Object.cpp}
+@trick_link_dependency{TrafficReplay.cpp}
+@trick_link_dependency{time/Int64Time.cpp}
+@trick_link_dependency{utils/QueueStats.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System includes.
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <sstream>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+// Trick includes.
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+
+// TrickHLA includes.
+#include "TrickHLA/Attribute.hh"
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/HLAStandardSupport.hh"
+#include "TrickHLA/Manager.hh"
+#include "TrickHLA/Object.hh"
+#include "TrickHLA/TrafficRecorder.hh"
+#include "TrickHLA/TrafficReplay.hh"
+#include "TrickHLA/time/Int64Time.hh"
+#include "TrickHLA/utils/QueueStats.hh"
+#include "TrickHLA/utils/StringUtilities.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wdeprecated"
+#endif
+
+// HLA include files.
+#include "RTI/Exception.h"
+#include "RTI/Handle.h"
+#include "RTI/RTIambassador.h"
+#include "RTI/Typedefs.h"
+#include "RTI/VariableLengthData.h"
+
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic pop
+#endif
+
+using namespace RTI1516_NAMESPACE;
+using namespace std;
+using namespace TrickHLA;
+
+namespace
+{
+
+// Read a value from the log, which may not be aligned for the type.
+template < typename T >
+T read_value(
+   unsigned char const *data )
+{
+   T value;
+   memcpy( &value, data, sizeof( T ) );
+   return value;
+}
+
+// Cursor over the payload of a record that stops reading past its end.
+class PayloadReader
+{
+  public:
+   PayloadReader( unsigned char const *data, std::size_t const size )
+      : ptr( data ), end( data + size ), ok( true )
+   {
+      return;
+   }
+
+   uint32_t read_uint32()
+   {
+      if ( !has( sizeof( uint32_t ) ) ) {
+         return 0;
+      }
+      uint32_t const value = read_value< uint32_t >( ptr );
+      ptr += sizeof( uint32_t );
+      return value;
+   }
+
+   unsigned char const *read_bytes( std::size_t const size )
+   {
+      if ( !has( size ) ) {
+         return NULL;
+      }
+      unsigned char const *bytes = ptr;
+      ptr += size;
+      return bytes;
+   }
+
+   bool is_ok() const
+   {
+      return ok;
+   }
+
+  private:
+   bool has( std::size_t const size )
+   {
+      if ( ok && ( (std::size_t)( end - ptr ) < size ) ) {
+         this->ok = false;
+      }
+      return ok;
+   }
+
+   unsigned char const *ptr;
+   unsigned char const *end;
+   bool                 ok;
+};
+
+} // namespace
+
+/*!
+ * @job_class{initialization}
+ */
+TrafficReplay::TrafficReplay()
+   : file_name(),
+     pace_rate( 0.0 ),
+     replayed_count( 0 ),
+     unmatched_count( 0 ),
+     frame_count( 0 ),
+     finished( false ),
+     manager( NULL ),
+     log_fd( -1 ),
+     log_data( NULL ),
+     log_size( 0 ),
+     read_offset( 0 ),
+     start_time( 0 ),
+     objects(),
+     attribute_handles(),
+     interaction_handles(),
+     parameter_handles()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+TrafficReplay::~TrafficReplay()
+{
+   shutdown();
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void TrafficReplay::initialize(
+   Manager *mgr )
+{
+   this->manager = mgr;
+
+   if ( file_name.empty() || ( log_fd >= 0 ) ) {
+      return;
+   }
+
+   this->log_fd = open( file_name.c_str(), O_RDONLY ); // NOLINT
+   if ( log_fd < 0 ) {
+      ostringstream errmsg;
+      errmsg << "TrafficReplay::initialize():" << __LINE__
+             << " ERROR: Could not open the traffic log file '" << file_name
+             << "': " << strerror( errno ) << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+
+   struct stat file_stat;
+   if ( ( fstat( log_fd, &file_stat ) != 0 )
+        || ( file_stat.st_size < THLA_TRAFFIC_LOG_HEADER_SIZE ) ) {
+      ostringstream errmsg;
+      errmsg << "TrafficReplay::initialize():" << __LINE__
+             << " ERROR: The traffic log file '" << file_name
+             << "' is too small to be a traffic log." << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+   this->log_size = (std::size_t)file_stat.st_size;
+
+   void *data = mmap( NULL, log_size, PROT_READ, MAP_PRIVATE, log_fd, 0 );
+   if ( data == MAP_FAILED ) {
+      ostringstream errmsg;
+      errmsg << "TrafficReplay::initialize():" << __LINE__
+             << " ERROR: Could not memory-map the traffic log file '"
+             << file_name << "': " << strerror( errno ) << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+   this->log_data = static_cast< unsigned char const * >( data );
+
+   if ( ( memcmp( log_data, THLA_TRAFFIC_LOG_MAGIC, 8 ) != 0 )
+        || ( read_value< uint32_t >( log_data + 8 ) != THLA_TRAFFIC_LOG_VERSION ) ) {
+      ostringstream errmsg;
+      errmsg << "TrafficReplay::initialize():" << __LINE__
+             << " ERROR: The file '" << file_name
+             << "' is not a version " << THLA_TRAFFIC_LOG_VERSION
+             << " TrickHLA traffic log." << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+      return;
+   }
+   this->read_offset = THLA_TRAFFIC_LOG_HEADER_SIZE;
+
+   if ( DebugHandler::show( DEBUG_LEVEL_1_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      message_publish( MSG_NORMAL, "TrafficReplay::initialize():%d Replaying the traffic log '%s' of %llu bytes.\n",
+                       __LINE__, file_name.c_str(), (unsigned long long)log_size );
+   }
+}
+
+/*!
+ * @job_class{environment}
+ */
+void TrafficReplay::replay_frame()
+{
+   if ( ( log_data == NULL ) || finished ) {
+      return;
+   }
+
+   if ( start_time == 0 ) {
+      this->start_time = QueueStats::monotonic_time();
+   }
+
+   // Leave the frame for a later data cycle if it is not due yet, instead
+   // of sleeping in this job and stalling the main thread.
+   if ( ( pace_rate > 0.0 ) && !is_frame_due() ) {
+      return;
+   }
+
+   while ( read_offset < log_size ) {
+
+      unsigned char const *record = log_data + read_offset;
+      std::size_t const    size   = ( ( log_size - read_offset ) >= THLA_TRAFFIC_RECORD_HEADER_SIZE )
+                                       ? read_value< uint32_t >( record )
+                                       : 0;
+
+      if ( ( size < THLA_TRAFFIC_RECORD_HEADER_SIZE ) || ( size > ( log_size - read_offset ) ) ) {
+         message_publish( MSG_WARNING, "TrafficReplay::replay_frame():%d WARNING: \
+Truncated record at offset %llu of the traffic log '%s', stopping the replay.\n",
+                          __LINE__, (unsigned long long)read_offset, file_name.c_str() );
+         this->read_offset = log_size;
+         break;
+      }
+
+      this->read_offset += size;
+
+      if ( replay_record( record, size ) ) {
+         ++frame_count;
+         return;
+      }
+   }
+
+   this->finished = true;
+
+   ostringstream msg;
+   msg << "TrafficReplay::replay_frame():" << __LINE__
+       << " Finished replaying '" << file_name << "' with "
+       << replayed_count << " replayed, " << unmatched_count
+       << " unmatched and " << frame_count << " frames." << endl;
+   message_publish( MSG_INFO, msg.str().c_str() );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void TrafficReplay::shutdown()
+{
+   if ( log_fd < 0 ) {
+      return;
+   }
+
+   if ( log_data != NULL ) {
+      munmap( const_cast< unsigned char * >( log_data ), log_size );
+      this->log_data = NULL;
+   }
+   close( log_fd );
+   this->log_fd = -1;
+
+   ostringstream msg;
+   msg << "TrafficReplay::shutdown():" << __LINE__
+       << " Replayed " << replayed_count << " records, skipped "
+       << unmatched_count << " unmatched records and replayed "
+       << frame_count << " frames from '" << file_name << "'." << endl;
+   message_publish( MSG_INFO, msg.str().c_str() );
+}
+
+bool TrafficReplay::is_frame_due()
+{
+   // Find the time advance grant that ends the next frame. A truncated log
+   // or a log without a final grant is due, so replay_frame() can finish it.
+   std::size_t offset = read_offset;
+   while ( ( log_size - offset ) >= THLA_TRAFFIC_RECORD_HEADER_SIZE ) {
+      unsigned char const *record = log_data + offset;
+      std::size_t const    size   = read_value< uint32_t >( record );
+
+      if ( ( size < THLA_TRAFFIC_RECORD_HEADER_SIZE ) || ( size > ( log_size - offset ) ) ) {
+         return true;
+      }
+
+      if ( read_value< uint16_t >( record + 4 ) == TRAFFIC_RECORD_TIME_ADVANCE_GRANT ) {
+         int64_t const mono_time = read_value< int64_t >( record + 8 );
+         int64_t const due       = start_time + (int64_t)( (double)mono_time / pace_rate );
+         return ( QueueStats::monotonic_time() >= due );
+      }
+      offset += size;
+   }
+   return true;
+}
+
+bool TrafficReplay::replay_record(
+   unsigned char const *record,
+   std::size_t const    size )
+{
+   uint16_t const type         = read_value< uint16_t >( record + 4 );
+   uint16_t const flags        = read_value< uint16_t >( record + 6 );
+   int64_t const  logical_time = read_value< int64_t >( record + 16 );
+
+   PayloadReader payload( record + THLA_TRAFFIC_RECORD_HEADER_SIZE,
+                          size - THLA_TRAFFIC_RECORD_HEADER_SIZE );
+
+   switch ( type ) {
+      case TRAFFIC_RECORD_DEFINE_OBJECT:
+      case TRAFFIC_RECORD_DEFINE_ATTRIBUTE:
+      case TRAFFIC_RECORD_DEFINE_INTERACTION:
+      case TRAFFIC_RECORD_DEFINE_PARAMETER: {
+         uint32_t const       id       = payload.read_uint32();
+         uint32_t const       owner_id = payload.read_uint32();
+         uint32_t const       length   = payload.read_uint32();
+         unsigned char const *name     = payload.read_bytes( length );
+         if ( payload.is_ok() ) {
+            define( type, id, owner_id, string( reinterpret_cast< char const * >( name ), length ) );
+         }
+         break;
+      }
+      case TRAFFIC_RECORD_REFLECT: {
+         uint32_t const       obj_id  = payload.read_uint32();
+         uint32_t const       tag_len = payload.read_uint32();
+         unsigned char const *tag     = payload.read_bytes( tag_len );
+         uint32_t const       count   = payload.read_uint32();
+
+         Object *obj = ( obj_id < objects.size() ) ? objects[obj_id] : NULL;
+
+         AttributeHandleValueMap attribute_values;
+         for ( uint32_t i = 0; ( i < count ) && payload.is_ok(); ++i ) {
+            uint32_t const       attr_id = payload.read_uint32();
+            uint32_t const       length  = payload.read_uint32();
+            unsigned char const *value   = payload.read_bytes( length );
+            if ( payload.is_ok()
+                 && ( attr_id < attribute_handles.size() )
+                 && attribute_handles[attr_id].isValid() ) {
+               attribute_values[attribute_handles[attr_id]] = VariableLengthData( value, length );
+            }
+         }
+
+         if ( ( obj != NULL ) && payload.is_ok() && !attribute_values.empty() ) {
+            obj->enqueue_data( attribute_values, VariableLengthData( tag, tag_len ) );
+            ++replayed_count;
+         } else {
+            ++unmatched_count;
+         }
+         break;
+      }
+      case TRAFFIC_RECORD_INTERACTION: {
+         uint32_t const       inter_id = payload.read_uint32();
+         uint32_t const       tag_len  = payload.read_uint32();
+         unsigned char const *tag      = payload.read_bytes( tag_len );
+         uint32_t const       count    = payload.read_uint32();
+
+         bool const valid_class = ( inter_id < interaction_handles.size() )
+                                  && interaction_handles[inter_id].isValid();
+
+         ParameterHandleValueMap parameter_values;
+         for ( uint32_t i = 0; ( i < count ) && payload.is_ok(); ++i ) {
+            uint32_t const       param_id = payload.read_uint32();
+            uint32_t const       length   = payload.read_uint32();
+            unsigned char const *value    = payload.read_bytes( length );
+            if ( payload.is_ok()
+                 && ( param_id < parameter_handles.size() )
+                 && parameter_handles[param_id].isValid() ) {
+               parameter_values[parameter_handles[param_id]] = VariableLengthData( value, length );
+            }
+         }
+
+         if ( valid_class && payload.is_ok() ) {
+            Int64Time const time( logical_time );
+            manager->receive_interaction( interaction_handles[inter_id],
+                                          parameter_values,
+                                          VariableLengthData( tag, tag_len ),
+                                          time.get(),
+                                          ( ( flags & THLA_TRAFFIC_RECORD_FLAG_TSO ) != 0 ) );
+            ++replayed_count;
+         } else {
+            ++unmatched_count;
+         }
+         break;
+      }
+      case TRAFFIC_RECORD_TIME_ADVANCE_GRANT: {
+         return true;
+      }
+      default: {
+         // The discover and remove records, and record types from newer
+         // versions of the log, are skipped.
+         break;
+      }
+   }
+   return false;
+}
+
+void TrafficReplay::define(
+   int const      type,
+   uint32_t const id,
+   uint32_t const owner_id,
+   string const  &name )
+{
+   if ( id >= objects.size() ) {
+      objects.resize( id + 1, NULL );
+      attribute_handles.resize( id + 1 );
+      interaction_handles.resize( id + 1 );
+      parameter_handles.resize( id + 1 );
+   }
+
+   RTIambassador *rti_amb = manager->get_RTI_ambassador();
+
+   switch ( type ) {
+      case TRAFFIC_RECORD_DEFINE_OBJECT: {
+         objects[id] = manager->get_trickhla_object( name );
+         break;
+      }
+      case TRAFFIC_RECORD_DEFINE_ATTRIBUTE: {
+         Object *obj = ( owner_id < objects.size() ) ? objects[owner_id] : NULL;
+         if ( obj != NULL ) {
+            Attribute const *attr = obj->get_attribute( name );
+            if ( attr != NULL ) {
+               attribute_handles[id] = attr->get_attribute_handle();
+            }
+         }
+         break;
+      }
+      case TRAFFIC_RECORD_DEFINE_INTERACTION: {
+         if ( rti_amb != NULL ) {
+            wstring name_ws;
+            StringUtilities::to_wstring( name_ws, name );
+            try {
+               interaction_handles[id] = rti_amb->getInteractionClassHandle( name_ws );
+            } catch ( RTI1516_NAMESPACE::Exception const &e ) {
+               // Leave the handle invalid so the interactions are unmatched.
+            }
+         }
+         break;
+      }
+      case TRAFFIC_RECORD_DEFINE_PARAMETER: {
+         if ( ( rti_amb != NULL )
+              && ( owner_id < interaction_handles.size() )
+              && interaction_handles[owner_id].isValid() ) {
+            wstring name_ws;
+            StringUtilities::to_wstring( name_ws, name );
+            try {
+               parameter_handles[id] = rti_amb->getParameterHandle( interaction_handles[owner_id], name_ws );
+            } catch ( RTI1516_NAMESPACE::Exception const &e ) {
+               // Leave the handle invalid so the parameter is skipped.
+            }
+         }
+         break;
+      }
+      default: {
+         break;
+      }
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_MANAGER ) ) {
+      message_publish( MSG_NORMAL, "TrafficReplay::define():%d ID:%u '%s'\n",
+                       __LINE__, (unsigned int)id, name.c_str() );
+   }
+}
@@ -31,6 +31,8 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{VariableArrayEncoderBase.cpp}
 @trick_link_dependency{../DebugHandler.cpp}
 @trick_link_dependency{../Types.cpp}
+@trick_link_dependency{../utils/MutexLock.cpp}
+@trick_link_dependency{../utils/MutexProtection.cpp}
 
 
 @revs_title
@@ -41,7 +43,10 @@ NASA, Johnson Space Center\n
 */
 
 // System include files.
+#include <cstddef>
 #include <cstdlib>
+#include <cstring>
+#include <map>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -72,19 +77,211 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/encoding/StringUnicodeEncoder.hh"
 #include "TrickHLA/encoding/StringUnicodeFixedArrayEncoder.hh"
 #include "TrickHLA/encoding/StringUnicodeVariableArrayEncoder.hh"
+#include "TrickHLA/utils/MutexLock.hh"
+#include "TrickHLA/utils/MutexProtection.hh"
 
 using namespace RTI1516_NAMESPACE;
 using namespace std;
 using namespace TrickHLA;
 
+namespace
+{
+
+// Trick type information of a member and its offset from the start of the
+// top level variable, which is the same for every variable of that type.
+struct ResolvedMember {
+   ATTRIBUTES    *attr;   // Trick type information of the member.
+   std::ptrdiff_t offset; // Offset of the member from the top level variable.
+};
+
+// Resolved members keyed by the type name of the top level variable followed
+// by the member path, for example 'SpaceFOM::PhysicalEntity.pe_packing_data.state'.
+typedef std::map< std::string, ResolvedMember > ResolvedMemberMap;
+
+ResolvedMemberMap resolved_members;
+bool              resolution_cache_enabled = true;
+unsigned int      resolution_cache_hits    = 0;
+unsigned int      resolution_cache_misses  = 0;
+
+// Mutex for the cache and counts, since pooled objects can resolve their
+// Trick names from the RTI callback thread.
+MutexLock resolution_mutex;
+
+// Resolve a member path of the form '.a.b.c' against the Trick type
+// information of the top level structure, which avoids having Trick parse
+// the full name again. Paths with array indexes, references, static members
+// or members not found in the type information are left to ref_attributes().
+bool resolve_member_path(
+   ATTRIBUTES const *struct_attr,
+   string const     &path,
+   std::ptrdiff_t   *offset,
+   ATTRIBUTES      **member_attr )
+{
+   if ( path.find( '[' ) != string::npos ) {
+      return false;
+   }
+
+   ATTRIBUTES const *current = struct_attr;
+   std::ptrdiff_t    total   = 0;
+
+   string::size_type start = 0;
+   while ( start < path.size() ) {
+      // Only a structure itself, and not an array of or a pointer to a
+      // structure, has its members at a fixed offset.
+      if ( ( current == NULL ) || ( current->type != TRICK_STRUCTURED )
+           || ( current->attr == NULL ) || ( current->num_index != 0 ) ) {
+         return false;
+      }
+
+      string::size_type end = path.find( '.', start + 1 );
+      if ( end == string::npos ) {
+         end = path.size();
+      }
+      string const name = path.substr( start + 1, end - start - 1 );
+
+      ATTRIBUTES *member = static_cast< ATTRIBUTES * >( current->attr );
+      while ( ( member->name != NULL ) && ( member->name[0] != '\0' )
+              && ( strcmp( member->name, name.c_str() ) != 0 ) ) {
+         ++member;
+      }
+      if ( ( member->name == NULL ) || ( member->name[0] == '\0' )
+           || ( ( member->mods & 0x3 ) != 0 ) ) {
+         return false;
+      }
+
+      total += member->offset;
+      current = member;
+      start   = end;
+   }
+
+   *offset      = total;
+   *member_attr = const_cast< ATTRIBUTES * >( current );
+   return ( current != struct_attr );
+}
+
+} // namespace
+
+void EncoderFactory::set_resolution_cache_enabled(
+   bool const enable )
+{
+   MutexProtection auto_unlock_mutex( &resolution_mutex );
+   resolution_cache_enabled = enable;
+}
+
+void EncoderFactory::clear_resolution_cache()
+{
+   MutexProtection auto_unlock_mutex( &resolution_mutex );
+   resolved_members.clear();
+   resolution_cache_hits   = 0;
+   resolution_cache_misses = 0;
+}
+
+unsigned int EncoderFactory::get_resolution_cache_hits()
+{
+   MutexProtection auto_unlock_mutex( &resolution_mutex );
+   return resolution_cache_hits;
+}
+
+unsigned int EncoderFactory::get_resolution_cache_misses()
+{
+   MutexProtection auto_unlock_mutex( &resolution_mutex );
+   return resolution_cache_misses;
+}
+
+/*!
+ * @details Only the top level variable is looked up for a member of a type
+ * that has already been resolved, and the member address is computed from
+ * the cached offset instead of having Trick parse the name and walk the
+ * ATTRIBUTES tables again. A member of a type not resolved yet is found from
+ * the type information of the top level variable, and only a member path
+ * that goes through a pointer or an array index is fully resolved by Trick.
+ */
+bool EncoderFactory::resolve_trick_name(
+   string const &trick_name,
+   void        **address,
+   ATTRIBUTES  **attr )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &resolution_mutex );
+
+   string            key;
+   void             *base_address = NULL;
+   ATTRIBUTES const *base_attr    = NULL;
+
+   string::size_type const dot = trick_name.find( '.' );
+   if ( resolution_cache_enabled
+        && ( dot != string::npos ) && ( dot > 0 )
+        && ( trick_name.find( "->" ) == string::npos ) ) {
+
+      string const base_name = trick_name.substr( 0, dot );
+      REF2        *base_ref  = ref_attributes( base_name.c_str() );
+      if ( base_ref != NULL ) {
+         // The top level variable must reference the structure itself and
+         // not an array of, or a pointer to, the structure.
+         if ( ( base_ref->address != NULL )
+              && ( base_ref->attr != NULL )
+              && ( base_ref->attr->type == TRICK_STRUCTURED )
+              && ( base_ref->attr->type_name != NULL )
+              && ( base_ref->num_index == base_ref->attr->num_index ) ) {
+            base_address = base_ref->address;
+            base_attr    = base_ref->attr;
+            key          = string( base_ref->attr->type_name ) + trick_name.substr( dot );
+         }
+         free( base_ref );
+      }
+
+      if ( !key.empty() ) {
+         ResolvedMemberMap::const_iterator iter = resolved_members.find( key );
+         if ( iter != resolved_members.end() ) {
+            ++resolution_cache_hits;
+            *address = static_cast< char * >( base_address ) + iter->second.offset;
+            *attr    = iter->second.attr;
+            return true;
+         }
+
+         // Reuse the top level variable lookup to resolve the member.
+         ResolvedMember member;
+         if ( resolve_member_path( base_attr, trick_name.substr( dot ), &member.offset, &member.attr ) ) {
+            ++resolution_cache_misses;
+            resolved_members[key] = member;
+            *address              = static_cast< char * >( base_address ) + member.offset;
+            *attr                 = member.attr;
+            return true;
+         }
+      }
+   }
+
+   REF2 *ref2 = ref_attributes( trick_name.c_str() );
+   if ( ref2 == NULL ) {
+      return false;
+   }
+   ++resolution_cache_misses;
+
+   *address = ref2->address;
+   *attr    = ref2->attr;
+
+   if ( !key.empty() && ( ref2->pointer_present == 0 ) && ( ref2->address != NULL ) ) {
+      ResolvedMember member;
+      member.attr           = ref2->attr;
+      member.offset         = static_cast< char * >( ref2->address ) - static_cast< char * >( base_address );
+      resolved_members[key] = member;
+   }
+
+   free( ref2 );
+
+   return true;
+}
+
 EncoderBase *EncoderFactory::create(
    string const      &trick_name,
    EncodingEnum const hla_encoding )
 {
-   REF2 *ref2 = ref_attributes( trick_name.c_str() );
+   void       *address = NULL;
+   ATTRIBUTES *attr    = NULL;
 
    // Determine if we had an error getting the ref-attributes.
-   if ( ref2 == NULL ) {
+   if ( !resolve_trick_name( trick_name, &address, &attr ) ) {
       ostringstream errmsg;
       errmsg << "EncoderFactory::create():" << __LINE__
              << " ERROR: Could not retrieve Trick ref-attributes for '"
@@ -98,11 +295,7 @@ EncoderBase *EncoderFactory::create(
       return NULL;
    }
 
-   EncoderBase *encoder = create( ref2->address, ref2->attr, hla_encoding, trick_name );
-
-   free( ref2 );
-
-   return encoder;
+   return create( address, attr, hla_encoding, trick_name );
 }
 
 EncoderBase *EncoderFactory::create(
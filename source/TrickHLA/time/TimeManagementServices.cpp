@@ -17,6 +17,7 @@ NASA, Johnson Space Center\n
 @tldh
 @trick_link_dependency{TimeManagementServices.cpp}
 @trick_link_dependency{Int64BaseTime.cpp}
+@trick_link_dependency{TimeStragglerMonitor.cpp}
 @trick_link_dependency{TrickThreadCoordinator.cpp}
 @trick_link_dependency{../DebugHandler.cpp}
 @trick_link_dependency{../ExecutionControlBase.cpp}
@@ -24,9 +25,12 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../Federate.cpp}
 @trick_link_dependency{../Manager.cpp}
 @trick_link_dependency{../Types.cpp}
+@trick_link_dependency{../utils/FrameProfiler.cpp}
+@trick_link_dependency{../utils/LatencyHistogram.cpp}
 @trick_link_dependency{../utils/MutexLock.cpp}
 @trick_link_dependency{../utils/MutexProtection.cpp}
 @trick_link_dependency{../utils/SleepTimeout.cpp}
+@trick_link_dependency{../utils/StartupProfiler.cpp}
 @trick_link_dependency{../utils/Utilities.cpp}
 
 @revs_title
@@ -51,6 +55,7 @@ NASA, Johnson Space Center\n
 #include <string>
 
 // Trick includes.
+#include "trick/clock_proto.h"
 #include "trick/exec_proto.h"
 #include "trick/message_proto.h"
 #include "trick/message_type.h"
@@ -67,9 +72,13 @@ NASA, Johnson Space Center\n
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/time/Int64BaseTime.hh"
 #include "TrickHLA/time/TimeManagementServices.hh"
+#include "TrickHLA/time/TimeStragglerMonitor.hh"
 #include "TrickHLA/time/TrickThreadCoordinator.hh"
+#include "TrickHLA/utils/FrameProfiler.hh"
+#include "TrickHLA/utils/LatencyHistogram.hh"
 #include "TrickHLA/utils/MutexProtection.hh"
 #include "TrickHLA/utils/SleepTimeout.hh"
+#include "TrickHLA/utils/StartupProfiler.hh"
 #include "TrickHLA/utils/StringUtilities.hh"
 #include "TrickHLA/utils/Utilities.hh"
 
@@ -112,6 +121,11 @@ TimeManagementServices::TimeManagementServices(
      time_regulating( true ),
      time_constrained( true ),
      time_management( true ),
+#if defined( TRICKHLA_COLLECT_TAG_STATS )
+     TAG_wait_stats_enabled( true ),
+#else
+     TAG_wait_stats_enabled( false ),
+#endif
      lookahead( 0.0 ),
      HLA_cycle_time( 0.0 ),
      HLA_cycle_time_in_base_time( 0 ),
@@ -122,8 +136,7 @@ TimeManagementServices::TimeManagementServices(
      time_adv_state_mutex(),
      time_regulating_state( false ),
      time_constrained_state( false ),
-     tag_wait_sum( 0 ),
-     tag_wait_count( 0 )
+     TAG_wait_stats()
 #if defined( IEEE_1516_2010 )
      ,
      RTI_ambassador( NULL )
@@ -582,6 +595,8 @@ void TimeManagementServices::time_advance_request_to_GALT_LCTS_multiple()
  */
 void TimeManagementServices::setup_time_management()
 {
+   StartupProfilerScope profile_scope( "TimeManagementServices::setup_time_management", "phase" );
+
    if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
       message_publish( MSG_NORMAL, "TimeManagementServices::setup_time_management():%d time_management:%s time_regulating:%s time_constrained:%s\n",
                        __LINE__,
@@ -661,6 +676,8 @@ void TimeManagementServices::set_time_constrained_enabled(
  */
 void TimeManagementServices::setup_time_constrained()
 {
+   StartupProfilerScope profile_scope( "TimeManagementServices::setup_time_constrained", "rti" );
+
    // Just return if HLA time management is not enabled, the user does
    // not want time constrained enabled, or if we are already constrained.
    if ( !this->time_management || !this->time_constrained || this->time_constrained_state ) {
@@ -855,6 +872,8 @@ void TimeManagementServices::set_time_regulation_enabled(
  */
 void TimeManagementServices::setup_time_regulation()
 {
+   StartupProfilerScope profile_scope( "TimeManagementServices::setup_time_regulation", "rti" );
+
    // Just return if HLA time management is not enabled, the user does
    // not want time regulation enabled, or if we are already regulating.
    if ( !this->time_management || !this->time_regulating || this->time_regulating_state ) {
@@ -1040,6 +1059,8 @@ void TimeManagementServices::setup_time_regulation()
  */
 void TimeManagementServices::time_advance_request()
 {
+   FrameProfilerScope profile_scope( federate->frame_profiler, FRAME_STAGE_TIME_ADVANCE_REQUEST );
+
    // Skip requesting time-advancement if we are not time-regulating and
    // not time-constrained (i.e. not using time management).
    if ( !this->time_management ) {
@@ -1386,9 +1407,11 @@ bool TimeManagementServices::verify_time_constraints()
  */
 void TimeManagementServices::wait_for_time_advance_grant()
 {
-#if defined( TRICKHLA_COLLECT_TAG_STATS )
-   int64_t const tag_wait_start_time = clock_wall_time();
-#endif // TRICKHLA_COLLECT_TAG_STATS
+   // The TAG wait is the first job of the data cycle frame.
+   federate->frame_profiler.begin_frame();
+   FrameProfilerScope profile_scope( federate->frame_profiler, FRAME_STAGE_TIME_ADVANCE_GRANT );
+
+   int64_t const tag_wait_start_time = TAG_wait_stats_enabled ? clock_wall_time() : 0;
 
    // Skip requesting time-advancement if time management is not enabled.
    if ( !this->time_management ) {
@@ -1430,6 +1453,8 @@ void TimeManagementServices::wait_for_time_advance_grant()
       SleepTimeout print_timer( federate->get_wait_status_time() );
       SleepTimeout sleep_timer( THLA_LOW_LATENCY_SLEEP_WAIT_IN_MICROS );
 
+      federate->time_straggler_monitor.begin_wait( requested_time.get_base_time() );
+
       // This spin lock waits for the time advance grant from the RTI.
       do {
          // Check for shutdown.
@@ -1446,6 +1471,9 @@ void TimeManagementServices::wait_for_time_advance_grant()
 
          if ( state != TIME_ADVANCE_GRANTED ) {
 
+            // Find the federate holding back the grant if monitoring.
+            federate->time_straggler_monitor.check_wait();
+
             // To be more efficient, we get the time once and share it.
             int64_t wallclock_time = sleep_timer.time();
 
@@ -1465,17 +1493,28 @@ void TimeManagementServices::wait_for_time_advance_grant()
 
             if ( print_timer.timeout( wallclock_time ) ) {
                print_timer.reset();
-               message_publish( MSG_NORMAL, "TimeManagementServices::wait_for_time_advance_grant():%d Waiting...\n",
-                                __LINE__ );
+               string const gating_status = federate->time_straggler_monitor.get_gating_federate_status();
+               if ( gating_status.empty() ) {
+                  message_publish( MSG_NORMAL, "TimeManagementServices::wait_for_time_advance_grant():%d Waiting...\n",
+                                   __LINE__ );
+               } else {
+                  message_publish( MSG_NORMAL, "TimeManagementServices::wait_for_time_advance_grant():%d Waiting for federate %s\n",
+                                   __LINE__, gating_status.c_str() );
+               }
             }
          }
       } while ( state != TIME_ADVANCE_GRANTED );
+
+      federate->time_straggler_monitor.end_wait();
    }
 
-#if defined( TRICKHLA_COLLECT_TAG_STATS )
-   tag_wait_sum += ( clock_wall_time() - tag_wait_start_time );
-   ++tag_wait_count;
-#endif // TRICKHLA_COLLECT_TAG_STATS
+   if ( TAG_wait_stats_enabled ) {
+      // Record the wait in microseconds.
+      int64_t const tag_wait_time = clock_wall_time() - tag_wait_start_time;
+      TAG_wait_stats.record( ( exec_get_time_tic_value() == 1000000 )
+                                ? tag_wait_time
+                                : ( ( tag_wait_time * 1000000 ) / exec_get_time_tic_value() ) );
+   }
 
    // Add the line number for a higher trace level.
    if ( DebugHandler::show( DEBUG_LEVEL_4_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
@@ -0,0 +1,568 @@
+/*!
+@file TrickHLA/time/TimeStragglerMonitor.cpp
+@ingroup TrickHLA
+@brief This class identifies the federate that is holding back the HLA time
+advancement of this federate.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../DebugHandler.cpp}
+@trick_link_dependency{../Federate.cpp}
+@trick_link_dependency{Int64BaseTime.cpp}
+@trick_link_dependency{TimeStragglerMonitor.cpp}
+@trick_link_dependency{../utils/FrameProfiler.cpp}
+@trick_link_dependency{../utils/MutexLock.cpp}
+@trick_link_dependency{../utils/MutexProtection.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System includes.
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Trick includes.
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+
+// TrickHLA includes.
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/Federate.hh"
+#include "TrickHLA/HLAStandardSupport.hh"
+#include "TrickHLA/Types.hh"
+#include "TrickHLA/time/Int64BaseTime.hh"
+#include "TrickHLA/time/TimeStragglerMonitor.hh"
+#include "TrickHLA/utils/FrameProfiler.hh"
+#include "TrickHLA/utils/MutexProtection.hh"
+#include "TrickHLA/utils/StringUtilities.hh"
+#include "TrickHLA/utils/Utilities.hh"
+
+// C++11 deprecated dynamic exception specifications for a function so we need
+// to silence the warnings coming from the IEEE 1516 declared functions.
+// This should work for both GCC and Clang.
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic push
+#   pragma GCC diagnostic ignored "-Wdeprecated"
+#endif
+
+// HLA include files.
+#include "RTI/Exception.h"
+#include "RTI/Handle.h"
+#include "RTI/RTIambassador.h"
+#include "RTI/Typedefs.h"
+#include "RTI/VariableLengthData.h"
+#include "RTI/encoding/BasicDataElements.h"
+#include "RTI/encoding/EncodingExceptions.h"
+
+#if defined( IEEE_1516_2010 )
+#   pragma GCC diagnostic pop
+#endif
+
+using namespace RTI1516_NAMESPACE;
+using namespace std;
+using namespace TrickHLA;
+
+namespace
+{
+
+// Decode a big-endian integer of the given number of bytes.
+uint64_t decode_big_endian(
+   unsigned char const *data,
+   size_t const         size )
+{
+   uint64_t value = 0;
+   for ( size_t i = 0; i < size; ++i ) {
+      value = ( value << 8 ) | data[i];
+   }
+   return value;
+}
+
+// Decode a MOM HLAlogicalTime or HLAtimeInterval attribute, which holds the
+// encoded HLAinteger64Time or HLAinteger64Interval either as is or wrapped in
+// an HLAopaqueData array that is prefixed with a four byte element count.
+bool decode_MOM_int64(
+   VariableLengthData const &value,
+   int64_t                  &result )
+{
+   unsigned char const *data = static_cast< unsigned char const * >( value.data() );
+   if ( ( data != NULL ) && ( value.size() == 8 ) ) {
+      result = (int64_t)decode_big_endian( data, 8 );
+      return true;
+   }
+   if ( ( data != NULL ) && ( value.size() == 12 )
+        && ( decode_big_endian( data, 4 ) == 8 ) ) {
+      result = (int64_t)decode_big_endian( data + 4, 8 );
+      return true;
+   }
+   return false;
+}
+
+// Decode a MOM HLAboolean or enumerated attribute, which is an HLAinteger32BE.
+bool decode_MOM_int32(
+   VariableLengthData const &value,
+   int32_t                  &result )
+{
+   unsigned char const *data = static_cast< unsigned char const * >( value.data() );
+   if ( ( data != NULL ) && ( value.size() == 4 ) ) {
+      result = (int32_t)decode_big_endian( data, 4 );
+      return true;
+   }
+   return false;
+}
+
+// Order the federates by the time they held back our time advancement.
+bool held_longer(
+   StragglerFederateState const *a,
+   StragglerFederateState const *b )
+{
+   return ( a->held_nanos > b->held_nanos );
+}
+
+} // namespace
+
+/*!
+ * @job_class{initialization}
+ */
+TimeStragglerMonitor::TimeStragglerMonitor()
+   : enabled( false ),
+     sample_period( 0.1 ),
+     slow_wait_count( 0 ),
+     held_time( 0.0 ),
+     unattributed_time( 0.0 ),
+     federate( NULL ),
+     subscribed( false ),
+     time_attributes(),
+     waiting( false ),
+     wait_requested_time( 0 ),
+     wait_start_nanos( 0 ),
+     next_sample_nanos( 0 ),
+     attributed_nanos( 0 ),
+     sample_period_nanos( 0 ),
+     mutex(),
+     federates()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+TimeStragglerMonitor::~TimeStragglerMonitor()
+{
+   // Make sure we destroy the mutex.
+   mutex.destroy();
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void TimeStragglerMonitor::initialize(
+   Federate *fed )
+{
+   this->federate = fed;
+
+   if ( !enabled ) {
+      return;
+   }
+
+   if ( sample_period <= 0.0 ) {
+      ostringstream errmsg;
+      errmsg << "TimeStragglerMonitor::initialize():" << __LINE__
+             << " ERROR: The time straggler monitor 'sample_period' must be"
+             << " greater than zero but has a value of " << sample_period
+             << " seconds!" << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+   this->sample_period_nanos = (int64_t)( sample_period * 1000000000.0 );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void TimeStragglerMonitor::begin_wait(
+   int64_t const requested_time )
+{
+   if ( !enabled ) {
+      return;
+   }
+
+   // The MOM HLAfederate attributes are unsubscribed at the end of the
+   // federate startup, so subscribe to the time attributes on the first wait.
+   if ( !subscribed && !subscribe() ) {
+      return;
+   }
+
+   int64_t const now = FrameProfiler::monotonic_time();
+
+   this->waiting             = true;
+   this->wait_requested_time = requested_time;
+   this->wait_start_nanos    = now;
+   this->next_sample_nanos   = now + sample_period_nanos;
+   this->attributed_nanos    = now;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void TimeStragglerMonitor::check_wait()
+{
+   if ( !waiting ) {
+      return;
+   }
+
+   int64_t const now = FrameProfiler::monotonic_time();
+   if ( now < next_sample_nanos ) {
+      return;
+   }
+   this->next_sample_nanos = now + sample_period_nanos;
+
+   // Attribute the time since the last sample with the time attributes from
+   // the previous request, and then ask the RTI for the current ones.
+   attribute_wait_time( now, false );
+   request_update();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void TimeStragglerMonitor::end_wait()
+{
+   if ( !waiting ) {
+      return;
+   }
+   this->waiting = false;
+
+   int64_t const now = FrameProfiler::monotonic_time();
+
+   // Only the slow waits are attributed, since the MOM time attributes are
+   // not requested for the others.
+   if ( ( now - wait_start_nanos ) < sample_period_nanos ) {
+      return;
+   }
+   ++slow_wait_count;
+
+   attribute_wait_time( now, true );
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   map< ObjectInstanceHandle, StragglerFederateState >::iterator iter;
+   for ( iter = federates.begin(); iter != federates.end(); ++iter ) {
+      StragglerFederateState &state = iter->second;
+      if ( state.wait_nanos > 0 ) {
+         ++state.held_count;
+         state.held_nanos += state.wait_nanos;
+         if ( state.wait_nanos > state.max_held_nanos ) {
+            state.max_held_nanos = state.wait_nanos;
+         }
+         state.wait_nanos = 0;
+      }
+   }
+}
+
+void TimeStragglerMonitor::attribute_wait_time(
+   int64_t const now,
+   bool const    last_slice )
+{
+   int64_t const slice = now - attributed_nanos;
+   if ( slice <= 0 ) {
+      return;
+   }
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   StragglerFederateState *gate = find_gating_federate();
+   if ( gate != NULL ) {
+      gate->wait_nanos += slice;
+      this->held_time += (double)slice * 1.0e-9;
+   } else if ( last_slice ) {
+      this->unattributed_time += (double)slice * 1.0e-9;
+   } else {
+      // Keep the slice pending until the requested time attributes arrive.
+      return;
+   }
+   this->attributed_nanos = now;
+}
+
+StragglerFederateState *TimeStragglerMonitor::find_gating_federate()
+{
+   StragglerFederateState *gate       = NULL;
+   int64_t                 gate_bound = 0;
+
+   map< ObjectInstanceHandle, StragglerFederateState >::iterator iter;
+   for ( iter = federates.begin(); iter != federates.end(); ++iter ) {
+      StragglerFederateState &state = iter->second;
+
+      // Only the time regulating federates, other than this one, that reported
+      // their time during this wait can hold back our time advancement.
+      if ( state.resigned || !state.time_known || !state.regulating
+           || ( state.update_nanos < wait_start_nanos )
+           || ( state.name == federate->get_federate_name() ) ) {
+         continue;
+      }
+
+      // A federate holds back our grant while the time stamp of the next
+      // message it can send is not past our requested time.
+      int64_t const bound = state.logical_time + state.lookahead;
+      if ( bound > wait_requested_time ) {
+         continue;
+      }
+
+      // For the same bound, the federate that was granted and is still
+      // computing its frame is the straggler, not one that is also waiting.
+      if ( ( gate == NULL ) || ( bound < gate_bound )
+           || ( ( bound == gate_bound ) && gate->advancing && !state.advancing ) ) {
+         gate       = &state;
+         gate_bound = bound;
+      }
+   }
+   return gate;
+}
+
+string const TimeStragglerMonitor::get_gating_federate_status()
+{
+   if ( !waiting ) {
+      return "";
+   }
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   StragglerFederateState const *gate = find_gating_federate();
+   if ( gate == NULL ) {
+      return "";
+   }
+
+   ostringstream msg;
+   msg << "'" << gate->name << "' at logical time "
+       << setprecision( 12 ) << Int64BaseTime::to_seconds( gate->logical_time )
+       << " with lookahead " << Int64BaseTime::to_seconds( gate->lookahead )
+       << " seconds (" << ( gate->advancing ? "time advancing" : "time granted" )
+       << ")";
+   return msg.str();
+}
+
+void TimeStragglerMonitor::reflect_MOM_time_attributes(
+   ObjectInstanceHandle const    &id,
+   AttributeHandleValueMap const &values )
+{
+   if ( !subscribed ) {
+      return;
+   }
+
+   int64_t const now = FrameProfiler::monotonic_time();
+
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   StragglerFederateState &state = federates[id];
+
+   bool    has_time      = false;
+   bool    has_lookahead = false;
+   int32_t int32_value   = 0;
+
+   AttributeHandleValueMap::const_iterator attr_iter;
+   for ( attr_iter = values.begin(); attr_iter != values.end(); ++attr_iter ) {
+      if ( attr_iter->first == MOM_HLAfederateName_handle ) {
+         try {
+            HLAunicodeString fed_name_unicode;
+            fed_name_unicode.decode( attr_iter->second );
+            StringUtilities::to_string( state.name, wstring( fed_name_unicode ) );
+         } catch ( EncoderException const &e ) {
+            // Keep the name we already have.
+         }
+      } else if ( attr_iter->first == MOM_HLAlogicalTime_handle ) {
+         has_time = decode_MOM_int64( attr_iter->second, state.logical_time );
+      } else if ( attr_iter->first == MOM_HLAlookahead_handle ) {
+         has_lookahead = decode_MOM_int64( attr_iter->second, state.lookahead );
+      } else if ( attr_iter->first == MOM_HLAGALT_handle ) {
+         decode_MOM_int64( attr_iter->second, state.GALT );
+      } else if ( attr_iter->first == MOM_HLALITS_handle ) {
+         decode_MOM_int64( attr_iter->second, state.LITS );
+      } else if ( attr_iter->first == MOM_HLAtimeRegulating_handle ) {
+         if ( decode_MOM_int32( attr_iter->second, int32_value ) ) {
+            state.regulating = ( int32_value != 0 );
+         }
+      } else if ( attr_iter->first == MOM_HLAtimeManagerState_handle ) {
+         // HLAtimeState: HLAtimeGranted is 0 and HLAtimeAdvancing is 1.
+         if ( decode_MOM_int32( attr_iter->second, int32_value ) ) {
+            state.advancing = ( int32_value == 1 );
+         }
+      }
+   }
+
+   // Only a reflection with both the time and lookahead is a fresh bound.
+   if ( has_time && has_lookahead ) {
+      state.time_known   = true;
+      state.update_nanos = now;
+   }
+
+   if ( DebugHandler::show( DEBUG_LEVEL_6_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+      message_publish( MSG_NORMAL, "TimeStragglerMonitor::reflect_MOM_time_attributes():%d Federate:'%s' HLAlogicalTime:%.12G HLAlookahead:%.12G HLAGALT:%.12G HLALITS:%.12G\n",
+                       __LINE__, state.name.c_str(),
+                       Int64BaseTime::to_seconds( state.logical_time ),
+                       Int64BaseTime::to_seconds( state.lookahead ),
+                       Int64BaseTime::to_seconds( state.GALT ),
+                       Int64BaseTime::to_seconds( state.LITS ) );
+   }
+}
+
+void TimeStragglerMonitor::remove_federate(
+   ObjectInstanceHandle const &id )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   map< ObjectInstanceHandle, StragglerFederateState >::iterator iter = federates.find( id );
+   if ( iter != federates.end() ) {
+      iter->second.resigned = true;
+   }
+}
+
+void TimeStragglerMonitor::reset()
+{
+   this->subscribed = false;
+   this->waiting    = false;
+   time_attributes.clear();
+}
+
+bool TimeStragglerMonitor::subscribe()
+{
+   RTIambassador *rti_amb = ( federate != NULL ) ? federate->get_RTI_ambassador() : NULL;
+   if ( rti_amb == NULL ) {
+      return false;
+   }
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   try {
+      this->MOM_HLAfederate_class_handle   = rti_amb->getObjectClassHandle( L"HLAobjectRoot.HLAmanager.HLAfederate" );
+      this->MOM_HLAfederateName_handle     = rti_amb->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLAfederateName" );
+      this->MOM_HLAtimeRegulating_handle   = rti_amb->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLAtimeRegulating" );
+      this->MOM_HLAtimeManagerState_handle = rti_amb->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLAtimeManagerState" );
+      this->MOM_HLAlogicalTime_handle      = rti_amb->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLAlogicalTime" );
+      this->MOM_HLAlookahead_handle        = rti_amb->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLAlookahead" );
+      this->MOM_HLAGALT_handle             = rti_amb->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLAGALT" );
+      this->MOM_HLALITS_handle             = rti_amb->getAttributeHandle( MOM_HLAfederate_class_handle, L"HLALITS" );
+
+      time_attributes.clear();
+      time_attributes.insert( MOM_HLAfederateName_handle );
+      time_attributes.insert( MOM_HLAtimeRegulating_handle );
+      time_attributes.insert( MOM_HLAtimeManagerState_handle );
+      time_attributes.insert( MOM_HLAlogicalTime_handle );
+      time_attributes.insert( MOM_HLAlookahead_handle );
+      time_attributes.insert( MOM_HLAGALT_handle );
+      time_attributes.insert( MOM_HLALITS_handle );
+
+      rti_amb->subscribeObjectClassAttributes( MOM_HLAfederate_class_handle, time_attributes );
+      this->subscribed = true;
+   } catch ( RTI1516_NAMESPACE::Exception const &e ) {
+      string rti_err_msg;
+      StringUtilities::to_string( rti_err_msg, e.what() );
+      message_publish( MSG_WARNING, "TimeStragglerMonitor::subscribe():%d WARNING: \
+Could not subscribe to the MOM HLAfederate time attributes so the time \
+straggler monitor is disabled: %s\n",
+                       __LINE__, rti_err_msg.c_str() );
+      this->enabled = false;
+   }
+
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+
+   return subscribed;
+}
+
+void TimeStragglerMonitor::request_update()
+{
+   RTIambassador *rti_amb = federate->get_RTI_ambassador();
+   if ( rti_amb == NULL ) {
+      return;
+   }
+
+   // Macro to save the FPU Control Word register value.
+   TRICKHLA_SAVE_FPU_CONTROL_WORD;
+
+   try {
+      rti_amb->requestAttributeValueUpdate( MOM_HLAfederate_class_handle,
+                                            time_attributes,
+                                            TrickHLA::EMPTY_USER_SUPPLIED_TAG );
+   } catch ( RTI1516_NAMESPACE::Exception const &e ) {
+      if ( DebugHandler::show( DEBUG_LEVEL_2_TRACE, DEBUG_SOURCE_FEDERATE ) ) {
+         string rti_err_msg;
+         StringUtilities::to_string( rti_err_msg, e.what() );
+         message_publish( MSG_WARNING, "TimeStragglerMonitor::request_update():%d WARNING: \
+Request for the MOM HLAfederate time attributes failed: %s\n",
+                          __LINE__, rti_err_msg.c_str() );
+      }
+   }
+
+   // Macro to restore the saved FPU Control Word register value.
+   TRICKHLA_RESTORE_FPU_CONTROL_WORD;
+   TRICKHLA_VALIDATE_FPU_CONTROL_WORD;
+}
+
+string const TimeStragglerMonitor::to_string()
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   vector< StragglerFederateState const * > held;
+   map< ObjectInstanceHandle, StragglerFederateState >::const_iterator iter;
+   for ( iter = federates.begin(); iter != federates.end(); ++iter ) {
+      if ( iter->second.held_count > 0 ) {
+         held.push_back( &( iter->second ) );
+      }
+   }
+   sort( held.begin(), held.end(), held_longer );
+
+   ostringstream msg;
+   msg << "TimeStragglerMonitor: " << slow_wait_count
+       << " TAG waits longer than " << sample_period << " seconds, "
+       << fixed << setprecision( 3 ) << held_time
+       << " seconds held by a known federate, " << unattributed_time
+       << " seconds unattributed." << endl;
+   if ( !held.empty() ) {
+      msg << "  " << left << setw( 32 ) << "Federate" << right
+          << setw( 10 ) << "Waits" << setw( 14 ) << "Held(s)"
+          << setw( 14 ) << "Max(s)" << setw( 14 ) << "Mean(ms)" << endl;
+      for ( size_t i = 0; i < held.size(); ++i ) {
+         msg << "  " << left << setw( 32 ) << ( "'" + held[i]->name + "'" ) << right
+             << setw( 10 ) << held[i]->held_count
+             << setw( 14 ) << ( (double)held[i]->held_nanos * 1.0e-9 )
+             << setw( 14 ) << ( (double)held[i]->max_held_nanos * 1.0e-9 )
+             << setw( 14 ) << ( ( (double)held[i]->held_nanos * 1.0e-6 ) / (double)held[i]->held_count )
+             << endl;
+      }
+   }
+   return msg.str();
+}
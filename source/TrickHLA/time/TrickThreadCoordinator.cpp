@@ -23,6 +23,7 @@ NASA, Johnson Space Center\n
 @trick_link_dependency{../Manager.cpp}
 @trick_link_dependency{../Object.cpp}
 @trick_link_dependency{../Types.cpp}
+@trick_link_dependency{../utils/FrameProfiler.cpp}
 @trick_link_dependency{../utils/MutexLock.cpp}
 @trick_link_dependency{../utils/MutexProtection.cpp}
 @trick_link_dependency{../utils/SleepTimeout.cpp}
@@ -64,6 +65,7 @@ thread data cycle time being longer than the main thread data cycle time.}
 #include "TrickHLA/Types.hh"
 #include "TrickHLA/time/Int64BaseTime.hh"
 #include "TrickHLA/time/TrickThreadCoordinator.hh"
+#include "TrickHLA/utils/FrameProfiler.hh"
 #include "TrickHLA/utils/MutexProtection.hh"
 #include "TrickHLA/utils/SleepTimeout.hh"
 #include "TrickHLA/utils/StringUtilities.hh"
@@ -801,6 +803,8 @@ void TrickThreadCoordinator::refresh_thread_base_times()
  */
 void TrickThreadCoordinator::announce_data_available()
 {
+   FrameProfilerScope profile_scope( federate->frame_profiler, FRAME_STAGE_ANNOUNCE_DATA_AVAILABLE );
+
    if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
       message_publish( MSG_NORMAL, "TrickThreadCoordinator::announce_data_available():%d\n",
                        __LINE__ );
@@ -835,6 +839,8 @@ void TrickThreadCoordinator::announce_data_available()
  */
 void TrickThreadCoordinator::announce_data_sent()
 {
+   FrameProfilerScope profile_scope( federate->frame_profiler, FRAME_STAGE_ANNOUNCE_DATA_SENT );
+
    if ( DebugHandler::show( DEBUG_LEVEL_5_TRACE, DEBUG_SOURCE_THREAD_COORDINATOR ) ) {
       message_publish( MSG_NORMAL, "TrickThreadCoordinator::announce_data_sent():%d\n",
                        __LINE__ );
@@ -874,6 +880,7 @@ void TrickThreadCoordinator::wait_to_send_data()
       // main thread will wait for all the child threads to be ready to send
       // before returning.
       if ( thread_id == 0 ) {
+         FrameProfilerScope profile_scope( federate->frame_profiler, FRAME_STAGE_WAIT_TO_SEND_DATA );
          wait_to_send_data_for_main_thread();
       } else {
          wait_to_send_data_for_child_thread( thread_id );
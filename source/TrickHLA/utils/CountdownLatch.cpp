@@ -0,0 +1,119 @@
+/*!
+@file TrickHLA/utils/CountdownLatch.cpp
+@ingroup TrickHLA
+@brief TrickHLA countdown latch used to wait for a set of RTI callbacks.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{CountdownLatch.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+*/
+
+// System includes.
+#include <pthread.h>
+#include <sys/time.h>
+#include <time.h>
+
+// TrickHLA includes.
+#include "TrickHLA/utils/CountdownLatch.hh"
+
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+CountdownLatch::CountdownLatch()
+   : count( 0 )
+{
+   pthread_mutex_init( &mutex, NULL );
+   pthread_cond_init( &condition, NULL );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+CountdownLatch::~CountdownLatch()
+{
+   pthread_cond_destroy( &condition );
+   pthread_mutex_destroy( &mutex );
+}
+
+/*!
+ * @details The count must be set before the requests that generate the
+ * callbacks are made so that no callback is missed.
+ */
+void CountdownLatch::reset(
+   unsigned int const pending_count )
+{
+   pthread_mutex_lock( &mutex );
+   this->count = pending_count;
+   if ( this->count == 0 ) {
+      pthread_cond_broadcast( &condition );
+   }
+   pthread_mutex_unlock( &mutex );
+}
+
+bool CountdownLatch::count_down()
+{
+   bool last = false;
+   pthread_mutex_lock( &mutex );
+   if ( this->count > 0 ) {
+      --( this->count );
+      if ( this->count == 0 ) {
+         last = true;
+         pthread_cond_broadcast( &condition );
+      }
+   }
+   pthread_mutex_unlock( &mutex );
+   return last;
+}
+
+unsigned int CountdownLatch::get_count()
+{
+   pthread_mutex_lock( &mutex );
+   unsigned int const pending = this->count;
+   pthread_mutex_unlock( &mutex );
+   return pending;
+}
+
+/*!
+ * @details The wait is bounded so that the caller can periodically check for
+ * shutdown and print status messages while it waits.
+ */
+bool CountdownLatch::wait(
+   long const wait_micros )
+{
+   // Absolute time to wait until, which is what pthread_cond_timedwait needs.
+   struct timeval now;
+   gettimeofday( &now, NULL );
+
+   long const      total_micros = now.tv_usec + ( ( wait_micros > 0 ) ? wait_micros : 0 );
+   struct timespec abs_time;
+   abs_time.tv_sec  = now.tv_sec + ( total_micros / 1000000 );
+   abs_time.tv_nsec = ( total_micros % 1000000 ) * 1000;
+
+   pthread_mutex_lock( &mutex );
+   int status = 0;
+   while ( ( this->count > 0 ) && ( status == 0 ) ) {
+      // Returns ETIMEDOUT when the absolute time has passed.
+      status = pthread_cond_timedwait( &condition, &mutex, &abs_time );
+   }
+   bool const complete = ( this->count == 0 );
+   pthread_mutex_unlock( &mutex );
+
+   return complete;
+}
@@ -0,0 +1,367 @@
+/*!
+@file TrickHLA/utils/FrameProfiler.cpp
+@ingroup TrickHLA
+@brief TrickHLA per-frame profiler of the THLABase.sm data cycle job chain.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../DebugHandler.cpp}
+@trick_link_dependency{FrameProfiler.cpp}
+@trick_link_dependency{LatencyHistogram.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System includes.
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <time.h>
+#include <vector>
+
+// Trick includes.
+#include "trick/exec_proto.h"
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+#include "trick/sim_mode.h"
+
+// TrickHLA includes.
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/utils/FrameProfiler.hh"
+#include "TrickHLA/utils/LatencyHistogram.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+FrameProfiler::FrameProfiler()
+   : enabled( false ),
+     window_size( 1000 ),
+     report_period( 1000 ),
+     csv_file(),
+     csv_flush_reports( 10 ),
+     frame_count( 0 ),
+     frame_start_nanos( 0 ),
+     period_histograms(),
+     window_histograms(),
+     window_periods( 1 ),
+     period_next( 0 ),
+     csv_rows(),
+     csv_pending_reports( 0 )
+{
+   for ( int s = 0; s < THLA_FRAME_STAGE_COUNT; ++s ) {
+      last_us[s]      = 0.0;
+      p50_us[s]       = 0.0;
+      p99_us[s]       = 0.0;
+      p999_us[s]      = 0.0;
+      max_us[s]       = 0.0;
+      stage_nanos[s]  = 0;
+      stage_ran[s]    = false;
+      window_count[s] = 0;
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+FrameProfiler::~FrameProfiler()
+{
+   return;
+}
+
+/*!
+ * @job_class{initialization}
+ */
+void FrameProfiler::initialize()
+{
+   if ( !enabled ) {
+      return;
+   }
+
+   if ( window_size <= 0 ) {
+      ostringstream errmsg;
+      errmsg << "FrameProfiler::initialize():" << __LINE__
+             << " ERROR: The frame profiler 'window_size' must be greater than"
+             << " zero but has a value of " << window_size << "!" << endl;
+      DebugHandler::terminate_with_message( errmsg.str() );
+   }
+
+   // The window is made of whole report periods, where without periodic
+   // reports the window is every frame.
+   this->window_periods = ( report_period > 0 )
+                             ? ( ( window_size + report_period - 1 ) / report_period )
+                             : 1;
+   this->period_next = 0;
+   period_histograms.assign( (size_t)window_periods * THLA_FRAME_STAGE_COUNT, LatencyHistogram() );
+   window_histograms.assign( THLA_FRAME_STAGE_COUNT, LatencyHistogram() );
+
+   // Write the CSV header now so the rows can be appended as they are flushed.
+   if ( !csv_file.empty() ) {
+      ofstream csv( csv_file.c_str(), ios::out | ios::trunc );
+      if ( csv.is_open() ) {
+         csv << "frame,stage,samples,p50_us,p99_us,p999_us,max_us\n";
+      } else {
+         message_publish( MSG_WARNING, "FrameProfiler::initialize():%d WARNING: Could not open the frame profile CSV file '%s'.\n",
+                          __LINE__, csv_file.c_str() );
+         this->csv_file.clear();
+      }
+   }
+}
+
+/*!
+ * @details The stage times of the ending frame are added to the histograms
+ * of the current report period, and every report_period frames the
+ * statistics are updated. The initialization pass is not profiled.
+ * @job_class{scheduled}
+ */
+void FrameProfiler::begin_frame()
+{
+   if ( !enabled || period_histograms.empty() || ( exec_get_mode() == Initialization ) ) {
+      return;
+   }
+
+   int64_t const now = monotonic_time();
+
+   if ( frame_start_nanos != 0 ) {
+      stage_nanos[FRAME_STAGE_FRAME] = now - frame_start_nanos;
+      stage_ran[FRAME_STAGE_FRAME]   = true;
+
+      LatencyHistogram *period = &period_histograms[(size_t)period_next * THLA_FRAME_STAGE_COUNT];
+      for ( int s = 0; s < THLA_FRAME_STAGE_COUNT; ++s ) {
+         if ( stage_ran[s] ) {
+            period[s].record( stage_nanos[s] );
+            last_us[s] = (double)stage_nanos[s] * 0.001;
+         } else {
+            last_us[s] = 0.0;
+         }
+      }
+      ++frame_count;
+
+      if ( ( report_period > 0 ) && ( ( frame_count % report_period ) == 0 ) ) {
+         report();
+         next_period();
+      }
+   }
+
+   // Stage times recorded outside of a frame are discarded.
+   for ( int s = 0; s < THLA_FRAME_STAGE_COUNT; ++s ) {
+      stage_nanos[s] = 0;
+      stage_ran[s]   = false;
+   }
+   this->frame_start_nanos = now;
+}
+
+/*!
+ * @job_class{freeze}
+ */
+void FrameProfiler::discard_frame()
+{
+   this->frame_start_nanos = 0;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void FrameProfiler::report()
+{
+   if ( !enabled || period_histograms.empty() ) {
+      return;
+   }
+   update_statistics();
+   buffer_csv();
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void FrameProfiler::shutdown()
+{
+   if ( !enabled || period_histograms.empty() ) {
+      return;
+   }
+
+   // Report the partial report period, if any, since the last report.
+   if ( ( report_period <= 0 ) || ( ( frame_count % report_period ) != 0 ) ) {
+      report();
+   }
+   write_csv();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void FrameProfiler::update_statistics()
+{
+   for ( int s = 0; s < THLA_FRAME_STAGE_COUNT; ++s ) {
+      LatencyHistogram &stage_window = window_histograms[s];
+      stage_window.reset();
+      for ( int p = 0; p < window_periods; ++p ) {
+         stage_window.merge( period_histograms[( (size_t)p * THLA_FRAME_STAGE_COUNT ) + s] );
+      }
+
+      window_count[s] = (int)stage_window.get_count();
+      p50_us[s]       = (double)stage_window.get_percentile( 50.0 ) * 0.001;
+      p99_us[s]       = (double)stage_window.get_percentile( 99.0 ) * 0.001;
+      p999_us[s]      = (double)stage_window.get_percentile( 99.9 ) * 0.001;
+      max_us[s]       = (double)stage_window.get_max() * 0.001;
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void FrameProfiler::next_period()
+{
+   this->period_next = ( period_next + 1 ) % window_periods;
+
+   LatencyHistogram *period = &period_histograms[(size_t)period_next * THLA_FRAME_STAGE_COUNT];
+   for ( int s = 0; s < THLA_FRAME_STAGE_COUNT; ++s ) {
+      period[s].reset();
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void FrameProfiler::buffer_csv()
+{
+   if ( csv_file.empty() ) {
+      return;
+   }
+
+   ostringstream rows;
+   rows << fixed << setprecision( 3 );
+   for ( int s = 0; s < THLA_FRAME_STAGE_COUNT; ++s ) {
+      rows << frame_count << ','
+           << get_stage_name( (FrameStageEnum)s ) << ','
+           << window_count[s] << ','
+           << p50_us[s] << ','
+           << p99_us[s] << ','
+           << p999_us[s] << ','
+           << max_us[s] << '\n';
+   }
+   csv_rows += rows.str();
+   ++csv_pending_reports;
+}
+
+/*!
+ * @details Appending the rows every csv_flush_reports reports bounds the rows
+ * lost if the federate does not reach its shutdown, while keeping the file
+ * writes out of most of the frames.
+ * @job_class{logging}
+ */
+void FrameProfiler::flush_csv()
+{
+   if ( !enabled || ( csv_flush_reports <= 0 ) || ( csv_pending_reports < csv_flush_reports ) ) {
+      return;
+   }
+   write_csv();
+}
+
+/*!
+ * @job_class{logging}
+ */
+void FrameProfiler::write_csv()
+{
+   if ( csv_file.empty() || csv_rows.empty() ) {
+      return;
+   }
+
+   ofstream csv( csv_file.c_str(), ios::out | ios::app );
+   if ( !csv.is_open() ) {
+      message_publish( MSG_WARNING, "FrameProfiler::write_csv():%d WARNING: Could not open the frame profile CSV file '%s'.\n",
+                       __LINE__, csv_file.c_str() );
+      return;
+   }
+   csv << csv_rows;
+   csv_rows.clear();
+   this->csv_pending_reports = 0;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+std::string const FrameProfiler::to_string()
+{
+   ostringstream msg;
+   msg << "FrameProfiler::to_string():" << __LINE__
+       << " Frames:" << frame_count << endl
+       << setw( 24 ) << "stage"
+       << setw( 10 ) << "samples"
+       << setw( 14 ) << "p50 (us)"
+       << setw( 14 ) << "p99 (us)"
+       << setw( 14 ) << "p99.9 (us)"
+       << setw( 14 ) << "max (us)" << endl
+       << fixed << setprecision( 1 );
+   for ( int s = 0; s < THLA_FRAME_STAGE_COUNT; ++s ) {
+      msg << setw( 24 ) << get_stage_name( (FrameStageEnum)s )
+          << setw( 10 ) << window_count[s]
+          << setw( 14 ) << p50_us[s]
+          << setw( 14 ) << p99_us[s]
+          << setw( 14 ) << p999_us[s]
+          << setw( 14 ) << max_us[s] << endl;
+   }
+   return msg.str();
+}
+
+char const *FrameProfiler::get_stage_name(
+   FrameStageEnum const stage )
+{
+   switch ( stage ) {
+      case FRAME_STAGE_TIME_ADVANCE_GRANT:
+         return "time_advance_grant";
+      case FRAME_STAGE_PROCESS_INTERACTIONS:
+         return "process_interactions";
+      case FRAME_STAGE_PROCESS_DELETED_OBJECTS:
+         return "process_deleted_objects";
+      case FRAME_STAGE_RECEIVE_CYCLIC_DATA:
+         return "receive_cyclic_data";
+      case FRAME_STAGE_ANNOUNCE_DATA_AVAILABLE:
+         return "announce_data_available";
+      case FRAME_STAGE_WAIT_TO_SEND_DATA:
+         return "wait_to_send_data";
+      case FRAME_STAGE_SEND_CYCLIC_DATA:
+         return "send_cyclic_data";
+      case FRAME_STAGE_ENCODE:
+         return "encode";
+      case FRAME_STAGE_RTI_SEND:
+         return "rti_send";
+      case FRAME_STAGE_PROCESS_OWNERSHIP:
+         return "process_ownership";
+      case FRAME_STAGE_ANNOUNCE_DATA_SENT:
+         return "announce_data_sent";
+      case FRAME_STAGE_TIME_ADVANCE_REQUEST:
+         return "time_advance_request";
+      case FRAME_STAGE_FRAME:
+         return "frame";
+      default:
+         return "unknown";
+   }
+}
+
+int64_t FrameProfiler::monotonic_time()
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts ); // NOLINT
+   return ( ( (int64_t)ts.tv_sec * 1000000000 ) + (int64_t)ts.tv_nsec );
+}
@@ -0,0 +1,288 @@
+/*!
+@file TrickHLA/utils/LatencyHistogram.cpp
+@ingroup TrickHLA
+@brief This class is a fixed memory, log-bucketed latency histogram with
+percentile queries.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{LatencyHistogram.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System includes.
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// TrickHLA includes.
+#include "TrickHLA/utils/LatencyHistogram.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+namespace
+{
+
+// Number of linear sub-bucket bits for each power of two.
+unsigned int const SUB_BUCKET_BITS = 5;
+
+// Number of sub-buckets for each power of two.
+unsigned int const SUB_BUCKET_COUNT = ( 1U << SUB_BUCKET_BITS );
+
+// Values below this have their own bucket.
+unsigned int const LINEAR_COUNT = ( 2U * SUB_BUCKET_COUNT );
+
+// Most significant bit of the first value above the linear buckets.
+unsigned int const FIRST_LOG_BIT = SUB_BUCKET_BITS + 1;
+
+// Highest most significant bit with its own buckets. Larger values are
+// recorded in the last bucket.
+unsigned int const LAST_LOG_BIT = 40;
+
+unsigned int const BUCKET_COUNT = LINEAR_COUNT
+                                  + ( ( LAST_LOG_BIT - FIRST_LOG_BIT + 1 ) * SUB_BUCKET_COUNT );
+
+// Index of the most significant set bit of a positive value.
+unsigned int most_significant_bit(
+   uint64_t value )
+{
+   unsigned int bit = 0;
+   if ( value >= ( 1ULL << 32 ) ) {
+      value >>= 32;
+      bit += 32;
+   }
+   if ( value >= ( 1ULL << 16 ) ) {
+      value >>= 16;
+      bit += 16;
+   }
+   if ( value >= ( 1ULL << 8 ) ) {
+      value >>= 8;
+      bit += 8;
+   }
+   if ( value >= ( 1ULL << 4 ) ) {
+      value >>= 4;
+      bit += 4;
+   }
+   if ( value >= ( 1ULL << 2 ) ) {
+      value >>= 2;
+      bit += 2;
+   }
+   if ( value >= ( 1ULL << 1 ) ) {
+      bit += 1;
+   }
+   return bit;
+}
+
+} // namespace
+
+/*!
+ * @job_class{initialization}
+ */
+LatencyHistogram::LatencyHistogram()
+   : counts(),
+     count( 0 ),
+     min( 0 ),
+     max( 0 ),
+     sum( 0.0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+LatencyHistogram::~LatencyHistogram()
+{
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void LatencyHistogram::record(
+   int64_t const value )
+{
+   int64_t const v = ( value > 0 ) ? value : 0;
+
+   if ( counts.empty() ) {
+      counts.assign( BUCKET_COUNT, 0 );
+   }
+   ++counts[bucket_index( v )];
+
+   if ( count == 0 ) {
+      this->min = v;
+      this->max = v;
+   } else if ( v < min ) {
+      this->min = v;
+   } else if ( v > max ) {
+      this->max = v;
+   }
+   this->sum += (double)v;
+   ++count;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void LatencyHistogram::merge(
+   LatencyHistogram const &other )
+{
+   if ( other.count == 0 ) {
+      return;
+   }
+   if ( counts.empty() ) {
+      counts.assign( BUCKET_COUNT, 0 );
+   }
+   for ( size_t i = 0; i < other.counts.size(); ++i ) {
+      counts[i] += other.counts[i];
+   }
+
+   if ( count == 0 ) {
+      this->min = other.min;
+      this->max = other.max;
+   } else {
+      if ( other.min < min ) {
+         this->min = other.min;
+      }
+      if ( other.max > max ) {
+         this->max = other.max;
+      }
+   }
+   this->sum += other.sum;
+   this->count += other.count;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void LatencyHistogram::reset()
+{
+   if ( !counts.empty() ) {
+      counts.assign( BUCKET_COUNT, 0 );
+   }
+   this->count = 0;
+   this->min   = 0;
+   this->max   = 0;
+   this->sum   = 0.0;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+int64_t LatencyHistogram::get_percentile(
+   double const percentile ) const
+{
+   if ( count == 0 ) {
+      return 0;
+   }
+   if ( percentile <= 0.0 ) {
+      return min;
+   }
+
+   // Rank of the value at the percentile, from 1 to count.
+   uint64_t rank = (uint64_t)( ( ( percentile / 100.0 ) * (double)count ) + 0.999999 );
+   if ( rank < 1 ) {
+      rank = 1;
+   } else if ( rank > count ) {
+      rank = count;
+   }
+
+   uint64_t total = 0;
+   for ( size_t i = 0; i < counts.size(); ++i ) {
+      total += counts[i];
+      if ( total >= rank ) {
+         // The last bucket also holds the values beyond the bucket range.
+         if ( i == ( BUCKET_COUNT - 1 ) ) {
+            return max;
+         }
+         int64_t const value = bucket_highest_value( (unsigned int)i );
+         return ( value < max ) ? value : max;
+      }
+   }
+   return max;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+std::string const LatencyHistogram::to_string(
+   std::string const &units,
+   double const       scale ) const
+{
+   ostringstream msg;
+   if ( count > 0 ) {
+      msg << "    sample-count: " << count << endl
+          << "             min: " << ( (double)min * scale ) << " " << units << endl
+          << "             p50: " << ( (double)get_percentile( 50.0 ) * scale ) << " " << units << endl
+          << "             p90: " << ( (double)get_percentile( 90.0 ) * scale ) << " " << units << endl
+          << "             p99: " << ( (double)get_percentile( 99.0 ) * scale ) << " " << units << endl
+          << "           p99.9: " << ( (double)get_percentile( 99.9 ) * scale ) << " " << units << endl
+          << "          p99.99: " << ( (double)get_percentile( 99.99 ) * scale ) << " " << units << endl
+          << "             max: " << ( (double)max * scale ) << " " << units << endl
+          << "            mean: " << ( get_mean() * scale ) << " " << units;
+   } else {
+      msg << "    sample-count: " << count << endl
+          << "             min: N/A" << endl
+          << "             p50: N/A" << endl
+          << "             p99: N/A" << endl
+          << "             max: N/A";
+   }
+   return msg.str();
+}
+
+unsigned int LatencyHistogram::get_bucket_count()
+{
+   return BUCKET_COUNT;
+}
+
+unsigned int LatencyHistogram::bucket_index(
+   int64_t const value )
+{
+   if ( value < (int64_t)LINEAR_COUNT ) {
+      return (unsigned int)value;
+   }
+
+   unsigned int const msb = most_significant_bit( (uint64_t)value );
+   if ( msb > LAST_LOG_BIT ) {
+      return BUCKET_COUNT - 1;
+   }
+
+   // The top SUB_BUCKET_BITS + 1 bits of the value select the sub-bucket.
+   unsigned int const sub_bucket = (unsigned int)( (uint64_t)value >> ( msb - SUB_BUCKET_BITS ) ) - SUB_BUCKET_COUNT;
+
+   return LINEAR_COUNT + ( ( msb - FIRST_LOG_BIT ) * SUB_BUCKET_COUNT ) + sub_bucket;
+}
+
+int64_t LatencyHistogram::bucket_highest_value(
+   unsigned int const index )
+{
+   if ( index < LINEAR_COUNT ) {
+      return (int64_t)index;
+   }
+
+   unsigned int const log_index  = index - LINEAR_COUNT;
+   unsigned int const msb        = FIRST_LOG_BIT + ( log_index / SUB_BUCKET_COUNT );
+   uint64_t const     sub_bucket = SUB_BUCKET_COUNT + ( log_index % SUB_BUCKET_COUNT );
+   unsigned int const shift      = msb - SUB_BUCKET_BITS;
+
+   return (int64_t)( ( ( sub_bucket + 1 ) << shift ) - 1 );
+}
@@ -0,0 +1,235 @@
+/*!
+@file TrickHLA/utils/QueueStats.cpp
+@ingroup TrickHLA
+@brief This class tracks the depth, high-water mark, enqueue and dequeue
+rates and the age of the oldest item of a queue.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{../DebugHandler.cpp}
+@trick_link_dependency{MutexLock.cpp}
+@trick_link_dependency{MutexProtection.cpp}
+@trick_link_dependency{QueueStats.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System includes.
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <time.h>
+
+// Trick includes.
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+
+// TrickHLA includes.
+#include "TrickHLA/DebugHandler.hh"
+#include "TrickHLA/utils/MutexLock.hh"
+#include "TrickHLA/utils/MutexProtection.hh"
+#include "TrickHLA/utils/QueueStats.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+// Length of the period the enqueue and dequeue rates are measured over.
+#define THLA_QUEUE_RATE_PERIOD_NANOS 1000000000LL
+
+/*!
+ * @job_class{initialization}
+ */
+QueueStats::QueueStats()
+   : depth( 0 ),
+     high_water_mark( 0 ),
+     enqueue_count( 0 ),
+     dequeue_count( 0 ),
+     enqueue_rate( 0.0 ),
+     dequeue_rate( 0.0 ),
+     oldest_item_age( 0.0 ),
+     name(),
+     nonempty_since( 0 ),
+     oldest_item_time( 0 ),
+     rate_start_time( 0 ),
+     rate_start_enqueue( 0 ),
+     rate_start_dequeue( 0 ),
+     warning_active( false ),
+     warning_pending( false ),
+     warning_depth( 0 ),
+     warning_age( 0.0 ),
+     mutex()
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+QueueStats::~QueueStats()
+{
+   // Make sure we destroy the mutex.
+   mutex.destroy();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void QueueStats::record_depth(
+   size_t const  new_depth,
+   int64_t const oldest_time,
+   int64_t const now )
+{
+   // When auto_unlock_mutex goes out of scope it automatically unlocks the
+   // mutex even if there is an exception.
+   MutexProtection auto_unlock_mutex( &mutex );
+
+   if ( new_depth > depth ) {
+      enqueue_count += ( new_depth - depth );
+   } else {
+      dequeue_count += ( depth - new_depth );
+   }
+
+   if ( new_depth == 0 ) {
+      this->nonempty_since = 0;
+   } else if ( depth == 0 ) {
+      this->nonempty_since = now;
+   }
+   this->depth = new_depth;
+
+   if ( depth > high_water_mark ) {
+      this->high_water_mark = depth;
+   }
+
+   if ( depth == 0 ) {
+      this->oldest_item_time = 0;
+   } else {
+      this->oldest_item_time = ( oldest_time > 0 ) ? oldest_time : nonempty_since;
+   }
+
+   update( now );
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void QueueStats::refresh()
+{
+   bool     publish = false;
+   uint64_t pending_depth;
+   double   pending_age;
+   {
+      // When auto_unlock_mutex goes out of scope it automatically unlocks the
+      // mutex even if there is an exception.
+      MutexProtection auto_unlock_mutex( &mutex );
+
+      update( monotonic_time() );
+
+      if ( warning_pending ) {
+         this->warning_pending = false;
+         publish               = true;
+         pending_depth         = warning_depth;
+         pending_age           = warning_age;
+      }
+   }
+
+   // Publish the warning with the mutex unlocked.
+   if ( publish ) {
+      message_publish( MSG_WARNING, "QueueStats::refresh():%d WARNING: \
+Queue '%s' has a backlog of %llu items and its oldest item is %.6f seconds old, \
+which exceeds the warning threshold of %d items or %.6f seconds.\n",
+                       __LINE__, name.c_str(), (unsigned long long)pending_depth,
+                       pending_age, DebugHandler::queue_depth_warning,
+                       DebugHandler::queue_age_warning );
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void QueueStats::update(
+   int64_t const now )
+{
+   if ( depth == 0 ) {
+      this->oldest_item_age = 0.0;
+   } else {
+      this->oldest_item_age = (double)( now - oldest_item_time ) * 1.0e-9;
+   }
+
+   // Update the rates once per rate period.
+   if ( rate_start_time == 0 ) {
+      this->rate_start_time = now;
+   } else if ( ( now - rate_start_time ) >= THLA_QUEUE_RATE_PERIOD_NANOS ) {
+      double const period = (double)( now - rate_start_time ) * 1.0e-9;
+
+      this->enqueue_rate       = (double)( enqueue_count - rate_start_enqueue ) / period;
+      this->dequeue_rate       = (double)( dequeue_count - rate_start_dequeue ) / period;
+      this->rate_start_time    = now;
+      this->rate_start_enqueue = enqueue_count;
+      this->rate_start_dequeue = dequeue_count;
+   }
+
+   if ( !name.empty() ) {
+      check_thresholds();
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void QueueStats::check_thresholds()
+{
+   bool const over_depth = ( DebugHandler::queue_depth_warning > 0 )
+                           && ( depth > (uint64_t)DebugHandler::queue_depth_warning );
+   bool const over_age = ( DebugHandler::queue_age_warning > 0.0 )
+                         && ( oldest_item_age > DebugHandler::queue_age_warning );
+
+   if ( over_depth || over_age ) {
+      if ( !warning_active ) {
+         // Keep the warning until refresh() publishes it from the main thread.
+         this->warning_active  = true;
+         this->warning_pending = true;
+         this->warning_depth   = depth;
+         this->warning_age     = oldest_item_age;
+      }
+   } else {
+      this->warning_active = false;
+   }
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+std::string const QueueStats::to_string() const
+{
+   ostringstream msg;
+   msg << "depth:" << depth
+       << " high-water-mark:" << high_water_mark
+       << " enqueued:" << enqueue_count
+       << " dequeued:" << dequeue_count
+       << " enqueue-rate:" << enqueue_rate << "/s"
+       << " dequeue-rate:" << dequeue_rate << "/s"
+       << " oldest-item-age:" << oldest_item_age << "s";
+   return msg.str();
+}
+
+int64_t QueueStats::monotonic_time()
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts ); // NOLINT
+   return ( ( (int64_t)ts.tv_sec * 1000000000 ) + (int64_t)ts.tv_nsec );
+}
@@ -0,0 +1,221 @@
+/*!
+@file TrickHLA/utils/StartupProfiler.cpp
+@ingroup TrickHLA
+@brief TrickHLA startup profiler that records the wall clock begin and end
+times of the initialization phases, RTI calls and wait loops, and writes them
+as a Chrome trace-event JSON file.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{StartupProfiler.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+*/
+
+// System includes.
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <pthread.h>
+#include <string>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+// Trick includes.
+#include "trick/message_proto.h"
+#include "trick/message_type.h"
+
+// TrickHLA includes.
+#include "TrickHLA/utils/StartupProfiler.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+namespace
+{
+
+// A completed startup event.
+struct StartupEvent {
+   char const *name;         // Name of the event, a string literal.
+   char const *category;     // Category of the event, a string literal.
+   int64_t     begin_micros; // Wall clock begin time in microseconds.
+   int64_t     end_micros;   // Wall clock end time in microseconds.
+   int         thread_id;    // Index of the recording thread.
+};
+
+pthread_mutex_t        profiler_mutex = PTHREAD_MUTEX_INITIALIZER;
+atomic< bool >         recording( false ); // Set with the mutex locked, read without it.
+string                 trace_process_name;
+string                 trace_file_name;
+vector< StartupEvent > events;
+vector< pthread_t >    threads;
+
+// Escape a string for use in a JSON string value.
+string json_escape(
+   string const &str )
+{
+   string escaped;
+   for ( size_t i = 0; i < str.size(); ++i ) {
+      char const c = str[i];
+      if ( ( c == '"' ) || ( c == '\\' ) ) {
+         escaped += '\\';
+         escaped += c;
+      } else if ( (unsigned char)c < 0x20 ) {
+         escaped += ' ';
+      } else {
+         escaped += c;
+      }
+   }
+   return escaped;
+}
+
+// Index of the calling thread, with the profiler mutex locked.
+int thread_index()
+{
+   pthread_t const self = pthread_self();
+   for ( size_t i = 0; i < threads.size(); ++i ) {
+      if ( pthread_equal( threads[i], self ) ) {
+         return (int)i;
+      }
+   }
+   threads.push_back( self );
+   return (int)( threads.size() - 1 );
+}
+
+} // namespace
+
+/*!
+ * @details Events are only recorded between start() and finish(), so the
+ * instrumented functions that also run during the simulation cost a single
+ * flag check once the startup is complete.
+ * @job_class{initialization}
+ */
+void StartupProfiler::start(
+   string const &process_name,
+   string const &file_name )
+{
+   pthread_mutex_lock( &profiler_mutex );
+   trace_process_name = process_name;
+   trace_file_name    = file_name;
+   events.clear();
+   threads.clear();
+   threads.push_back( pthread_self() );
+   recording = true;
+   pthread_mutex_unlock( &profiler_mutex );
+}
+
+bool StartupProfiler::is_recording()
+{
+   return recording;
+}
+
+void StartupProfiler::add_event(
+   char const   *name,
+   char const   *category,
+   int64_t const begin_micros,
+   int64_t const end_micros )
+{
+   pthread_mutex_lock( &profiler_mutex );
+   if ( recording ) {
+      StartupEvent event;
+      event.name         = name;
+      event.category     = category;
+      event.begin_micros = begin_micros;
+      event.end_micros   = end_micros;
+      event.thread_id    = thread_index();
+      events.push_back( event );
+   }
+   pthread_mutex_unlock( &profiler_mutex );
+}
+
+/*!
+ * @details The events are written as complete ('X') events with the process
+ * ID as the trace 'pid' and the federate name as the process name, so that
+ * the trace files of several federates can be merged into one timeline.
+ * @job_class{initialization}
+ */
+bool StartupProfiler::finish()
+{
+   pthread_mutex_lock( &profiler_mutex );
+   if ( !recording ) {
+      pthread_mutex_unlock( &profiler_mutex );
+      return false;
+   }
+   recording = false;
+
+   ofstream trace( trace_file_name.c_str() );
+   if ( !trace.is_open() ) {
+      pthread_mutex_unlock( &profiler_mutex );
+      message_publish( MSG_WARNING, "StartupProfiler::finish():%d WARNING: Could not open the startup trace file '%s'.\n",
+                       __LINE__, trace_file_name.c_str() );
+      return false;
+   }
+
+   long const pid = (long)getpid();
+
+   trace << "{\"traceEvents\":[" << endl
+         << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+         << ",\"tid\":0,\"args\":{\"name\":\"" << json_escape( trace_process_name ) << "\"}}";
+   for ( size_t i = 0; i < events.size(); ++i ) {
+      StartupEvent const &event = events[i];
+      trace << "," << endl
+            << "{\"name\":\"" << json_escape( event.name )
+            << "\",\"cat\":\"" << json_escape( event.category )
+            << "\",\"ph\":\"X\",\"ts\":" << event.begin_micros
+            << ",\"dur\":" << ( event.end_micros - event.begin_micros )
+            << ",\"pid\":" << pid
+            << ",\"tid\":" << event.thread_id << "}";
+   }
+   trace << endl
+         << "],\"displayTimeUnit\":\"ms\"}" << endl;
+   trace.close();
+
+   size_t const event_count = events.size();
+   events.clear();
+   threads.clear();
+   pthread_mutex_unlock( &profiler_mutex );
+
+   message_publish( MSG_NORMAL, "StartupProfiler::finish():%d Wrote %d startup events to '%s'.\n",
+                    __LINE__, (int)event_count, trace_file_name.c_str() );
+   return true;
+}
+
+int64_t StartupProfiler::wall_time()
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_REALTIME, &ts ); // NOLINT
+   return ( ( (int64_t)ts.tv_sec * 1000000 ) + ( (int64_t)ts.tv_nsec / 1000 ) );
+}
+
+StartupProfilerScope::StartupProfilerScope(
+   char const *event_name,
+   char const *event_category )
+   : name( event_name ),
+     category( event_category ),
+     begin_micros( StartupProfiler::is_recording() ? StartupProfiler::wall_time() : 0 )
+{
+   return;
+}
+
+StartupProfilerScope::~StartupProfilerScope()
+{
+   if ( ( begin_micros != 0 ) && StartupProfiler::is_recording() ) {
+      StartupProfiler::add_event( name, category, begin_micros,
+                                  StartupProfiler::wall_time() );
+   }
+}
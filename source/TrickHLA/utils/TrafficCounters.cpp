@@ -0,0 +1,87 @@
+/*!
+@file TrickHLA/utils/TrafficCounters.cpp
+@ingroup TrickHLA
+@brief This class counts the updates, items and encoded bytes sent and
+received for an object, attribute or interaction.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{TrafficCounters.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System includes.
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+// TrickHLA includes.
+#include "TrickHLA/utils/TrafficCounters.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+/*!
+ * @job_class{initialization}
+ */
+TrafficCounters::TrafficCounters()
+   : send_updates( 0 ),
+     send_items( 0 ),
+     send_bytes( 0 ),
+     receive_updates( 0 ),
+     receive_items( 0 ),
+     receive_bytes( 0 )
+{
+   return;
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+TrafficCounters::~TrafficCounters()
+{
+   return;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void TrafficCounters::reset()
+{
+   __atomic_store_n( &send_updates, 0, __ATOMIC_RELAXED );
+   __atomic_store_n( &send_items, 0, __ATOMIC_RELAXED );
+   __atomic_store_n( &send_bytes, 0, __ATOMIC_RELAXED );
+   __atomic_store_n( &receive_updates, 0, __ATOMIC_RELAXED );
+   __atomic_store_n( &receive_items, 0, __ATOMIC_RELAXED );
+   __atomic_store_n( &receive_bytes, 0, __ATOMIC_RELAXED );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+std::string const TrafficCounters::to_string() const
+{
+   ostringstream msg;
+   msg << "sent:" << get_send_updates()
+       << " (" << __atomic_load_n( &send_items, __ATOMIC_RELAXED ) << " items, "
+       << get_send_bytes() << " bytes)"
+       << " received:" << get_receive_updates()
+       << " (" << __atomic_load_n( &receive_items, __ATOMIC_RELAXED ) << " items, "
+       << get_receive_bytes() << " bytes)";
+   return msg.str();
+}
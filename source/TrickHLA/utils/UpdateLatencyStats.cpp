@@ -0,0 +1,289 @@
+/*!
+@file TrickHLA/utils/UpdateLatencyStats.cpp
+@ingroup TrickHLA
+@brief This class measures the end-to-end latency of the attribute updates of
+an object instance using a compact header in the HLA user supplied tag.
+
+@copyright Copyright 2026 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration.
+No copyright is claimed in the United States under Title 17, U.S. Code.
+All Other Rights Reserved.
+
+\par<b>Responsible Organization</b>
+Simulation and Graphics Branch, Mail Code ER7\n
+Software, Robotics & Simulation Division\n
+NASA, Johnson Space Center\n
+2101 NASA Parkway, Houston, TX  77058
+
+@tldh
+@trick_link_dependency{LatencyHistogram.cpp}
+@trick_link_dependency{UpdateLatencyStats.cpp}
+
+@revs_title
+@revs_begin
+@rev_entry{Edwin Z. Crues, NASA ER7, TrickHLA, October 2026, --, Initial implementation.}
+@revs_end
+
+*/
+
+// System includes.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <time.h>
+
+// TrickHLA includes.
+#include "TrickHLA/utils/LatencyHistogram.hh"
+#include "TrickHLA/utils/UpdateLatencyStats.hh"
+
+using namespace std;
+using namespace TrickHLA;
+
+namespace
+{
+
+// Magic number at the start of the latency header, "THLT".
+uint32_t const TAG_MAGIC = 0x54484C54;
+
+// Names of the federate IDs seen in the latency headers.
+map< uint32_t, string > peer_names;
+
+// Wall clock time in microseconds, which is comparable across hosts with
+// synchronized clocks.
+int64_t wall_time_micros()
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_REALTIME, &ts ); // NOLINT
+   return ( ( (int64_t)ts.tv_sec * 1000000 ) + ( (int64_t)ts.tv_nsec / 1000 ) );
+}
+
+// Monotonic time in microseconds.
+int64_t monotonic_micros()
+{
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts ); // NOLINT
+   return ( ( (int64_t)ts.tv_sec * 1000000 ) + ( (int64_t)ts.tv_nsec / 1000 ) );
+}
+
+// Encode a value in network byte order.
+void encode_big_endian(
+   unsigned char *buffer,
+   uint64_t       value,
+   size_t const   size )
+{
+   for ( size_t i = size; i > 0; --i ) {
+      buffer[i - 1] = (unsigned char)( value & 0xFF );
+      value >>= 8;
+   }
+}
+
+// Decode a value in network byte order.
+uint64_t decode_big_endian(
+   unsigned char const *buffer,
+   size_t const         size )
+{
+   uint64_t value = 0;
+   for ( size_t i = 0; i < size; ++i ) {
+      value = ( value << 8 ) | buffer[i];
+   }
+   return value;
+}
+
+} // namespace
+
+/*!
+ * @job_class{initialization}
+ */
+UpdateLatencyStats::UpdateLatencyStats()
+   : enabled( false ),
+     received_count( 0 ),
+     untagged_count( 0 ),
+     dropped_count( 0 ),
+     out_of_order_count( 0 ),
+     last_network_latency( 0.0 ),
+     measuring( false ),
+     send_federate_id( 0 ),
+     send_sequence( 0 ),
+     pending_reflect_times(),
+     peers(),
+     decode_to_use()
+{
+   memset( send_tag, 0, sizeof( send_tag ) );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+UpdateLatencyStats::~UpdateLatencyStats()
+{
+   return;
+}
+
+/*!
+ * @details The pending reflect times are only queued while measuring, so the
+ * enabled flag is latched here rather than read on every reflect and decode.
+ * @job_class{initialization}
+ */
+void UpdateLatencyStats::initialize()
+{
+   this->measuring = enabled;
+   pending_reflect_times.clear();
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+unsigned char const *UpdateLatencyStats::build_send_tag(
+   string const &federate_name )
+{
+   if ( send_federate_id == 0 ) {
+      this->send_federate_id = to_federate_id( federate_name );
+   }
+   ++send_sequence;
+
+   encode_big_endian( &send_tag[0], TAG_MAGIC, 4 );
+   encode_big_endian( &send_tag[4], send_federate_id, 4 );
+   encode_big_endian( &send_tag[8], send_sequence, 8 );
+   encode_big_endian( &send_tag[16], (uint64_t)wall_time_micros(), 8 );
+
+   return send_tag;
+}
+
+/*!
+ * @details The reflect time is queued for every update, tagged or not, so
+ * that it lines up with the queued attribute values of the object.
+ * @job_class{scheduled}
+ */
+void UpdateLatencyStats::reflected(
+   void const  *tag,
+   size_t const tag_size )
+{
+   int64_t const now_wall = wall_time_micros();
+
+   pending_reflect_times.push_back( monotonic_micros() );
+
+   unsigned char const *header = static_cast< unsigned char const * >( tag );
+   if ( ( header == NULL )
+        || ( tag_size != THLA_UPDATE_LATENCY_TAG_SIZE )
+        || ( decode_big_endian( &header[0], 4 ) != TAG_MAGIC ) ) {
+      ++untagged_count;
+      return;
+   }
+
+   uint32_t const federate_id = (uint32_t)decode_big_endian( &header[4], 4 );
+   uint64_t const sequence    = decode_big_endian( &header[8], 8 );
+   int64_t const  send_time   = (int64_t)decode_big_endian( &header[16], 8 );
+
+   PeerStats &peer = peers[federate_id];
+
+   if ( ( peer.received > 0 ) && ( sequence <= peer.last_sequence ) ) {
+      ++peer.out_of_order;
+      ++out_of_order_count;
+   } else {
+      if ( ( peer.received > 0 ) && ( sequence > ( peer.last_sequence + 1 ) ) ) {
+         uint64_t const skipped = sequence - peer.last_sequence - 1;
+         peer.dropped += skipped;
+         dropped_count += skipped;
+      }
+      peer.last_sequence = sequence;
+   }
+   ++peer.received;
+   ++received_count;
+
+   // Clock offsets between the hosts can make the latency negative, which
+   // the histogram records as zero.
+   int64_t const latency = now_wall - send_time;
+   peer.network.record( latency );
+   this->last_network_latency = (double)latency;
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void UpdateLatencyStats::decoded()
+{
+   if ( !pending_reflect_times.empty() ) {
+      decode_to_use.record( monotonic_micros() - pending_reflect_times.front() );
+      pending_reflect_times.pop_front();
+   }
+}
+
+/*!
+ * @job_class{scheduled}
+ */
+void UpdateLatencyStats::clear_pending()
+{
+   pending_reflect_times.clear();
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+void UpdateLatencyStats::merge(
+   UpdateLatencyStats const &other )
+{
+   received_count += other.received_count;
+   untagged_count += other.untagged_count;
+   dropped_count += other.dropped_count;
+   out_of_order_count += other.out_of_order_count;
+
+   map< uint32_t, PeerStats >::const_iterator iter;
+   for ( iter = other.peers.begin(); iter != other.peers.end(); ++iter ) {
+      PeerStats &peer = peers[iter->first];
+      peer.received += iter->second.received;
+      peer.dropped += iter->second.dropped;
+      peer.out_of_order += iter->second.out_of_order;
+      peer.network.merge( iter->second.network );
+   }
+   decode_to_use.merge( other.decode_to_use );
+}
+
+/*!
+ * @job_class{shutdown}
+ */
+std::string const UpdateLatencyStats::to_string() const
+{
+   ostringstream msg;
+   msg << "    tagged-received: " << received_count << endl
+       << "           untagged: " << untagged_count << endl
+       << "            dropped: " << dropped_count << endl
+       << "       out-of-order: " << out_of_order_count << endl
+       << "  decode-to-use latency:" << endl
+       << decode_to_use.to_string( "microseconds" ) << endl;
+
+   map< uint32_t, PeerStats >::const_iterator iter;
+   for ( iter = peers.begin(); iter != peers.end(); ++iter ) {
+      map< uint32_t, string >::const_iterator name_iter = peer_names.find( iter->first );
+      msg << "  peer '"
+          << ( ( name_iter != peer_names.end() ) ? name_iter->second : string( "unknown" ) )
+          << "' (ID:" << iter->first << ")"
+          << " received:" << iter->second.received
+          << " dropped:" << iter->second.dropped
+          << " out-of-order:" << iter->second.out_of_order
+          << " network latency:" << endl
+          << iter->second.network.to_string( "microseconds" ) << endl;
+   }
+   return msg.str();
+}
+
+uint32_t UpdateLatencyStats::to_federate_id(
+   string const &federate_name )
+{
+   // 32 bit FNV-1a hash of the name.
+   uint32_t hash = 2166136261U;
+   for ( size_t i = 0; i < federate_name.size(); ++i ) {
+      hash ^= (unsigned char)federate_name[i];
+      hash *= 16777619U;
+   }
+   return hash;
+}
+
+void UpdateLatencyStats::add_peer_name(
+   string const &federate_name )
+{
+   peer_names[to_federate_id( federate_name )] = federate_name;
+}